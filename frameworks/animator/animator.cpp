@@ -56,8 +56,14 @@ void Animator::Resume()
 
 void Animator::Run()
 {
-    uint32_t elapse = HALTick::GetInstance().GetElapseTime(lastRunTime_);
-    lastRunTime_ = HALTick::GetInstance().GetTime();
+    Run(HALTick::GetInstance().GetTime());
+}
+
+void Animator::Run(uint32_t curTime)
+{
+    /* an animator started during this frame may be newer than the time sampled for the frame */
+    uint32_t elapse = (curTime > lastRunTime_) ? (curTime - lastRunTime_) : 0;
+    lastRunTime_ = curTime;
     runTime_ = (UINT32_MAX - elapse > runTime_) ? (runTime_ + elapse) : period_;
 
     if (!repeat_ && (runTime_ >= period_)) {
@@ -15,7 +15,9 @@
 
 #include "animator/animator_manager.h"
 
+#include "animator/animator_timeline.h"
 #include "common/task_manager.h"
+#include "gfx_utils/graphic_log.h"
 #include "hal_tick.h"
 
 namespace OHOS {
@@ -35,50 +37,65 @@ void AnimatorManager::Add(Animator* animator)
     if (animator == nullptr) {
         return;
     }
-
-    ListNode<Animator*>* pos = list_.Begin();
-    while (pos != list_.End()) {
-        if (pos->data_ == animator) {
-            GRAPHIC_LOGI("do not add animator multi times");
-            return;
-        }
-        pos = pos->next_;
+    if (animator->slot_ != Animator::INVALID_SLOT) {
+        GRAPHIC_LOGI("do not add animator multi times");
+        return;
     }
-
-    list_.PushBack(animator);
+    if (animators_.Size() >= Animator::INVALID_SLOT) {
+        GRAPHIC_LOGE("too many animators");
+        return;
+    }
+    animator->slot_ = animators_.Size();
+    animators_.PushBack(animator);
 }
 
-void AnimatorManager::Remove(const Animator* animator)
+void AnimatorManager::Remove(Animator* animator)
 {
-    if (animator == nullptr) {
+    if ((animator == nullptr) || (animator->slot_ == Animator::INVALID_SLOT)) {
         return;
     }
-    ListNode<Animator*>* pos = list_.Begin();
-    while (pos != list_.End()) {
-        if (pos->data_ == animator) {
-            pos->data_ = nullptr;
-            return;
-        }
-        pos = pos->next_;
+    animators_[animator->slot_] = nullptr;
+    animator->slot_ = Animator::INVALID_SLOT;
+    holeNum_++;
+    /* the slots must stay in place while the animators are running */
+    if (!running_ && (holeNum_ > (animators_.Size() >> 1))) {
+        Compact();
     }
 }
 
-void AnimatorManager::AnimatorTask()
+void AnimatorManager::Compact()
 {
-    ListNode<Animator*>* pos = list_.Begin();
-    Animator* animator = nullptr;
-
-    while (pos != list_.End()) {
-        animator = pos->data_;
+    uint16_t dst = 0;
+    for (uint16_t src = 0; src < animators_.Size(); src++) {
+        Animator* animator = animators_[src];
         if (animator == nullptr) {
-            // clean up animator list
-            pos = list_.Remove(pos);
             continue;
         }
-        if (animator->GetState() == Animator::START) {
-            animator->Run();
+        animator->slot_ = dst;
+        animators_[dst++] = animator;
+    }
+    while (animators_.Size() > dst) {
+        animators_.PopBack();
+    }
+    holeNum_ = 0;
+}
+
+void AnimatorManager::AnimatorTask()
+{
+    uint32_t curTime = HALTick::GetInstance().GetTime();
+    running_ = true;
+    /* animators started by the callbacks are appended and run in the same frame */
+    for (uint16_t i = 0; i < animators_.Size(); i++) {
+        Animator* animator = animators_[i];
+        if ((animator != nullptr) && (animator->GetState() == Animator::START)) {
+            animator->Run(curTime);
         }
-        pos = pos->next_;
     }
+    running_ = false;
+    if (holeNum_ > 0) {
+        Compact();
+    }
+
+    AnimatorTimeline::GetInstance()->Update();
 }
 } // namespace OHOS
@@ -37,7 +37,7 @@
 
 #include "animator/animator.h"
 #include "common/task.h"
-#include "gfx_utils/list.h"
+#include "gfx_utils/vector.h"
 
 namespace OHOS {
 /**
@@ -63,7 +63,7 @@ public:
     void Init() override;
 
     /**
-     * @brief Adds the <b>Animator</b> instance to the <b>AnimatorManager</b> linked list for management,
+     * @brief Adds the <b>Animator</b> instance to the <b>AnimatorManager</b> for management,
      *        so that the {@link Run} function of the <b>Animator</b> class is called once for each frame.
      *
      * @param animator Indicates the pointer to the <b>Animator</b> instance to add.
@@ -74,14 +74,14 @@ public:
     void Add(Animator* animator);
 
     /**
-     * @brief Removes the <b>Animator</b> instance from the <b>AnimatorManager</b> linked list.
+     * @brief Removes the <b>Animator</b> instance from the <b>AnimatorManager</b>.
      *
      * @param animator Indicates the pointer to the <b>Animator</b> instance to remove.
      * @see Add
      * @since 1.0
      * @version 1.0
      */
-    void Remove(const Animator* animator);
+    void Remove(Animator* animator);
 
     void AnimatorTask();
 
@@ -91,8 +91,13 @@ public:
     }
 
 protected:
-    List<Animator*> list_;
-    AnimatorManager() {}
+    void Compact();
+
+    /* removed animators leave null slots, which are compacted after the frame */
+    Graphic::Vector<Animator*> animators_;
+    uint16_t holeNum_;
+    bool running_;
+    AnimatorManager() : holeNum_(0), running_(false) {}
     virtual ~AnimatorManager() {}
     AnimatorManager(const AnimatorManager&) = delete;
     AnimatorManager& operator=(const AnimatorManager&) = delete;
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animator/animator_timeline.h"
+
+#include "gfx_utils/graphic_log.h"
+#include "hal_tick.h"
+
+namespace OHOS {
+namespace {
+/* Easing results in the lookup tables are stored in [0, 1 << EASING_VALUE_SHIFT]. */
+constexpr uint8_t EASING_VALUE_SHIFT = 10;
+constexpr int16_t EASING_VALUE_RANGE = 1 << EASING_VALUE_SHIFT;
+constexpr int32_t EASING_VALUE_ROUND = 1 << (EASING_VALUE_SHIFT - 1);
+constexpr uint32_t EASING_FRACTION_MASK = 0xFF;
+} // namespace
+
+AnimatorTimeline* AnimatorTimeline::GetInstance()
+{
+    /* views release their tracks when destroyed, so the timeline must outlive the static views */
+    static AnimatorTimeline* timeline = new AnimatorTimeline();
+    return timeline;
+}
+
+AnimatorTimeline::~AnimatorTimeline()
+{
+    for (uint8_t i = 0; i < easingNum_; i++) {
+        delete[] easingTables_[i].lut;
+        easingTables_[i].lut = nullptr;
+    }
+    easingNum_ = 0;
+}
+
+int16_t AnimatorTimeline::GetEasingIndex(EasingFunc easing)
+{
+    for (uint8_t i = 0; i < easingNum_; i++) {
+        if (easingTables_[i].func == easing) {
+            return i;
+        }
+    }
+    if (easingNum_ >= MAX_EASING_NUM) {
+        GRAPHIC_LOGE("too many easing curves in animator timeline");
+        return -1;
+    }
+
+    int16_t* lut = new int16_t[EASING_LUT_SIZE + 1];
+    if (lut == nullptr) {
+        return -1;
+    }
+    for (uint16_t i = 0; i <= EASING_LUT_SIZE; i++) {
+        lut[i] = easing(0, EASING_VALUE_RANGE, i, EASING_LUT_SIZE);
+    }
+    easingTables_[easingNum_].func = easing;
+    easingTables_[easingNum_].lut = lut;
+    return easingNum_++;
+}
+
+int16_t AnimatorTimeline::FindTrack(int16_t trackId) const
+{
+    for (uint16_t i = 0; i < targets_.Size(); i++) {
+        if (targets_[i].id == trackId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int16_t AnimatorTimeline::GetNextId()
+{
+    /* the ids wrap around, so skip the ones still used by long running tracks */
+    for (int32_t i = 0; i <= INT16_MAX; i++) {
+        int16_t id = nextId_;
+        nextId_ = (nextId_ == INT16_MAX) ? 0 : (nextId_ + 1);
+        if (FindTrack(id) < 0) {
+            return id;
+        }
+    }
+    GRAPHIC_LOGE("too many tracks in animator timeline");
+    return INVALID_TRACK_ID;
+}
+
+uint16_t AnimatorTimeline::GetInsertPosition(const UIView* view) const
+{
+    /* Keep the tracks of one view adjacent, so that the view is invalidated only once per frame. */
+    for (int32_t i = static_cast<int32_t>(targets_.Size()) - 1; i >= 0; i--) {
+        if (targets_[i].view == view) {
+            return static_cast<uint16_t>(i + 1);
+        }
+    }
+    return targets_.Size();
+}
+
+int16_t AnimatorTimeline::AddTrack(UIView* view,
+                                   uint8_t property,
+                                   int16_t startPos,
+                                   int16_t endPos,
+                                   uint16_t time,
+                                   EasingFunc easing,
+                                   bool repeat,
+                                   AnimatorCallback* callback)
+{
+    if ((view == nullptr) || (easing == nullptr) || (property >= PROPERTY_MAX) || (time == 0)) {
+        return INVALID_TRACK_ID;
+    }
+    int16_t easingIndex = GetEasingIndex(easing);
+    if (easingIndex < 0) {
+        return INVALID_TRACK_ID;
+    }
+    int16_t id = GetNextId();
+    if (id == INVALID_TRACK_ID) {
+        return INVALID_TRACK_ID;
+    }
+
+    if (states_.Size() == 0) {
+        lastRunTime_ = HALTick::GetInstance().GetTime();
+    }
+
+    TrackState state;
+    state.elapse = 0;
+    state.invTime = (static_cast<uint32_t>(EASING_LUT_SIZE) << PROGRESS_SHIFT) / time;
+    state.time = time;
+    state.startPos = startPos;
+    state.delta = static_cast<int32_t>(endPos) - startPos;
+    state.easingIndex = static_cast<uint8_t>(easingIndex);
+    state.flags = repeat ? FLAG_REPEAT : 0;
+
+    TrackTarget target;
+    target.view = view;
+    target.callback = callback;
+    target.id = id;
+    target.property = property;
+
+    uint16_t pos = GetInsertPosition(view);
+    states_.PushBack(state);
+    targets_.PushBack(target);
+    values_.PushBack(startPos);
+    for (uint16_t i = states_.Size() - 1; i > pos; i--) {
+        states_[i] = states_[i - 1];
+        targets_[i] = targets_[i - 1];
+        values_[i] = values_[i - 1];
+    }
+    states_[pos] = state;
+    targets_[pos] = target;
+    values_[pos] = startPos;
+    return target.id;
+}
+
+void AnimatorTimeline::EraseTrack(uint16_t index)
+{
+    uint16_t size = states_.Size();
+    for (uint16_t i = index; i + 1 < size; i++) {
+        states_[i] = states_[i + 1];
+        targets_[i] = targets_[i + 1];
+        values_[i] = values_[i + 1];
+    }
+    states_.PopBack();
+    targets_.PopBack();
+    values_.PopBack();
+}
+
+void AnimatorTimeline::RemoveTrack(int16_t trackId)
+{
+    int16_t index = FindTrack(trackId);
+    if (index >= 0) {
+        EraseTrack(static_cast<uint16_t>(index));
+    }
+}
+
+void AnimatorTimeline::RemoveTracks(const UIView* view)
+{
+    if (view == nullptr) {
+        return;
+    }
+    /* tracks which have just finished must not call back on a destroyed view either */
+    for (uint16_t i = 0; i < finished_.Size(); i++) {
+        if (finished_[i].view == view) {
+            finished_[i].callback = nullptr;
+        }
+    }
+    uint16_t dst = 0;
+    for (uint16_t src = 0; src < states_.Size(); src++) {
+        if (targets_[src].view == view) {
+            continue;
+        }
+        if (dst != src) {
+            states_[dst] = states_[src];
+            targets_[dst] = targets_[src];
+            values_[dst] = values_[src];
+        }
+        dst++;
+    }
+    while (states_.Size() > dst) {
+        states_.PopBack();
+        targets_.PopBack();
+        values_.PopBack();
+    }
+}
+
+bool AnimatorTimeline::IsTrackRunning(int16_t trackId) const
+{
+    return (trackId != INVALID_TRACK_ID) && (FindTrack(trackId) >= 0);
+}
+
+void AnimatorTimeline::Update()
+{
+    if (states_.Size() == 0) {
+        return;
+    }
+    uint32_t elapse = HALTick::GetInstance().GetElapseTime(lastRunTime_);
+    lastRunTime_ = HALTick::GetInstance().GetTime();
+    Update(elapse);
+}
+
+void AnimatorTimeline::Update(uint32_t elapse)
+{
+    if (states_.Size() == 0) {
+        return;
+    }
+    EvaluateTracks(elapse);
+    ApplyTracks();
+
+    /* Stop callbacks may add or remove tracks, so they are called after the arrays are compacted. */
+    CompactTracks(finished_);
+    for (uint16_t i = 0; i < finished_.Size(); i++) {
+        if (finished_[i].callback != nullptr) {
+            finished_[i].callback->OnStop(*finished_[i].view);
+        }
+    }
+    while (finished_.Size() > 0) {
+        finished_.PopBack();
+    }
+}
+
+void AnimatorTimeline::EvaluateTracks(uint32_t elapse)
+{
+    uint16_t size = states_.Size();
+    TrackState* state = states_.Begin();
+    int16_t* value = values_.Begin();
+    for (uint16_t i = 0; i < size; i++, state++, value++) {
+        uint32_t curTime = state->elapse + elapse;
+        if (curTime >= state->time) {
+            if ((state->flags & FLAG_REPEAT) != 0) {
+                curTime %= state->time;
+            } else {
+                curTime = state->time;
+                state->flags |= FLAG_FINISHED;
+            }
+        }
+        state->elapse = curTime;
+
+        /* progress is the position in the lookup table, with PROGRESS_SHIFT fractional bits */
+        uint32_t progress = curTime * state->invTime;
+        uint32_t index = progress >> PROGRESS_SHIFT;
+        const int16_t* lut = easingTables_[state->easingIndex].lut;
+        int32_t eased = lut[index];
+        if (index < EASING_LUT_SIZE) {
+            int32_t fraction = (progress >> (PROGRESS_SHIFT - EASING_LUT_SHIFT)) & EASING_FRACTION_MASK;
+            eased += ((lut[index + 1] - eased) * fraction) >> EASING_LUT_SHIFT;
+        }
+        int32_t offset = (state->delta * eased + EASING_VALUE_ROUND) >> EASING_VALUE_SHIFT;
+        *value = static_cast<int16_t>(state->startPos + offset);
+    }
+}
+
+void AnimatorTimeline::ApplyTracks()
+{
+    uint16_t size = targets_.Size();
+    uint16_t i = 0;
+    while (i < size) {
+        UIView* view = targets_[i].view;
+        Rect refresh = view->GetRect();
+        for (; (i < size) && (targets_[i].view == view); i++) {
+            ApplyProperty(view, targets_[i].property, values_[i]);
+        }
+        Rect rect = view->GetRect();
+        refresh.Join(refresh, rect);
+        view->InvalidateRect(refresh);
+    }
+}
+
+void AnimatorTimeline::CompactTracks(Graphic::Vector<TrackTarget>& finished)
+{
+    uint16_t dst = 0;
+    for (uint16_t src = 0; src < states_.Size(); src++) {
+        if ((states_[src].flags & FLAG_FINISHED) != 0) {
+            if (targets_[src].callback != nullptr) {
+                finished.PushBack(targets_[src]);
+            }
+            continue;
+        }
+        if (dst != src) {
+            states_[dst] = states_[src];
+            targets_[dst] = targets_[src];
+            values_[dst] = values_[src];
+        }
+        dst++;
+    }
+    while (states_.Size() > dst) {
+        states_.PopBack();
+        targets_.PopBack();
+        values_.PopBack();
+    }
+}
+
+void AnimatorTimeline::ApplyProperty(UIView* view, uint8_t property, int16_t value)
+{
+    switch (property) {
+        case PROPERTY_X:
+            view->SetX(value);
+            break;
+        case PROPERTY_Y:
+            view->SetY(value);
+            break;
+        case PROPERTY_WIDTH:
+            view->SetWidth(value);
+            break;
+        case PROPERTY_HEIGHT:
+            view->SetHeight(value);
+            break;
+        case PROPERTY_OPA_SCALE:
+            view->SetOpaScale(static_cast<uint8_t>(MATH_MAX(0, MATH_MIN(value, OPA_OPAQUE))));
+            break;
+        default:
+            break;
+    }
+}
+} // namespace OHOS
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/decoded_text.h"
+
+#include "common/typed_text.h"
+#include "font/ui_font.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+
+namespace OHOS {
+namespace {
+/* the bytes tested at once for an ASCII run, the compiler turns the test into a word or vector load */
+constexpr uint8_t ASCII_BLOCK_SIZE = 8;
+constexpr uint8_t ASCII_MASK = 0x80;
+constexpr uint8_t ASCII_NUM = 128;
+constexpr uint16_t INVALID_WIDTH = 0xFFFF;
+} // namespace
+
+bool DecodedText::IsAsciiBlock(const char* text)
+{
+    uint8_t bits = 0;
+    for (uint8_t i = 0; i < ASCII_BLOCK_SIZE; i++) {
+        bits |= static_cast<uint8_t>(text[i]);
+    }
+    return (bits & ASCII_MASK) == 0;
+}
+
+uint32_t DecodedText::GetNext(uint32_t i, uint32_t& next) const
+{
+    uint8_t letterSize = TypedText::GetUTF8OneCharacterSize(text_ + i);
+    if (i + letterSize > byteNum_) {
+        /* a sequence cut by the end of the text is not read past it */
+        next = byteNum_;
+        return 0;
+    }
+    return TypedText::GetUTF8Next(text_, i, next);
+}
+
+uint16_t DecodedText::CountLetters(bool& isAscii) const
+{
+    uint32_t letterNum = 0;
+    uint32_t i = 0;
+    isAscii = true;
+    while (i < byteNum_) {
+        if ((i + ASCII_BLOCK_SIZE <= byteNum_) && IsAsciiBlock(text_ + i)) {
+            i += ASCII_BLOCK_SIZE;
+            letterNum += ASCII_BLOCK_SIZE;
+            continue;
+        }
+        if ((static_cast<uint8_t>(text_[i]) & ASCII_MASK) == 0) {
+            i++;
+        } else {
+            isAscii = false;
+            GetNext(i, i);
+        }
+        letterNum++;
+    }
+    return static_cast<uint16_t>(letterNum);
+}
+
+bool DecodedText::Build(const char* text, uint32_t byteNum)
+{
+    Clear();
+    if ((text == nullptr) || (byteNum == 0) || (byteNum > UINT16_MAX)) {
+        return false;
+    }
+    text_ = text;
+    byteNum_ = static_cast<uint16_t>(byteNum);
+    bool isAscii = true;
+    letterNum_ = CountLetters(isAscii);
+    codePoints_ = static_cast<uint32_t*>(UIMalloc(letterNum_ * sizeof(uint32_t)));
+    if (!isAscii) {
+        offsets_ = static_cast<uint16_t*>(UIMalloc((letterNum_ + 1) * sizeof(uint16_t)));
+    }
+    if ((codePoints_ == nullptr) || (!isAscii && (offsets_ == nullptr))) {
+        GRAPHIC_LOGE("DecodedText::Build alloc fail");
+        Clear();
+        return false;
+    }
+
+    if (isAscii) {
+        for (uint16_t i = 0; i < byteNum_; i++) {
+            codePoints_[i] = static_cast<uint8_t>(text_[i]);
+        }
+        return true;
+    }
+    uint32_t i = 0;
+    uint16_t letter = 0;
+    while (i < byteNum_) {
+        if ((i + ASCII_BLOCK_SIZE <= byteNum_) && IsAsciiBlock(text_ + i)) {
+            for (uint8_t j = 0; j < ASCII_BLOCK_SIZE; j++, i++, letter++) {
+                offsets_[letter] = static_cast<uint16_t>(i);
+                codePoints_[letter] = static_cast<uint8_t>(text_[i]);
+            }
+            continue;
+        }
+        offsets_[letter] = static_cast<uint16_t>(i);
+        codePoints_[letter++] = GetNext(i, i);
+    }
+    offsets_[letterNum_] = byteNum_;
+    return true;
+}
+
+void DecodedText::Clear()
+{
+    if (codePoints_ != nullptr) {
+        UIFree(codePoints_);
+        codePoints_ = nullptr;
+    }
+    if (offsets_ != nullptr) {
+        UIFree(offsets_);
+        offsets_ = nullptr;
+    }
+    if (widths_ != nullptr) {
+        UIFree(widths_);
+        widths_ = nullptr;
+    }
+    text_ = nullptr;
+    letterNum_ = 0;
+    byteNum_ = 0;
+}
+
+uint16_t DecodedText::GetLetterIndex(uint32_t byteOffset) const
+{
+    if (byteOffset >= byteNum_) {
+        return letterNum_;
+    }
+    if (offsets_ == nullptr) {
+        return static_cast<uint16_t>(byteOffset);
+    }
+    /* the first letter starting at or after byteOffset */
+    uint16_t low = 0;
+    uint16_t high = letterNum_;
+    while (low < high) {
+        uint16_t mid = low + ((high - low) >> 1);
+        if (offsets_[mid] < byteOffset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+const uint16_t* DecodedText::GetWidths(uint16_t fontId, uint8_t fontSize)
+{
+    if (letterNum_ == 0) {
+        return nullptr;
+    }
+    if ((widths_ != nullptr) && (widthFontId_ == fontId) && (widthFontSize_ == fontSize)) {
+        return widths_;
+    }
+    if (widths_ == nullptr) {
+        widths_ = static_cast<uint16_t*>(UIMalloc(letterNum_ * sizeof(uint16_t)));
+        if (widths_ == nullptr) {
+            return nullptr;
+        }
+    }
+    /* the ASCII letters repeat, the font is asked for each of them once */
+    uint16_t asciiWidths[ASCII_NUM];
+    for (uint8_t i = 0; i < ASCII_NUM; i++) {
+        asciiWidths[i] = INVALID_WIDTH;
+    }
+    UIFont* fontEngine = UIFont::GetInstance();
+    for (uint16_t i = 0; i < letterNum_; i++) {
+        uint32_t letter = codePoints_[i];
+        if (letter >= ASCII_NUM) {
+            widths_[i] = fontEngine->GetWidth(letter, fontId, fontSize, 0);
+            continue;
+        }
+        if (asciiWidths[letter] == INVALID_WIDTH) {
+            asciiWidths[letter] = fontEngine->GetWidth(letter, fontId, fontSize, 0);
+        }
+        widths_[i] = asciiWidths[letter];
+    }
+    widthFontId_ = fontId;
+    widthFontSize_ = fontSize;
+    return widths_;
+}
+} // namespace OHOS
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_DECODED_TEXT_H
+#define GRAPHIC_LITE_DECODED_TEXT_H
+
+#include "gfx_utils/heap_base.h"
+#include "gfx_utils/graphic_types.h"
+
+namespace OHOS {
+/*
+ * The letters of a UTF-8 text decoded once, so measuring, breaking, drawing and hit-testing the text do not decode
+ * it again on every pass. Letter i is code point i and starts at byte offset i of the text, the offset after the last
+ * letter being the length of the text. The letters are the ones TypedText::GetUTF8Next steps over, invalid sequences
+ * included. Runs of ASCII letters are decoded a block at a time, and a text made of them only keeps no byte offsets.
+ * The widths of the letters are kept for the last font they are asked for.
+ */
+class DecodedText : public HeapBase {
+public:
+    DecodedText()
+        : text_(nullptr),
+          codePoints_(nullptr),
+          offsets_(nullptr),
+          widths_(nullptr),
+          letterNum_(0),
+          byteNum_(0),
+          widthFontId_(0),
+          widthFontSize_(0)
+    {
+    }
+
+    ~DecodedText()
+    {
+        Clear();
+    }
+
+    /* The text stays owned by the caller and must not change while it is decoded. */
+    bool Build(const char* text, uint32_t byteNum);
+
+    void Clear();
+
+    const char* GetText() const
+    {
+        return text_;
+    }
+
+    uint16_t GetLetterNum() const
+    {
+        return letterNum_;
+    }
+
+    uint16_t GetByteNum() const
+    {
+        return byteNum_;
+    }
+
+    bool IsAscii() const
+    {
+        return (text_ != nullptr) && (offsets_ == nullptr);
+    }
+
+    const uint32_t* GetCodePoints() const
+    {
+        return codePoints_;
+    }
+
+    /* letterIndex may be the letter number, for the end of the text */
+    uint16_t GetByteOffset(uint16_t letterIndex) const
+    {
+        return (offsets_ == nullptr) ? letterIndex : offsets_[letterIndex];
+    }
+
+    /* The number of letters starting before byteOffset, as TypedText::GetUTF8CharacterSize counts them. */
+    uint16_t GetLetterIndex(uint32_t byteOffset) const;
+
+    /* The width of each letter in the font, as UIFont::GetWidth returns it. */
+    const uint16_t* GetWidths(uint16_t fontId, uint8_t fontSize);
+
+private:
+    DecodedText(const DecodedText&) = delete;
+    DecodedText& operator=(const DecodedText&) = delete;
+    DecodedText(DecodedText&&) = delete;
+    DecodedText& operator=(DecodedText&&) = delete;
+
+    static bool IsAsciiBlock(const char* text);
+    uint32_t GetNext(uint32_t i, uint32_t& next) const;
+    uint16_t CountLetters(bool& isAscii) const;
+
+    const char* text_;
+    uint32_t* codePoints_;
+    uint16_t* offsets_; // letterNum_ + 1 of them, nullptr for an ASCII text
+    uint16_t* widths_;
+    uint16_t letterNum_;
+    uint16_t byteNum_;
+    uint16_t widthFontId_;
+    uint8_t widthFontSize_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_DECODED_TEXT_H
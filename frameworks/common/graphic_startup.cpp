@@ -21,6 +21,7 @@
 #include "core/render_manager.h"
 #include "dfx/performance_task.h"
 #include "font/ui_font.h"
+#include "font/ui_font_cache_manager.h"
 #if ENABLE_ICU
 #include "font/ui_line_break.h"
 #endif
@@ -68,6 +69,13 @@ void GraphicStartUp::InitFontEngine(uintptr_t cacheMemAddr,
     (void)uiFont->SetCurrentLangId(0); // set language
 }
 
+void GraphicStartUp::SetGlyphsCacheCapacity(uint32_t glyphNum)
+{
+    if (UIFontCacheManager::GetInstance()->SetGlyphsCacheCapacity(glyphNum) != RET_VALUE_OK) {
+        GRAPHIC_LOGW("SetGlyphsCacheCapacity failed");
+    }
+}
+
 void GraphicStartUp::InitLineBreakEngine(uintptr_t cacheMemAddr, uint32_t cacheMemLen, const char* path,
                                          const char* fileName)
 {
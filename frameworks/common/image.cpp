@@ -15,18 +15,30 @@
 
 #include "common/image.h"
 #include "common/image_decode_ability.h"
+#include "dfx/ui_render_trace.h"
 #include "draw/draw_image.h"
 #include "gfx_utils/file.h"
 #include "gfx_utils/graphic_log.h"
 #include "imgdecode/cache_manager.h"
+#include "imgdecode/image_mipmap.h"
 #if ENABLE_JPEG_AND_PNG
+#include <csetjmp>
 #include "jpeglib.h"
 #include "png.h"
 #endif
 #include "securec.h"
 
 namespace OHOS {
-Image::Image() : imageInfo_(nullptr), path_(nullptr), srcType_(IMG_SRC_UNKNOWN), mallocFlag_(false) {}
+Image::Image()
+    : imageInfo_(nullptr),
+      path_(nullptr),
+      srcType_(IMG_SRC_UNKNOWN),
+      mallocFlag_(false),
+      decodeShift_(0),
+      decodeSize_{0, 0, false},
+      mipmap_(nullptr)
+{
+}
 
 Image::~Image()
 {
@@ -95,15 +107,6 @@ bool Image::SetStandardSrc(const char* src)
         return false;
     }
 
-#if ENABLE_JPEG_AND_PNG
-    ImageType imageType = CheckImgType(src);
-    if (imageType == IMG_PNG) {
-        return SetPNGSrc(src);
-    } else if (imageType == IMG_JPEG) {
-        return SetJPEGSrc(src);
-    }
-#endif
-
     size_t strLen = strlen(src) + 1;
     char* imagePath = static_cast<char*>(UIMalloc(static_cast<uint32_t>(strLen)));
     if (imagePath == nullptr) {
@@ -116,6 +119,16 @@ bool Image::SetStandardSrc(const char* src)
         return false;
     }
     path_ = imagePath;
+
+#if ENABLE_JPEG_AND_PNG
+    /* the path is kept for decoded files as well, so that they can be decoded again at another size */
+    ImageType imageType = CheckImgType(src);
+    if (imageType == IMG_PNG) {
+        return SetPNGSrc(src);
+    } else if (imageType == IMG_JPEG) {
+        return SetJPEGSrc(src);
+    }
+#endif
     srcType_ = IMG_SRC_FILE;
     return true;
 }
@@ -252,6 +265,68 @@ bool Image::PreParse(const char *src)
     return isSucess;
 }
 
+bool Image::SetDecodedSrc(const char* src, ImageInfo* imgInfo, uint8_t decodeShift)
+{
+    if ((src == nullptr) || (imgInfo == nullptr)) {
+        return false;
+    }
+    size_t strLen = strlen(src) + 1;
+    char* path = static_cast<char*>(UIMalloc(static_cast<uint32_t>(strLen)));
+    if (path == nullptr) {
+        return false;
+    }
+    if (strcpy_s(path, strLen, src) != EOK) {
+        UIFree(reinterpret_cast<void*>(path));
+        return false;
+    }
+    if (path_ != nullptr) {
+        UIFree(reinterpret_cast<void*>(path_));
+    }
+    path_ = path;
+    ReInitImageInfo(imgInfo, true);
+    decodeShift_ = decodeShift;
+    srcType_ = IMG_SRC_VARIABLE;
+    return true;
+}
+
+bool Image::ReDecode()
+{
+#if ENABLE_JPEG_AND_PNG
+    if ((decodeShift_ == 0) || (srcType_ != IMG_SRC_VARIABLE) || (imageInfo_ == nullptr) || (path_ == nullptr)) {
+        return false;
+    }
+    uint32_t width = static_cast<uint32_t>(imageInfo_->header.width) << decodeShift_;
+    uint32_t height = static_cast<uint32_t>(imageInfo_->header.height) << decodeShift_;
+    if (GetDecodeShift(width, height, decodeSize_) >= decodeShift_) {
+        return false;
+    }
+    uint8_t shift = 0;
+    ImageInfo* imgInfo = nullptr;
+    ImageType imageType = CheckImgType(path_);
+    if (imageType == IMG_PNG) {
+        imgInfo = DecodePNG(path_, decodeSize_, shift);
+    } else if (imageType == IMG_JPEG) {
+        imgInfo = DecodeJPEG(path_, decodeSize_, shift);
+    }
+    if (imgInfo == nullptr) {
+        return false;
+    }
+    ReInitImageInfo(imgInfo, true);
+    decodeShift_ = shift;
+    return true;
+#else
+    return false;
+#endif
+}
+
+const ImageMipmap* Image::GetMipmap() const
+{
+    if ((mipmap_ == nullptr) && (srcType_ == IMG_SRC_VARIABLE) && (imageInfo_ != nullptr)) {
+        mipmap_ = ImageMipmap::Create(*imageInfo_);
+    }
+    return mipmap_;
+}
+
 void Image::DrawImage(BufferInfo& gfxDstBuffer,
                       const Rect& coords,
                       const Rect& mask,
@@ -268,62 +343,183 @@ void Image::DrawImage(BufferInfo& gfxDstBuffer,
 }
 
 #if ENABLE_JPEG_AND_PNG
+namespace {
+constexpr uint8_t DECODED_PX_BYTES = 4; // 4: bytes per pixel of ARGB8888
+}
 
-static inline void FreePngBytep(png_bytep** rowPointer, uint16_t size)
+uint8_t Image::GetDecodeShift(uint32_t width, uint32_t height, const DecodeSize& size)
 {
-    png_bytep* tmpRowPointer = *rowPointer;
-    for (uint16_t i = 0; i < size; i++) {
-        UIFree(tmpRowPointer[i]);
-        tmpRowPointer[i] = nullptr;
+    if ((size.width == 0) || (size.height == 0)) {
+        return 0;
+    }
+    uint8_t shift = 0;
+    while (shift < MAX_DECODE_SHIFT) {
+        uint32_t nextWidth = width >> (shift + 1);
+        uint32_t nextHeight = height >> (shift + 1);
+        bool enough = size.fitInside ? ((nextWidth >= size.width) || (nextHeight >= size.height)) :
+                                       ((nextWidth >= size.width) && (nextHeight >= size.height));
+        if (!enough) {
+            break;
+        }
+        shift++;
     }
-    UIFree(*rowPointer);
-    *rowPointer = nullptr;
+    return shift;
 }
 
-static inline png_bytep* MallocPngBytep(uint16_t height, uint32_t rowBytes)
+/* adds one source row to the per channel sums of the (1 << shift) wide blocks */
+static void AccumulateScaledRow(const uint8_t* src, uint16_t width, uint8_t shift, uint32_t* sum)
 {
-    png_bytep* rowPointer = static_cast<png_bytep*>(UIMalloc(sizeof(png_bytep) * height));
-    if (rowPointer == nullptr) {
-        return nullptr;
+    for (uint16_t x = 0; x < width; x++) {
+        uint32_t* block = sum + (x >> shift) * DECODED_PX_BYTES;
+        for (uint8_t c = 0; c < DECODED_PX_BYTES; c++) {
+            block[c] += src[c];
+        }
+        src += DECODED_PX_BYTES;
     }
-    for (uint16_t y = 0; y < height; y++) {
-        rowPointer[y] = static_cast<png_byte*>(UIMalloc(rowBytes));
-        if (rowPointer[y] == nullptr) {
-            FreePngBytep(&rowPointer, y);
-            return nullptr;
+}
+
+/* writes the averages of a block row and clears the sums, the last block of a row may be narrower */
+static void FlushScaledRow(uint32_t* sum, uint16_t width, uint8_t shift, uint16_t rows, uint8_t* dst)
+{
+    uint16_t dstWidth = ((width - 1) >> shift) + 1;
+    for (uint16_t x = 0; x < dstWidth; x++) {
+        uint32_t cols = 1 << shift;
+        uint32_t rest = width - (x << shift);
+        uint32_t count = ((rest < cols) ? rest : cols) * rows;
+        for (uint8_t c = 0; c < DECODED_PX_BYTES; c++) {
+            dst[c] = static_cast<uint8_t>((sum[c] + (count >> 1)) / count);
+            sum[c] = 0;
         }
+        sum += DECODED_PX_BYTES;
+        dst += DECODED_PX_BYTES;
     }
-    return rowPointer;
 }
 
-bool Image::SetPNGSrc(const char* src)
+/* decodes the rows of a PNG file and averages every (1 << shift) x (1 << shift) block into one pixel of dst */
+static bool ReadPNGScaled(png_structp png, int32_t passes, uint16_t width, uint16_t height, uint8_t shift,
+                          uint8_t* dst)
 {
-    srcType_ = IMG_SRC_UNKNOWN;
-    png_bytep* rowPointer = nullptr;
+    uint32_t rowBytes = static_cast<uint32_t>(width) * DECODED_PX_BYTES;
+    /* an interlaced image is only complete after its last pass, so every row has to be kept until then */
+    uint32_t bufRows = (passes > 1) ? height : 1;
+    uint16_t dstWidth = ((width - 1) >> shift) + 1;
+    uint32_t sumSize = static_cast<uint32_t>(dstWidth) * DECODED_PX_BYTES * sizeof(uint32_t);
+    uint8_t* rows = static_cast<uint8_t*>(UIMalloc(rowBytes * bufRows));
+    uint32_t* sum = static_cast<uint32_t*>(UIMalloc(sumSize));
+    if ((rows == nullptr) || (sum == nullptr) || (memset_s(sum, sumSize, 0, sumSize) != EOK)) {
+        if (rows != nullptr) {
+            UIFree(reinterpret_cast<void*>(rows));
+        }
+        if (sum != nullptr) {
+            UIFree(reinterpret_cast<void*>(sum));
+        }
+        return false;
+    }
+    /* a corrupt row jumps here, the buffers are freed before the error is passed on to the jump of the caller */
+    jmp_buf callerJmp;
+    if (memcpy_s(callerJmp, sizeof(jmp_buf), png_jmpbuf(png), sizeof(jmp_buf)) != EOK) {
+        UIFree(reinterpret_cast<void*>(rows));
+        UIFree(reinterpret_cast<void*>(sum));
+        return false;
+    }
+    if (setjmp(png_jmpbuf(png))) {
+        UIFree(reinterpret_cast<void*>(rows));
+        UIFree(reinterpret_cast<void*>(sum));
+        (void)memcpy_s(png_jmpbuf(png), sizeof(jmp_buf), callerJmp, sizeof(jmp_buf));
+        return false;
+    }
+    uint16_t blockRows = 0;
+    for (int32_t pass = 0; pass < passes; pass++) {
+        for (uint16_t y = 0; y < height; y++) {
+            png_bytep row = (passes > 1) ? (rows + y * rowBytes) : rows;
+            png_read_row(png, row, nullptr);
+            if (pass != passes - 1) {
+                continue;
+            }
+            AccumulateScaledRow(row, width, shift, sum);
+            blockRows++;
+            if ((blockRows == (1 << shift)) || (y == height - 1)) {
+                FlushScaledRow(sum, width, shift, blockRows, dst);
+                dst += dstWidth * DECODED_PX_BYTES;
+                blockRows = 0;
+            }
+        }
+    }
+    (void)memcpy_s(png_jmpbuf(png), sizeof(jmp_buf), callerJmp, sizeof(jmp_buf));
+    UIFree(reinterpret_cast<void*>(rows));
+    UIFree(reinterpret_cast<void*>(sum));
+    return true;
+}
+
+static ImageInfo* CreateDecodedImageInfo(uint16_t width, uint16_t height, uint8_t*& data)
+{
+    if ((width == 0) || (height == 0)) {
+        return nullptr;
+    }
+    uint8_t pixelByteSize = DrawUtils::GetPxSizeByColorMode(ARGB8888) >> 3; // 3: Shift right 3 bits
+    uint32_t dataSize = static_cast<uint32_t>(height) * width * pixelByteSize;
+    ImageInfo* imgInfo = static_cast<ImageInfo*>(UIMalloc(sizeof(ImageInfo)));
+    if (imgInfo == nullptr) {
+        return nullptr;
+    }
+    data = static_cast<uint8_t*>(UIMalloc(dataSize));
+    if (data == nullptr) {
+        UIFree(imgInfo);
+        return nullptr;
+    }
+    imgInfo->header.width = width;
+    imgInfo->header.height = height;
+    imgInfo->header.colorMode = ARGB8888;
+    imgInfo->dataSize = dataSize;
+    imgInfo->data = data;
+    return imgInfo;
+}
+
+void Image::FreeDecodedImageInfo(ImageInfo* imgInfo)
+{
+    if (imgInfo == nullptr) {
+        return;
+    }
+    if (imgInfo->data != nullptr) {
+        UIFree(reinterpret_cast<void*>(const_cast<uint8_t*>(imgInfo->data)));
+    }
+    UIFree(reinterpret_cast<void*>(imgInfo));
+}
+
+ImageInfo* Image::DecodePNG(const char* src, const DecodeSize& size, uint8_t& shift)
+{
+    UI_RENDER_TRACE_SCOPE("DecodePNG");
     png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
     if (png == nullptr) {
-        return false;
+        return nullptr;
     }
     png_infop info = png_create_info_struct(png);
     if (info == nullptr) {
         png_destroy_read_struct(&png, &info, nullptr);
-        return false;
+        return nullptr;
     }
     FILE* infile = fopen(src, "rb");
     if (infile == nullptr) {
         GRAPHIC_LOGE("can't open %s\n", src);
         png_destroy_read_struct(&png, &info, nullptr);
-        return false;
+        return nullptr;
+    }
+    /* libpng jumps here on a corrupt file instead of aborting */
+    ImageInfo* volatile imgInfo = nullptr;
+    if (setjmp(png_jmpbuf(png))) {
+        GRAPHIC_LOGE("decode %s failed\n", src);
+        FreeDecodedImageInfo(imgInfo);
+        fclose(infile);
+        png_destroy_read_struct(&png, &info, nullptr);
+        return nullptr;
     }
     png_init_io(png, infile);
     png_read_info(png, info);
 
-    uint8_t pixelByteSize = DrawUtils::GetPxSizeByColorMode(ARGB8888) >> 3; // 3: Shift right 3 bits
     uint16_t width = png_get_image_width(png, info);
     uint16_t height = png_get_image_height(png, info);
     uint8_t colorType = png_get_color_type(png, info);
     uint8_t bitDepth = png_get_bit_depth(png, info);
-    uint32_t dataSize = height * width * pixelByteSize;
 
     if ((colorType == PNG_COLOR_TYPE_GRAY) && (bitDepth < 8)) { // 8: Expand grayscale images to the full 8 bits
         png_set_expand_gray_1_2_4_to_8(png);
@@ -343,114 +539,150 @@ bool Image::SetPNGSrc(const char* src)
     if (!(colorType & PNG_COLOR_MASK_ALPHA)) {
         png_set_add_alpha(png, 0xFF, PNG_FILLER_AFTER);
     }
-    png_set_interlace_handling(png);
+    /* let libpng output B, G, R, A directly, which is the memory layout of ARGB8888 */
+    png_set_bgr(png);
+    int32_t passes = png_set_interlace_handling(png);
     png_read_update_info(png, info);
 
-    rowPointer = MallocPngBytep(height, png_get_rowbytes(png, info));
-    if (rowPointer == nullptr) {
+    shift = GetDecodeShift(width, height, size);
+    uint8_t* srcData = nullptr;
+    imgInfo = (width == 0 || height == 0) ? nullptr :
+        CreateDecodedImageInfo(((width - 1) >> shift) + 1, ((height - 1) >> shift) + 1, srcData);
+    if (imgInfo == nullptr) {
         fclose(infile);
         png_destroy_read_struct(&png, &info, nullptr);
-        return false;
+        return nullptr;
     }
 
-    png_read_image(png, rowPointer);
-    fclose(infile);
-    png_destroy_read_struct(&png, &info, nullptr);
-
-    ImageInfo* imgInfo = static_cast<ImageInfo*>(UIMalloc(sizeof(ImageInfo)));
-    if (imgInfo == nullptr) {
-        FreePngBytep(&rowPointer, height);
-        return false;
-    }
-    uint8_t* srcData = static_cast<uint8_t*>(UIMalloc(dataSize));
-    if (srcData == nullptr) {
-        FreePngBytep(&rowPointer, height);
-        UIFree(imgInfo);
-        return false;
-    }
-    uint32_t n = 0;
-    for (uint16_t y = 0; y < height; y++) {
-        png_bytep row = rowPointer[y];
-        for (uint16_t x = 0; x < width * pixelByteSize; x += pixelByteSize) {
-            srcData[n++] = row[x + 2]; // 2: B channel
-            srcData[n++] = row[x + 1]; // 1: G channel
-            srcData[n++] = row[x + 0]; // 0: R channel
-            srcData[n++] = row[x + 3]; // 3: Alpha channel
+    if (shift > 0) {
+        if (!ReadPNGScaled(png, passes, width, height, shift, srcData)) {
+            FreeDecodedImageInfo(imgInfo);
+            fclose(infile);
+            png_destroy_read_struct(&png, &info, nullptr);
+            return nullptr;
+        }
+    } else {
+        /* decode every row straight into the contiguous pixel buffer, interlaced images need one walk per pass */
+        uint32_t rowBytes = imgInfo->dataSize / height;
+        for (int32_t pass = 0; pass < passes; pass++) {
+            png_bytep row = srcData;
+            for (uint16_t y = 0; y < height; y++) {
+                png_read_row(png, row, nullptr);
+                row += rowBytes;
+            }
         }
     }
-    FreePngBytep(&rowPointer, height);
+    png_read_end(png, nullptr);
+    fclose(infile);
+    png_destroy_read_struct(&png, &info, nullptr);
+    return imgInfo;
+}
 
-    imgInfo->header.width = width;
-    imgInfo->header.height = height;
-    imgInfo->header.colorMode = ARGB8888;
-    imgInfo->dataSize = dataSize;
-    imgInfo->data = srcData;
+struct JPEGErrorMgr {
+    struct jpeg_error_mgr pub;
+    jmp_buf jmp;
+};
 
-    ReInitImageInfo(imgInfo, true);
-    srcType_ = IMG_SRC_VARIABLE;
-    return true;
+/* the default error exit of libjpeg ends the process, jump back to the decoder instead */
+static void JPEGErrorExit(j_common_ptr cinfo)
+{
+    longjmp(reinterpret_cast<JPEGErrorMgr*>(cinfo->err)->jmp, 1);
 }
 
-bool Image::SetJPEGSrc(const char* src)
+ImageInfo* Image::DecodeJPEG(const char* src, const DecodeSize& size, uint8_t& shift)
 {
-    struct jpeg_decompress_struct cinfo;
-    struct jpeg_error_mgr jerr;
-    srcType_ = IMG_SRC_UNKNOWN;
+    UI_RENDER_TRACE_SCOPE("DecodeJPEG");
+    struct jpeg_decompress_struct cinfo = {};
+    JPEGErrorMgr jerr;
 
     FILE* infile = fopen(src, "rb");
     if (infile == nullptr) {
         GRAPHIC_LOGE("can't open %s\n", src);
-        return false;
+        return nullptr;
+    }
+    cinfo.err = jpeg_std_error(&jerr.pub);
+    jerr.pub.error_exit = JPEGErrorExit;
+    ImageInfo* volatile imgInfo = nullptr;
+    if (setjmp(jerr.jmp)) {
+        GRAPHIC_LOGE("decode %s failed\n", src);
+        FreeDecodedImageInfo(imgInfo);
+        jpeg_destroy_decompress(&cinfo);
+        fclose(infile);
+        return nullptr;
     }
-    cinfo.err = jpeg_std_error(&jerr);
     jpeg_create_decompress(&cinfo);
     jpeg_stdio_src(&cinfo, infile);
     jpeg_read_header(&cinfo, TRUE);
+    /* let the IDCT output the reduced size directly, which also skips most of the decoding work */
+    shift = GetDecodeShift(cinfo.image_width, cinfo.image_height, size);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1 << shift;
+#ifdef JCS_EXTENSIONS
+    /* libjpeg-turbo converts to B, G, R, A with an opaque alpha channel on its own */
+    cinfo.out_color_space = JCS_EXT_BGRA;
+#else
+    cinfo.out_color_space = JCS_RGB;
+#endif
     jpeg_start_decompress(&cinfo);
 
-    uint8_t pixelByteSize = DrawUtils::GetPxSizeByColorMode(ARGB8888) >> 3; // 3: Shift right 3 bits
     uint16_t width = cinfo.output_width;
     uint16_t height = cinfo.output_height;
-    uint32_t dataSize = width * height * pixelByteSize;
-    uint16_t rowStride = cinfo.output_width * pixelByteSize;
-    JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)(reinterpret_cast<j_common_ptr>(&cinfo), JPOOL_IMAGE, rowStride,
-                                                   1); // 1: one-row-high array
-    ImageInfo* imgInfo = static_cast<ImageInfo*>(UIMalloc(sizeof(ImageInfo)));
+    uint8_t* srcData = nullptr;
+    imgInfo = CreateDecodedImageInfo(width, height, srcData);
     if (imgInfo == nullptr) {
-        jpeg_finish_decompress(&cinfo);
-        jpeg_destroy_decompress(&cinfo);
-        fclose(infile);
-        return false;
-    }
-    uint8_t* srcData = static_cast<uint8_t*>(UIMalloc(dataSize));
-    if (srcData == nullptr) {
-        jpeg_finish_decompress(&cinfo);
+        jpeg_abort_decompress(&cinfo);
         jpeg_destroy_decompress(&cinfo);
         fclose(infile);
-        UIFree(imgInfo);
-        return false;
+        return nullptr;
     }
-    uint32_t n = 0;
+
+    uint32_t rowBytes = imgInfo->dataSize / height;
     while (cinfo.output_scanline < cinfo.output_height) {
-        jpeg_read_scanlines(&cinfo, buffer, 1);       // 1: read one line each time
-        for (uint16_t x = 0; x < width * 3; x += 3) { // 3: color components per pixel
-            srcData[n++] = buffer[0][x + 2];          // 2: B channel
-            srcData[n++] = buffer[0][x + 1];          // 1: G channel
-            srcData[n++] = buffer[0][x + 0];          // 0: R channel
-            srcData[n++] = 255;                       // 255: set alpha channel
+        JSAMPROW row = srcData + cinfo.output_scanline * rowBytes;
+        jpeg_read_scanlines(&cinfo, &row, 1); // 1: read one line each time
+#ifndef JCS_EXTENSIONS
+        /* expand R, G, B to B, G, R, A in place, from the end of the row so no pixel is overwritten early */
+        for (int32_t x = width - 1; x >= 0; x--) {
+            uint8_t r = row[x * 3 + 0];         // 3: color components per pixel, 0: R channel
+            uint8_t g = row[x * 3 + 1];         // 3: color components per pixel, 1: G channel
+            uint8_t b = row[x * 3 + 2];         // 3: color components per pixel, 2: B channel
+            row[(x << 2) + 0] = b;              // 2: 4 bytes per pixel, 0: B channel
+            row[(x << 2) + 1] = g;              // 2: 4 bytes per pixel, 1: G channel
+            row[(x << 2) + 2] = r;              // 2: 4 bytes per pixel, 2: R channel
+            row[(x << 2) + 3] = OPA_OPAQUE;     // 2: 4 bytes per pixel, 3: alpha channel
         }
+#endif
     }
     jpeg_finish_decompress(&cinfo);
     jpeg_destroy_decompress(&cinfo);
     fclose(infile);
+    return imgInfo;
+}
 
-    imgInfo->header.width = width;
-    imgInfo->header.height = height;
-    imgInfo->header.colorMode = ARGB8888;
-    imgInfo->dataSize = dataSize;
-    imgInfo->data = srcData;
+bool Image::SetPNGSrc(const char* src)
+{
+    srcType_ = IMG_SRC_UNKNOWN;
+    uint8_t shift = 0;
+    ImageInfo* imgInfo = DecodePNG(src, decodeSize_, shift);
+    if (imgInfo == nullptr) {
+        return false;
+    }
+    ReInitImageInfo(imgInfo, true);
+    decodeShift_ = shift;
+    srcType_ = IMG_SRC_VARIABLE;
+    return true;
+}
 
+bool Image::SetJPEGSrc(const char* src)
+{
+    srcType_ = IMG_SRC_UNKNOWN;
+    uint8_t shift = 0;
+    ImageInfo* imgInfo = DecodeJPEG(src, decodeSize_, shift);
+    if (imgInfo == nullptr) {
+        return false;
+    }
     ReInitImageInfo(imgInfo, true);
+    decodeShift_ = shift;
     srcType_ = IMG_SRC_VARIABLE;
     return true;
 }
@@ -464,8 +696,13 @@ void Image::ReInitImageInfo(ImageInfo* imgInfo, bool mallocFlag)
         }
     }
     UIFree(reinterpret_cast<void*>(const_cast<ImageInfo*>(imageInfo_)));
+    if (mipmap_ != nullptr) {
+        delete mipmap_;
+        mipmap_ = nullptr;
+    }
 
     imageInfo_ = imgInfo;
     mallocFlag_ = mallocFlag;
+    decodeShift_ = 0;
 }
 } // namespace OHOS
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/style_pool.h"
+#include "gfx_utils/graphic_log.h"
+
+namespace OHOS {
+namespace {
+constexpr uint32_t FNV32_OFFSET_BASIS = 2166136261U;
+constexpr uint32_t FNV32_PRIME = 16777619U;
+constexpr uint8_t FIELD_NUM = 25;
+
+/* the fields of Style, in the order they are compared */
+void GetFields(const Style& style, int64_t (&fields)[FIELD_NUM])
+{
+    uint8_t i = 0;
+    fields[i++] = style.bgColor_.full;
+    fields[i++] = style.bgOpa_;
+    fields[i++] = style.borderRadius_;
+    fields[i++] = style.borderColor_.full;
+    fields[i++] = style.borderOpa_;
+    fields[i++] = style.borderWidth_;
+    fields[i++] = style.paddingLeft_;
+    fields[i++] = style.paddingRight_;
+    fields[i++] = style.paddingTop_;
+    fields[i++] = style.paddingBottom_;
+    fields[i++] = style.marginLeft_;
+    fields[i++] = style.marginRight_;
+    fields[i++] = style.marginTop_;
+    fields[i++] = style.marginBottom_;
+    fields[i++] = style.imageOpa_;
+    fields[i++] = style.textColor_.full;
+    fields[i++] = style.font_;
+    fields[i++] = style.letterSpace_;
+    fields[i++] = style.lineSpace_;
+    fields[i++] = style.lineHeight_;
+    fields[i++] = style.textOpa_;
+    fields[i++] = style.lineColor_.full;
+    fields[i++] = style.lineWidth_;
+    fields[i++] = style.lineOpa_;
+    fields[i++] = style.lineCap_;
+}
+} // namespace
+
+StylePool* StylePool::GetInstance()
+{
+    /* never destroyed, so the static views destroyed at exit can still release their styles */
+    static StylePool* instance = new StylePool();
+    return instance;
+}
+
+uint32_t StylePool::GetHash(const Style& style)
+{
+    int64_t fields[FIELD_NUM];
+    GetFields(style, fields);
+    uint32_t hash = FNV32_OFFSET_BASIS;
+    for (uint8_t i = 0; i < FIELD_NUM; i++) {
+        uint64_t value = static_cast<uint64_t>(fields[i]);
+        // 8: hash the bytes of the field
+        for (uint8_t byte = 0; byte < sizeof(value); byte++) {
+            hash = (hash ^ static_cast<uint8_t>(value >> (byte * 8))) * FNV32_PRIME;
+        }
+    }
+    return hash;
+}
+
+bool StylePool::IsEqual(const Style& style1, const Style& style2)
+{
+    int64_t fields1[FIELD_NUM];
+    int64_t fields2[FIELD_NUM];
+    GetFields(style1, fields1);
+    GetFields(style2, fields2);
+    for (uint8_t i = 0; i < FIELD_NUM; i++) {
+        if (fields1[i] != fields2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+StylePool::Entry* StylePool::Find(const Style& style, uint32_t hash) const
+{
+    auto iter = entries_.find(hash);
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    for (Entry* entry = iter->second; entry != nullptr; entry = entry->next) {
+        if (IsEqual(entry->style, style)) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+StylePool::Entry* StylePool::FindEntry(const Style* style) const
+{
+    auto iter = entries_.find(GetHash(*style));
+    if (iter == entries_.end()) {
+        return nullptr;
+    }
+    for (Entry* entry = iter->second; entry != nullptr; entry = entry->next) {
+        if (&entry->style == style) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+void StylePool::Link(Entry* entry)
+{
+    auto iter = entries_.find(entry->hash);
+    if (iter == entries_.end()) {
+        entry->next = nullptr;
+        entries_[entry->hash] = entry;
+    } else {
+        entry->next = iter->second;
+        iter->second = entry;
+    }
+}
+
+void StylePool::Unlink(Entry* entry)
+{
+    auto iter = entries_.find(entry->hash);
+    if (iter == entries_.end()) {
+        return;
+    }
+    Entry** prev = &iter->second;
+    while ((*prev != nullptr) && (*prev != entry)) {
+        prev = &(*prev)->next;
+    }
+    if (*prev != nullptr) {
+        *prev = entry->next;
+    }
+    if (iter->second == nullptr) {
+        entries_.erase(iter);
+    }
+    entry->next = nullptr;
+}
+
+const Style* StylePool::Acquire(const Style& style)
+{
+    uint32_t hash = GetHash(style);
+    Entry* entry = Find(style, hash);
+    if (entry != nullptr) {
+        entry->refCount++;
+        refNum_++;
+        return &entry->style;
+    }
+    entry = new Entry(style);
+    if (entry == nullptr) {
+        GRAPHIC_LOGE("StylePool::Acquire new Entry fail");
+        return nullptr;
+    }
+    entry->hash = hash;
+    Link(entry);
+    styleNum_++;
+    refNum_++;
+    return &entry->style;
+}
+
+const Style* StylePool::Update(const Style* style, uint8_t key, int64_t value)
+{
+    Entry* entry = (style != nullptr) ? FindEntry(style) : nullptr;
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    if (entry->refCount > 1) {
+        /* copy on write, the others keep the old style */
+        Style newStyle(entry->style);
+        newStyle.SetStyle(key, value);
+        const Style* ret = Acquire(newStyle);
+        if (ret != nullptr) {
+            Release(style);
+        }
+        return ret;
+    }
+
+    /* the only user changes it in place, unless the changed style is pooled already */
+    Unlink(entry);
+    entry->style.SetStyle(key, value);
+    entry->hash = GetHash(entry->style);
+    Entry* same = Find(entry->style, entry->hash);
+    if (same == nullptr) {
+        Link(entry);
+        return &entry->style;
+    }
+    delete entry;
+    styleNum_--;
+    same->refCount++;
+    return &same->style;
+}
+
+void StylePool::Release(const Style* style)
+{
+    Entry* entry = (style != nullptr) ? FindEntry(style) : nullptr;
+    if (entry == nullptr) {
+        return;
+    }
+    refNum_--;
+    entry->refCount--;
+    if (entry->refCount == 0) {
+        Unlink(entry);
+        delete entry;
+        styleNum_--;
+    }
+}
+
+StylePool::MemoryReport StylePool::GetMemoryReport() const
+{
+    MemoryReport report;
+    report.styleNum = styleNum_;
+    report.refNum = refNum_;
+    report.usedBytes = styleNum_ * sizeof(Entry);
+    report.savedBytes = static_cast<int32_t>(refNum_ * sizeof(Style)) - static_cast<int32_t>(report.usedBytes);
+    return report;
+}
+} // namespace OHOS
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_STYLE_POOL_H
+#define GRAPHIC_LITE_STYLE_POOL_H
+
+#include <map>
+#include "gfx_utils/heap_base.h"
+#include "gfx_utils/style.h"
+
+namespace OHOS {
+/*
+ * Keeps one immutable copy of each distinct style used by the views and counts its references. A view which
+ * changes one key of its style gets the pooled style with that key changed instead of a private copy, so views
+ * which look the same share one style. The styles are only used on the UI thread.
+ */
+class StylePool : public HeapBase {
+public:
+    struct MemoryReport {
+        uint32_t styleNum; // distinct styles in the pool
+        uint32_t refNum;   // references to them, one for each view using a pooled style
+        uint32_t usedBytes;
+        int32_t savedBytes; // against a private copy for each reference, negative if few styles are shared
+    };
+
+    static StylePool* GetInstance();
+
+    /* Returns the pooled style equal to style, the caller releases it when done. */
+    const Style* Acquire(const Style& style);
+
+    /*
+     * Returns the pooled style equal to style with key set to value, and releases style, which must be a pooled
+     * style. The style is changed in place when nobody else uses it.
+     */
+    const Style* Update(const Style* style, uint8_t key, int64_t value);
+
+    void Release(const Style* style);
+
+    MemoryReport GetMemoryReport() const;
+
+private:
+    struct Entry : public HeapBase {
+        explicit Entry(const Style& value) : style(value), hash(0), refCount(1), next(nullptr) {}
+
+        Style style;
+        uint32_t hash;
+        uint32_t refCount;
+        Entry* next; // next entry with the same hash
+    };
+
+    StylePool() : styleNum_(0), refNum_(0) {}
+    ~StylePool() {}
+
+    StylePool(const StylePool&) = delete;
+    StylePool& operator=(const StylePool&) = delete;
+    StylePool(StylePool&&) = delete;
+    StylePool& operator=(StylePool&&) = delete;
+
+    static uint32_t GetHash(const Style& style);
+    static bool IsEqual(const Style& style1, const Style& style2);
+    Entry* Find(const Style& style, uint32_t hash) const;
+    Entry* FindEntry(const Style* style) const;
+    void Link(Entry* entry);
+    void Unlink(Entry* entry);
+
+    std::map<uint32_t, Entry*> entries_;
+    uint32_t styleNum_;
+    uint32_t refNum_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_STYLE_POOL_H
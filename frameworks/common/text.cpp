@@ -14,6 +14,7 @@
  */
 
 #include "common/text.h"
+#include "common/decoded_text.h"
 #include "common/typed_text.h"
 #include "draw/draw_label.h"
 #include "font/ui_font.h"
@@ -37,6 +38,7 @@ Text::Text()
       direct_(TEXT_DIRECT_LTR),
       sizeSpans_(nullptr),
       characterSize_(0),
+      decodedText_(nullptr),
       horizontalAlign_(TEXT_ALIGNMENT_LEFT),
       verticalAlign_(TEXT_ALIGNMENT_TOP)
 {
@@ -71,6 +73,10 @@ Text::~Text()
         UIFree(sizeSpans_);
         sizeSpans_ = nullptr;
     }
+    if (decodedText_ != nullptr) {
+        delete decodedText_;
+        decodedText_ = nullptr;
+    }
 }
 
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
@@ -84,7 +90,7 @@ void Text::SetSpannableString(const SpannableString* spannableString)
     if (spannableString->spanList_.IsEmpty()) {
         return;
     }
-    uint32_t textLen = TypedText::GetUTF8CharacterSize(text_, GetTextStrLen());
+    uint32_t textLen = GetLetterNum();
     if (textLen == 0 || textLen > MAX_TEXT_LENGTH) {
         return;
     }
@@ -130,6 +136,13 @@ void Text::SetText(const char* text)
         text_ = nullptr;
         return;
     }
+    if (decodedText_ == nullptr) {
+        decodedText_ = new DecodedText();
+    }
+    if (decodedText_ != nullptr) {
+        /* an empty text or one failing to decode is decoded on every pass as before */
+        decodedText_->Build(text_, textLen);
+    }
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     if (textStyles_ != nullptr) {
         UIFree(textStyles_);
@@ -225,6 +238,23 @@ void Text::SetFontId(uint16_t fontId)
     }
 }
 
+DecodedText* Text::GetDecodedText() const
+{
+    if ((decodedText_ == nullptr) || (text_ == nullptr) || (decodedText_->GetText() != text_)) {
+        return nullptr;
+    }
+    return decodedText_;
+}
+
+uint32_t Text::GetLetterNum()
+{
+    DecodedText* decodedText = GetDecodedText();
+    if (decodedText != nullptr) {
+        return decodedText->GetLetterNum();
+    }
+    return TypedText::GetUTF8CharacterSize(text_, GetTextStrLen());
+}
+
 void Text::ReMeasureTextSize(const Rect& textRect, const Style& style)
 {
     if (fontSize_ == 0) {
@@ -233,7 +263,7 @@ void Text::ReMeasureTextSize(const Rect& textRect, const Style& style)
     int16_t maxWidth = (expandWidth_ ? COORD_MAX : textRect.GetWidth());
     if (maxWidth > 0) {
         textSize_ = TypedText::GetTextSize(text_, fontId_, fontSize_, style.letterSpace_, style.lineHeight_, maxWidth,
-                                           style.lineSpace_, sizeSpans_);
+                                           style.lineSpace_, sizeSpans_, GetDecodedText());
         if (baseLine_) {
             FontHeader head;
             if (UIFont::GetInstance()->GetFontHeader(head, fontId_, fontSize_) != 0) {
@@ -260,6 +290,7 @@ void Text::DrawEllipsis(BufferInfo& gfxDstBuffer, LabelLineInfo& labelLine, uint
 {
     labelLine.offset.x = 0;
     labelLine.text = TEXT_ELLIPSIS;
+    labelLine.codePoints = nullptr;
     labelLine.lineLength = 1;
     labelLine.length = 1;
     DrawLabel::DrawTextOneLine(gfxDstBuffer, labelLine, letterIndex);
@@ -318,6 +349,7 @@ void Text::Draw(BufferInfo& gfxDstBuffer,
         pos.y = TextPositionY(coords, (lineCount * lineHeight - style.lineSpace_));
     }
     OpacityType opa = DrawUtils::GetMixOpacity(opaScale, style.textOpa_);
+    DecodedText* decodedText = GetDecodedText();
     uint16_t letterIndex = 0;
     for (uint16_t i = 0; i < lineCount; i++) {
         if (pos.y > mask.GetBottom()) {
@@ -330,10 +362,17 @@ void Text::Draw(BufferInfo& gfxDstBuffer,
         int16_t tempLetterIndex = letterIndex;
         if (nextLine >= mask.GetTop()) {
             pos.x = LineStartPos(coords, textLine_[i].linePixelWidth);
+            const uint32_t* codePoints = nullptr;
+            uint16_t codePointNum = 0;
+            if (decodedText != nullptr) {
+                uint16_t firstLetter = decodedText->GetLetterIndex(lineBegin);
+                codePoints = decodedText->GetCodePoints() + firstLetter;
+                codePointNum = decodedText->GetLetterIndex(lineBegin + textLine_[i].lineBytes) - firstLetter;
+            }
             LabelLineInfo labelLine{pos, offset, mask, curLineHeight, textLine_[i].lineBytes,
                                     0, opa, style, &text_[lineBegin], textLine_[i].lineBytes,
                                     lineBegin, fontId_, fontSize_, 0, static_cast<UITextLanguageDirect>(direct_),
-                                    nullptr, baseLine_,
+                                    codePoints, codePointNum, baseLine_,
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
                                     textStyles_,
 #endif
@@ -344,6 +383,8 @@ void Text::Draw(BufferInfo& gfxDstBuffer,
                 labelLine.ellipsisOssetY = ellipsisOssetY;
                 DrawEllipsis(gfxDstBuffer, labelLine, letterIndex);
             }
+        } else if (decodedText != nullptr) {
+            letterIndex = decodedText->GetLetterIndex(lineBegin + textLine_[i].lineBytes);
         } else {
             letterIndex = TypedText::GetUTF8CharacterSize(text_, lineBegin + textLine_[i].lineBytes);
         }
@@ -449,9 +490,17 @@ uint32_t Text::GetTextLine(uint32_t begin, uint32_t textLen, int16_t width, uint
 {
     int16_t lineWidth = width;
     int16_t lineHeight = 0;
-    uint16_t nextLineBytes = UIFontAdaptor::GetNextLineAndWidth(&text_[begin], fontId_, fontSize_, letterSpace,
-                                                                lineWidth, lineHeight, letterIndex, sizeSpans, false,
-                                                                textLen - begin);
+    uint16_t nextLineBytes;
+    DecodedText* decodedText = GetDecodedText();
+    if (decodedText != nullptr) {
+        nextLineBytes = UIFontAdaptor::GetNextLineAndWidth(*decodedText, begin, fontId_, fontSize_, letterSpace,
+                                                           lineWidth, lineHeight, letterIndex, sizeSpans, false,
+                                                           textLen - begin);
+    } else {
+        nextLineBytes = UIFontAdaptor::GetNextLineAndWidth(&text_[begin], fontId_, fontSize_, letterSpace, lineWidth,
+                                                           lineHeight, letterIndex, sizeSpans, false,
+                                                           textLen - begin);
+    }
     if (nextLineBytes + begin > textLen) {
         nextLineBytes = textLen - begin;
     }
@@ -502,13 +551,21 @@ uint16_t Text::GetLetterIndexByPosition(const Rect& textRect, const Style& style
         height = lineHeight;
     }
     int16_t y = 0;
-    uint32_t textLen = static_cast<uint32_t>(strlen(text_));
+    DecodedText* decodedText = GetDecodedText();
+    uint32_t textLen = (decodedText != nullptr) ? decodedText->GetByteNum() : static_cast<uint32_t>(strlen(text_));
     int16_t width = 0;
     uint16_t letterIndex = 0;
     while ((lineStart < textLen) && (text_[lineStart] != '\0')) {
         width = textRect.GetWidth();
-        nextLineStart += UIFontAdaptor::GetNextLineAndWidth(&text_[lineStart], fontId_, fontSize_, style.letterSpace_,
-                                                            width, lineHeight, letterIndex, sizeSpans_);
+        if (decodedText != nullptr) {
+            nextLineStart += UIFontAdaptor::GetNextLineAndWidth(*decodedText, lineStart, fontId_, fontSize_,
+                                                                style.letterSpace_, width, lineHeight, letterIndex,
+                                                                sizeSpans_);
+        } else {
+            nextLineStart += UIFontAdaptor::GetNextLineAndWidth(&text_[lineStart], fontId_, fontSize_,
+                                                                style.letterSpace_, width, lineHeight, letterIndex,
+                                                                sizeSpans_);
+        }
         if (nextLineStart == 0) {
             break;
         }
@@ -523,9 +580,14 @@ uint16_t Text::GetLetterIndexByPosition(const Rect& textRect, const Style& style
     }
     /* Calculate the x coordinate */
     width = pos.x;
-    lineStart +=
-        UIFontAdaptor::GetNextLineAndWidth(&text_[lineStart], fontId_, fontSize_, style.letterSpace_, width, lineHeight,
-                                           letterIndex, sizeSpans_, true);
+    if (decodedText != nullptr) {
+        lineStart += UIFontAdaptor::GetNextLineAndWidth(*decodedText, lineStart, fontId_, fontSize_,
+                                                        style.letterSpace_, width, lineHeight, letterIndex, sizeSpans_,
+                                                        true);
+    } else {
+        lineStart += UIFontAdaptor::GetNextLineAndWidth(&text_[lineStart], fontId_, fontSize_, style.letterSpace_,
+                                                        width, lineHeight, letterIndex, sizeSpans_, true);
+    }
     return (lineStart < textLen) ? lineStart : TEXT_ELLIPSIS_END_INV;
 }
 
@@ -547,7 +609,7 @@ void Text::SetAbsoluteSizeSpan(uint16_t start, uint16_t end, uint8_t size)
     }
 #endif
     if (text_ != nullptr && sizeSpans_ == nullptr) {
-        characterSize_ = TypedText::GetUTF8CharacterSize(text_, GetTextStrLen());
+        characterSize_ = GetLetterNum();
         sizeSpans_ = static_cast<SizeSpan*>(UIMalloc(characterSize_ * sizeof(SizeSpan)));
         if (sizeSpans_ == nullptr) {
             GRAPHIC_LOGE("Text::SetAbsoluteSizeSpan invalid parameter");
@@ -608,7 +670,8 @@ uint16_t Text::GetSpanFontIdBySize(uint8_t size)
 void Text::InitSizeSpans()
 {
     if (sizeSpans_ != nullptr) {
-        for (uint32_t i = 0 ; i < TypedText::GetUTF8CharacterSize(text_, GetTextStrLen()); i++) {
+        uint32_t letterNum = GetLetterNum();
+        for (uint32_t i = 0; i < letterNum; i++) {
             sizeSpans_[i].isSizeSpan = false;
             sizeSpans_[i].height = 0;
         }
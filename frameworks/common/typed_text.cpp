@@ -14,6 +14,7 @@
  */
 
 #include "common/typed_text.h"
+#include "common/decoded_text.h"
 #include "font/ui_font.h"
 #include "font/ui_font_adaptor.h"
 #include "gfx_utils/graphic_log.h"
@@ -26,7 +27,8 @@
 namespace OHOS {
 #ifndef _FONT_TOOL
 Point TypedText::GetTextSize(const char* text, uint16_t fontId, uint8_t fontSize, int16_t letterSpace,
-                             int16_t lineHeight, int16_t maxWidth, int8_t lineSpace, SizeSpan* sizeSpans)
+                             int16_t lineHeight, int16_t maxWidth, int8_t lineSpace, SizeSpan* sizeSpans,
+                             DecodedText* decodedText)
 {
     Point size{0, 0};
 
@@ -44,8 +46,13 @@ Point TypedText::GetTextSize(const char* text, uint16_t fontId, uint8_t fontSize
     int16_t curLetterHeight = 0;
     while (text[lineBegin] != '\0') {
         int16_t lineWidth = maxWidth;
-        newLineBegin += UIFontAdaptor::GetNextLineAndWidth(&text[lineBegin], fontId, fontSize, letterSpace, lineWidth,
-                                                           curLetterHeight, letterIndex, sizeSpans);
+        if (decodedText != nullptr) {
+            newLineBegin += UIFontAdaptor::GetNextLineAndWidth(*decodedText, lineBegin, fontId, fontSize, letterSpace,
+                                                               lineWidth, curLetterHeight, letterIndex, sizeSpans);
+        } else {
+            newLineBegin += UIFontAdaptor::GetNextLineAndWidth(&text[lineBegin], fontId, fontSize, letterSpace,
+                                                               lineWidth, curLetterHeight, letterIndex, sizeSpans);
+        }
         if (!hasLineHeight) {
             curLineHeight = curLetterHeight + lineSpace;
         } else {
@@ -287,6 +294,33 @@ int16_t TypedText::GetTextWidth(const char* text, uint16_t fontId, uint8_t fontS
     }
     return width;
 }
+
+int16_t TypedText::GetTextWidth(DecodedText& text, uint32_t begin, uint16_t fontId, uint8_t fontSize,
+                                uint16_t length, int16_t letterSpace)
+{
+    if ((length == 0) || (begin + length > text.GetByteNum())) {
+        GRAPHIC_LOGE("TypedText::GetTextWidth invalid parameter\n");
+        return 0;
+    }
+    const uint16_t* widths = text.GetWidths(fontId, fontSize);
+    if (widths == nullptr) {
+        return GetTextWidth(text.GetText() + begin, fontId, fontSize, length, letterSpace);
+    }
+    const uint32_t* codePoints = text.GetCodePoints();
+    uint16_t end = text.GetLetterIndex(begin + length);
+    uint16_t width = 0;
+    for (uint16_t i = text.GetLetterIndex(begin); i < end; i++) {
+        uint32_t letter = codePoints[i];
+        if ((letter == 0) || (letter == '\n') || (letter == '\r')) {
+            continue;
+        }
+        width += widths[i] + letterSpace;
+    }
+    if (width > 0) {
+        width -= letterSpace;
+    }
+    return width;
+}
 #endif // _FONT_TOOL
 
 uint8_t TypedText::GetUTF8OneCharacterSize(const char* str)
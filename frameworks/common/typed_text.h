@@ -25,6 +25,8 @@
 
 namespace OHOS {
 #ifndef _FONT_TOOL
+class DecodedText;
+
 class TypedText : public HeapBase {
 public:
     static constexpr uint32_t MAX_UINT16_LOW_SCOPE = 0xFFFF;
@@ -46,7 +48,8 @@ public:
                              int16_t lineHeight,
                              int16_t maxWidth,
                              int8_t lineSpace,
-                             SizeSpan* sizeSpans = nullptr);
+                             SizeSpan* sizeSpans = nullptr,
+                             DecodedText* decodedText = nullptr);
 
     static uint32_t GetNextLine(const char* text,
                                 uint16_t fontId,
@@ -60,6 +63,14 @@ public:
                                 uint16_t length,
                                 int16_t letterSpace);
 
+    /* The width of the length bytes of a decoded text from begin. */
+    static int16_t GetTextWidth(DecodedText& text,
+                                uint32_t begin,
+                                uint16_t fontId,
+                                uint8_t fontSize,
+                                uint16_t length,
+                                int16_t letterSpace);
+
     static Rect GetArcTextRect(const char* text,
                                 uint16_t fontId,
                                 uint8_t fontSize,
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/ui_arena.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+
+namespace OHOS {
+namespace {
+constexpr uint32_t ALIGN = alignof(std::max_align_t);
+constexpr uint32_t MAX_ALLOC_SIZE = 0x7FFFFFFF;
+
+constexpr uint32_t AlignUp(uint32_t size)
+{
+    return (size + ALIGN - 1) & ~(ALIGN - 1);
+}
+} // namespace
+
+/* the data of a page follows it, blocks are taken from the data one after another */
+struct UIArena::Page {
+    Page* next;
+    UIArena* owner; // nullptr once the arena is destroyed
+    uint32_t size;
+    uint32_t used;
+    uint32_t liveNum;
+};
+
+namespace {
+/* put before each block, page is nullptr for the blocks allocated with UIMalloc */
+struct BlockHeader {
+    void* page;
+    uint32_t size;
+};
+
+constexpr uint32_t BLOCK_HEADER_SIZE = AlignUp(sizeof(BlockHeader));
+} // namespace
+
+UIArena* UIArena::current_ = nullptr;
+
+UIArena::UIArena(uint32_t pageSize) : pages_(nullptr), pageSize_(AlignUp(pageSize)), stats_({}) {}
+
+UIArena::~UIArena()
+{
+    if (current_ == this) {
+        current_ = nullptr;
+    }
+    if (stats_.liveNum > 0) {
+        GRAPHIC_LOGE("UIArena destroyed with %u objects alive", stats_.liveNum);
+    }
+    Page* page = pages_;
+    while (page != nullptr) {
+        Page* next = page->next;
+        if (page->liveNum == 0) {
+            UIFree(page);
+        } else {
+            /* freed by Free when its last object is deleted */
+            page->owner = nullptr;
+        }
+        page = next;
+    }
+    pages_ = nullptr;
+}
+
+void* UIArena::Allocate(size_t size)
+{
+    if (size > MAX_ALLOC_SIZE - BLOCK_HEADER_SIZE - ALIGN) {
+        return nullptr;
+    }
+    if (current_ != nullptr) {
+        void* ptr = current_->AllocateBlock(static_cast<uint32_t>(size));
+        if (ptr != nullptr) {
+            return ptr;
+        }
+    }
+    uint8_t* block = static_cast<uint8_t*>(UIMalloc(BLOCK_HEADER_SIZE + static_cast<uint32_t>(size)));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+    header->page = nullptr;
+    header->size = static_cast<uint32_t>(size);
+    return block + BLOCK_HEADER_SIZE;
+}
+
+void UIArena::Free(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ptr) - BLOCK_HEADER_SIZE);
+    Page* page = static_cast<Page*>(header->page);
+    if (page == nullptr) {
+        UIFree(header);
+        return;
+    }
+    if (page->owner != nullptr) {
+        page->owner->FreeBlock(page, header->size);
+        return;
+    }
+    page->liveNum--;
+    if (page->liveNum == 0) {
+        UIFree(page);
+    }
+}
+
+void* UIArena::AllocateBlock(uint32_t size)
+{
+    uint32_t blockSize = BLOCK_HEADER_SIZE + AlignUp(size);
+    Page* page = GetPage(blockSize);
+    if (page == nullptr) {
+        stats_.fallbackNum++;
+        return nullptr;
+    }
+    uint8_t* block = reinterpret_cast<uint8_t*>(page) + AlignUp(sizeof(Page)) + page->used;
+    page->used += blockSize;
+    page->liveNum++;
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+    header->page = page;
+    header->size = blockSize;
+    stats_.allocNum++;
+    stats_.liveNum++;
+    stats_.usedBytes += blockSize;
+    return block + BLOCK_HEADER_SIZE;
+}
+
+UIArena::Page* UIArena::GetPage(uint32_t size)
+{
+    for (Page* page = pages_; page != nullptr; page = page->next) {
+        if (page->size - page->used >= size) {
+            return page;
+        }
+    }
+    uint32_t dataSize = (size > pageSize_) ? size : pageSize_;
+    Page* page = static_cast<Page*>(UIMalloc(AlignUp(sizeof(Page)) + dataSize));
+    if (page == nullptr) {
+        GRAPHIC_LOGE("UIArena::GetPage UIMalloc fail");
+        return nullptr;
+    }
+    page->owner = this;
+    page->size = dataSize;
+    page->used = 0;
+    page->liveNum = 0;
+    page->next = pages_;
+    pages_ = page;
+    stats_.pageNum++;
+    stats_.reservedBytes += dataSize;
+    return page;
+}
+
+void UIArena::FreeBlock(Page* page, uint32_t size)
+{
+    stats_.freeNum++;
+    stats_.liveNum--;
+    stats_.usedBytes -= size;
+    page->liveNum--;
+    if (page->liveNum == 0) {
+        /* all the objects of the page are deleted, reuse it from the start */
+        page->used = 0;
+    }
+}
+
+void UIArena::ReleaseFreePages()
+{
+    Page** prev = &pages_;
+    while (*prev != nullptr) {
+        Page* page = *prev;
+        if (page->liveNum == 0) {
+            *prev = page->next;
+            stats_.pageNum--;
+            stats_.reservedBytes -= page->size;
+            UIFree(page);
+        } else {
+            prev = &page->next;
+        }
+    }
+}
+
+UIFrameAllocator* UIFrameAllocator::GetInstance()
+{
+    static UIFrameAllocator instance;
+    return &instance;
+}
+
+void* UIFrameAllocator::Allocate(uint32_t size)
+{
+    if (size > MAX_ALLOC_SIZE - BLOCK_HEADER_SIZE - ALIGN) {
+        return nullptr;
+    }
+    uint32_t alignedSize = AlignUp(size);
+    stats_.allocNum++;
+    stats_.usedBytes += alignedSize;
+    if (stats_.usedBytes > stats_.peakBytes) {
+        stats_.peakBytes = stats_.usedBytes;
+    }
+    if ((buffer_ != nullptr) && (stats_.capacity - offset_ >= alignedSize)) {
+        uint8_t* ptr = buffer_ + offset_;
+        offset_ += alignedSize;
+        return ptr;
+    }
+
+    /* does not fit, freed on Reset, the block header keeps the buffer aligned */
+    stats_.overflowNum++;
+    uint8_t* block = static_cast<uint8_t*>(UIMalloc(BLOCK_HEADER_SIZE + alignedSize));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    Overflow* overflow = reinterpret_cast<Overflow*>(block);
+    overflow->next = overflows_;
+    overflows_ = overflow;
+    return block + BLOCK_HEADER_SIZE;
+}
+
+void UIFrameAllocator::Reset()
+{
+    stats_.frameNum++;
+    if (overflows_ != nullptr) {
+        while (overflows_ != nullptr) {
+            Overflow* next = overflows_->next;
+            UIFree(overflows_);
+            overflows_ = next;
+        }
+        /* grow the block to the size needed by this frame */
+        uint32_t capacity = (stats_.usedBytes < MAX_CAPACITY) ? stats_.usedBytes : MAX_CAPACITY;
+        if (capacity > stats_.capacity) {
+            if (buffer_ != nullptr) {
+                UIFree(buffer_);
+            }
+            buffer_ = static_cast<uint8_t*>(UIMalloc(capacity));
+            stats_.capacity = (buffer_ != nullptr) ? capacity : 0;
+        }
+    }
+    offset_ = 0;
+    stats_.usedBytes = 0;
+}
+} // namespace OHOS
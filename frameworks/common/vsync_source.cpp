@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/vsync_source.h"
+
+#include "hal_tick.h"
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <time.h>
+#endif
+
+namespace OHOS {
+namespace {
+constexpr uint32_t US_PER_MS = 1000;
+constexpr uint32_t US_PER_SECOND = 1000000;
+constexpr uint32_t NS_PER_US = 1000;
+} // namespace
+
+uint64_t VsyncSource::GetTime()
+{
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    struct timespec time;
+    if (clock_gettime(CLOCK_MONOTONIC, &time) == 0) {
+        return static_cast<uint64_t>(time.tv_sec) * US_PER_SECOND + static_cast<uint64_t>(time.tv_nsec) / NS_PER_US;
+    }
+#endif
+    return static_cast<uint64_t>(HALTick::GetInstance().GetTime()) * US_PER_MS;
+}
+
+TimerVsyncSource::TimerVsyncSource(uint32_t period)
+    : period_((period > 0) ? period : DEFAULT_PERIOD), startTime_(GetTime())
+{
+}
+
+uint64_t TimerVsyncSource::GetLastVsyncTime()
+{
+    uint64_t now = GetTime();
+    return now - (now - startTime_) % period_;
+}
+} // namespace OHOS
@@ -16,7 +16,9 @@
 #include "components/root_view.h"
 
 #include "common/screen.h"
+#include "common/ui_arena.h"
 #include "core/render_manager.h"
+#include "dfx/ui_render_trace.h"
 #include "draw/draw_utils.h"
 #include "gfx_utils/graphic_log.h"
 #if ENABLE_WINDOW
@@ -33,8 +35,82 @@ const constexpr uint8_t VIEW_STACK_DEPTH = COMPONENT_NESTING_DEPTH * 2;
 const constexpr uint8_t VIEW_STACK_DEPTH = COMPONENT_NESTING_DEPTH;
 const constexpr uint8_t MAX_INVALIDATE_SIZE = 24;
 #endif
+const constexpr uint8_t MAX_VISIBLE_PART_NUM = 8;
+const constexpr uint32_t MIN_OCCLUDER_AREA = 256; // smaller occluders cost more to subtract than they save
 static Rect g_maskStack[COMPONENT_NESTING_DEPTH];
 static UIView* g_viewStack[VIEW_STACK_DEPTH];
+
+/* Transformed views except images are drawn into the map buffer and blitted with the transform afterwards. */
+inline bool IsDrawnThroughMapBuffer(const UIView* view)
+{
+    return (view->GetViewType() != UI_IMAGE_VIEW) && (view->GetViewType() != UI_TEXTURE_MAPPER) &&
+           !view->IsTransInvalid();
+}
+
+/* Removes the occluder from the parts and returns the number of parts left. */
+uint8_t SubtractRect(Rect* parts, uint8_t partNum, const Rect& occluder)
+{
+    Rect result[MAX_VISIBLE_PART_NUM];
+    uint8_t resultNum = 0;
+    for (uint8_t i = 0; i < partNum; i++) {
+        const Rect& part = parts[i];
+        Rect common;
+        if (!common.Intersect(part, occluder)) {
+            result[resultNum++] = part;
+            continue;
+        }
+        if (occluder.IsContains(part)) {
+            continue;
+        }
+        /*
+         * +---------------+
+         * |      top      |
+         * +----+-----+----+
+         * |left|     |right
+         * +----+-----+----+
+         * |    bottom     |
+         * +---------------+
+         */
+        Rect pieces[4]; // 4: top, bottom, left and right
+        uint8_t pieceNum = 0;
+        if (common.GetTop() > part.GetTop()) {
+            pieces[pieceNum++] = Rect(part.GetLeft(), part.GetTop(), part.GetRight(), common.GetTop() - 1);
+        }
+        if (common.GetBottom() < part.GetBottom()) {
+            pieces[pieceNum++] = Rect(part.GetLeft(), common.GetBottom() + 1, part.GetRight(), part.GetBottom());
+        }
+        if (common.GetLeft() > part.GetLeft()) {
+            pieces[pieceNum++] = Rect(part.GetLeft(), common.GetTop(), common.GetLeft() - 1, common.GetBottom());
+        }
+        if (common.GetRight() < part.GetRight()) {
+            pieces[pieceNum++] = Rect(common.GetRight() + 1, common.GetTop(), part.GetRight(), common.GetBottom());
+        }
+        /* keep the part whole if the pieces would leave no room for the parts not checked yet */
+        if (resultNum + pieceNum + (partNum - i - 1) > MAX_VISIBLE_PART_NUM) {
+            result[resultNum++] = part;
+            continue;
+        }
+        for (uint8_t j = 0; j < pieceNum; j++) {
+            result[resultNum++] = pieces[j];
+        }
+    }
+    for (uint8_t i = 0; i < resultNum; i++) {
+        parts[i] = result[i];
+    }
+    return resultNum;
+}
+
+inline void DrawView(UIView* view, BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
+{
+    UI_RENDER_TRACE_VIEW_SCOPE("OnDraw", view);
+    view->OnDraw(gfxDstBuffer, invalidatedArea);
+}
+
+inline void PostDrawView(UIView* view, BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
+{
+    UI_RENDER_TRACE_VIEW_SCOPE("OnPostDraw", view);
+    view->OnPostDraw(gfxDstBuffer, invalidatedArea);
+}
 } // namespace
 RootView::RootView()
 {
@@ -478,15 +554,16 @@ void RootView::AddInvalidateRectWithLock(Rect& rect, UIView* view)
 
 void RootView::Measure()
 {
+    UI_RENDER_TRACE_SCOPE("Measure");
 #if LOCAL_RENDER
     if (!invalidateMap_.empty()) {
-        MeasureView(GetChildrenRenderHead());
-    }
 #else
     if (invalidateRects_.Size() > 0) {
+#endif
+        uint64_t startTime = VsyncSource::GetTime();
         MeasureView(GetChildrenRenderHead());
+        RenderManager::GetInstance().AddPhaseTime(RenderManager::PHASE_MEASURE, startTime);
     }
-#endif
 }
 
 void RootView::MeasureView(UIView* view)
@@ -513,6 +590,7 @@ void RootView::MeasureView(UIView* view)
 
 void RootView::Render()
 {
+    uint64_t startTime = VsyncSource::GetTime();
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_lock(&lock_);
 #endif
@@ -523,10 +601,12 @@ void RootView::Render()
     Rect flushRect(GetScreenRect());
 #if LOCAL_RENDER
     if (!invalidateMap_.empty()) {
+        overdrawStats_ = {};
         RenderManager::RenderRect(flushRect, this);
         invalidateMap_.clear();
 #else
     if (invalidateRects_.Size() > 0) {
+        overdrawStats_ = {};
         /* Fully draw whole reacts. If there are two buffers or more to display, buffers could be
         independent between each other, so buffers need to be FULLY_RENDER. */
 #if defined(FULLY_RENDER) && (FULLY_RENDER != 1)
@@ -535,7 +615,7 @@ void RootView::Render()
         // same with each others, because only delta changes write to the buffer between each frames, so it fits one
         // buffer to display.
         for (ListNode<Rect>* iter = invalidateRects_.Begin(); iter != invalidateRects_.End(); iter = iter->next_) {
-            RenderManager::RenderRect(iter->data_, this);
+            RenderDirtyRect(iter->data_);
             flushRect.Join(flushRect, iter->data_);
         }
 #else
@@ -547,14 +627,21 @@ void RootView::Render()
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
         pthread_mutex_unlock(&lock_);
 #endif
-
+        uint64_t flushTime = RenderManager::GetInstance().AddPhaseTime(RenderManager::PHASE_DRAW, startTime);
 #if ENABLE_WINDOW
-        if (boundWindow_) {
-            boundWindow_->Flush();
-            boundWindow_->Update();
+        if (composite_.composing) {
+            /* flushed by RenderManager with the other windows drawn in the frame */
+            composite_.flushRect = flushRect;
+            composite_.flushPending = true;
+        } else {
+            FlushFrame(flushRect);
+            RenderManager::GetInstance().AddPhaseTime(RenderManager::PHASE_FLUSH, flushTime);
         }
+#else
+        FlushFrame(flushRect);
+        RenderManager::GetInstance().AddPhaseTime(RenderManager::PHASE_FLUSH, flushTime);
 #endif
-        BaseGfxEngine::GetInstance()->Flush(flushRect);
+        UIFrameAllocator::GetInstance()->Reset();
     } else {
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_unlock(&lock_);
@@ -562,6 +649,153 @@ void RootView::Render()
     }
 }
 
+void RootView::FlushFrame(const Rect& flushRect)
+{
+#if ENABLE_WINDOW
+    if (boundWindow_) {
+        boundWindow_->Flush();
+        boundWindow_->Update();
+    }
+#endif
+    BaseGfxEngine::GetInstance()->Flush(flushRect);
+    if (onFlushListener_ != nullptr) {
+        onFlushListener_->OnFlush(flushRect);
+    }
+}
+
+void RootView::RenderDirtyRect(const Rect& rect)
+{
+#if ENABLE_WINDOW && !LOCAL_RENDER
+    if (composite_.composing && (composite_.occluderNum > 0)) {
+        Rect parts[MAX_VISIBLE_PART_NUM] = {rect};
+        uint8_t partNum = 1;
+        for (uint8_t i = 0; (i < composite_.occluderNum) && (partNum > 0); i++) {
+            partNum = SubtractRect(parts, partNum, composite_.occluders[i]);
+        }
+        /* only the parts not hidden by the windows above are drawn, if the hidden ones can be kept for later */
+        if (CoverRect(rect)) {
+            for (uint8_t i = 0; i < partNum; i++) {
+                RenderManager::RenderRect(parts[i], this);
+            }
+            return;
+        }
+    }
+#endif
+    RenderManager::RenderRect(rect, this);
+}
+
+#if ENABLE_WINDOW
+bool RootView::IsCoveredByWindows(const Rect& rect) const
+{
+    Rect parts[MAX_VISIBLE_PART_NUM] = {rect};
+    uint8_t partNum = 1;
+    for (uint8_t i = 0; (i < composite_.occluderNum) && (partNum > 0); i++) {
+        partNum = SubtractRect(parts, partNum, composite_.occluders[i]);
+    }
+    return partNum == 0;
+}
+
+bool RootView::BeginComposite(const Rect* occluders, uint8_t occluderNum, bool& hidden)
+{
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    pthread_mutex_lock(&lock_);
+#endif
+    composite_.occluderNum = (occluderNum < MAX_WINDOW_OCCLUDER_NUM) ? occluderNum : MAX_WINDOW_OCCLUDER_NUM;
+    for (uint8_t i = 0; i < composite_.occluderNum; i++) {
+        composite_.occluders[i] = occluders[i];
+    }
+#if LOCAL_RENDER
+    bool damaged = !invalidateMap_.empty();
+    bool visible = damaged && !IsCoveredByWindows(GetScreenRect());
+#else
+    ExposeCoveredRects();
+    bool damaged = (invalidateRects_.Size() > 0);
+    ListNode<Rect>* iter = invalidateRects_.Begin();
+    while (iter != invalidateRects_.End()) {
+        ListNode<Rect>* next = iter->next_;
+        if (IsCoveredByWindows(iter->data_) && CoverRect(iter->data_)) {
+            invalidateRects_.Remove(iter);
+        }
+        iter = next;
+    }
+    bool visible = (invalidateRects_.Size() > 0);
+#endif
+    hidden = damaged && !visible;
+    composite_.composing = visible;
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    pthread_mutex_unlock(&lock_);
+#endif
+    return visible;
+}
+
+bool RootView::FlushComposite(Rect& flushRect)
+{
+    bool flushPending = composite_.flushPending;
+    composite_.composing = false;
+    composite_.flushPending = false;
+    if (!flushPending) {
+        return false;
+    }
+    flushRect = composite_.flushRect;
+    if (boundWindow_) {
+        boundWindow_->Flush();
+        boundWindow_->Update();
+    }
+    if (onFlushListener_ != nullptr) {
+        onFlushListener_->OnFlush(flushRect);
+    }
+    return true;
+}
+
+#if !LOCAL_RENDER
+void RootView::ExposeCoveredRects()
+{
+    uint8_t coveredNum = 0;
+    for (uint8_t i = 0; i < coveredRectNum_; i++) {
+        bool covered = false;
+        for (uint8_t j = 0; (j < composite_.occluderNum) && !covered; j++) {
+            covered = composite_.occluders[j].IsContains(coveredRects_[i]);
+        }
+        if (covered) {
+            coveredRects_[coveredNum++] = coveredRects_[i];
+        } else {
+            AddInvalidateRect(coveredRects_[i], nullptr);
+        }
+    }
+    coveredRectNum_ = coveredNum;
+}
+
+bool RootView::CoverRect(const Rect& rect)
+{
+    for (uint8_t i = 0; i < composite_.occluderNum; i++) {
+        const Rect& occluder = composite_.occluders[i];
+        Rect covered;
+        if (!covered.Intersect(rect, occluder)) {
+            continue;
+        }
+        /* a covered rect grows only inside its occluder, so it stays hidden until the occluder changes */
+        bool merged = false;
+        for (uint8_t j = 0; (j < coveredRectNum_) && !merged; j++) {
+            Rect joinRect;
+            joinRect.Join(coveredRects_[j], covered);
+            if (occluder.IsContains(joinRect)) {
+                coveredRects_[j] = joinRect;
+                merged = true;
+            }
+        }
+        if (merged) {
+            continue;
+        }
+        if (coveredRectNum_ == MAX_COVERED_RECT_NUM) {
+            return false;
+        }
+        coveredRects_[coveredRectNum_++] = covered;
+    }
+    return true;
+}
+#endif
+#endif
+
 void RootView::BlitMapBuffer(Rect& curViewRect, TransformMap& transMap, const Rect& invalidatedArea)
 {
     Rect invalidRect = curViewRect;
@@ -616,6 +850,9 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
     if (view == nullptr) {
         return;
     }
+    UI_RENDER_TRACE_SCOPE("DrawTop");
+    overdrawStats_.dirtyArea += rect.GetSize();
+    CollectOccluders(view, rect);
 
     int16_t stackCount = 0;
     UIView* par = view->GetParent();
@@ -642,8 +879,7 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
         if (curView != nullptr) {
             if (curView->IsVisible()) {
                 if (curViewRect.Intersect(curView->GetMaskedRect(), mask) || enableAnimator) {
-                    if ((curView->GetViewType() != UI_IMAGE_VIEW) && (curView->GetViewType() != UI_TEXTURE_MAPPER) &&
-                        !curView->IsTransInvalid() && !enableAnimator) {
+                    if (IsDrawnThroughMapBuffer(curView) && !enableAnimator) {
                         origRect = curView->GetOrigRect();
                         relativeRect = curView->GetRelativeRect();
                         curView->GetTransformMap().SetInvalid(true);
@@ -664,10 +900,10 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
                             UpdateMapBufferInfo(invalidatedArea);
                             updateMapBufferInfo = true;
                         }
-                        curView->OnDraw(*dc_.mapBufferInfo, invalidatedArea);
+                        DrawView(curView, *dc_.mapBufferInfo, invalidatedArea);
                         curViewRect = invalidatedArea;
                     } else {
-                        curView->OnDraw(*dc_.bufferInfo, curViewRect);
+                        DrawVisibleParts(curView, curViewRect);
                     }
 
                     if ((curView->IsViewGroup()) && (stackCount < COMPONENT_NESTING_DEPTH)) {
@@ -685,9 +921,9 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
                     }
 
                     if (enableAnimator) {
-                        curView->OnPostDraw(*dc_.mapBufferInfo, curViewRect);
+                        PostDrawView(curView, *dc_.mapBufferInfo, curViewRect);
                     } else {
-                        curView->OnPostDraw(*dc_.bufferInfo, curViewRect);
+                        PostDrawView(curView, *dc_.bufferInfo, curViewRect);
                     }
 
                     if (enableAnimator && (transViewGroup == nullptr)) {
@@ -710,9 +946,9 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
             curViewRect = par->GetMaskedRect();
             mask = g_maskStack[stackCount];
             if (enableAnimator) {
-                par->OnPostDraw(*dc_.mapBufferInfo, curViewRect);
+                PostDrawView(par, *dc_.mapBufferInfo, curViewRect);
             } else if (curViewRect.Intersect(curViewRect, mask)) {
-                par->OnPostDraw(*dc_.bufferInfo, curViewRect);
+                PostDrawView(par, *dc_.bufferInfo, curViewRect);
             }
 
             if (enableAnimator && transViewGroup == g_viewStack[stackCount]) {
@@ -734,14 +970,138 @@ void RootView::DrawTop(UIView* view, const Rect& rect)
         stackCount = 0;
         curView = par->GetNextRenderSibling();
         if (enableAnimator) {
-            par->OnPostDraw(*dc_.mapBufferInfo, rect);
+            PostDrawView(par, *dc_.mapBufferInfo, rect);
         } else {
-            par->OnPostDraw(*dc_.bufferInfo, rect);
+            PostDrawView(par, *dc_.bufferInfo, rect);
+        }
+        par = par->GetParent();
+    }
+}
+
+void RootView::CollectOccluders(UIView* view, const Rect& rect)
+{
+    occluderNum_ = 0;
+    occluderCursor_ = 0;
+    if (!occlusionCullingEnabled_) {
+        return;
+    }
+    /* walks the views in the order DrawTop paints them */
+    int16_t stackCount = 0;
+    UIView* par = view->GetParent();
+    if (par == nullptr) {
+        par = view;
+    }
+    UIView* curView = view;
+    Rect curViewRect;
+    Rect mask = rect;
+    while (par != nullptr) {
+        if (curView != nullptr) {
+            if (curView->IsVisible() && curViewRect.Intersect(curView->GetMaskedRect(), mask) &&
+                !IsDrawnThroughMapBuffer(curView)) {
+                AddOccluder(curView, curViewRect);
+                if (curView->IsViewGroup() && (stackCount < COMPONENT_NESTING_DEPTH)) {
+                    par = curView;
+                    g_viewStack[stackCount] = curView;
+                    g_maskStack[stackCount] = mask;
+                    stackCount++;
+                    curView = static_cast<UIViewGroup*>(curView)->GetChildrenRenderHead();
+                    mask = par->GetContentRect();
+                    mask.Intersect(mask, curViewRect);
+                    continue;
+                }
+            }
+            curView = curView->GetNextRenderSibling();
+            continue;
+        }
+        if (--stackCount >= 0) {
+            mask = g_maskStack[stackCount];
+            curView = g_viewStack[stackCount]->GetNextRenderSibling();
+            par = par->GetParent();
+            continue;
         }
+        stackCount = 0;
+        curView = par->GetNextRenderSibling();
         par = par->GetParent();
     }
 }
 
+void RootView::AddOccluder(UIView* view, const Rect& clipRect)
+{
+    if ((view->GetStyle(STYLE_BACKGROUND_OPA) != OPA_OPAQUE) || (view->GetMixOpaScale() != OPA_OPAQUE)) {
+        return;
+    }
+    /* OnPreDraw of a round view reports the whole rect as covered */
+    if (view->GetStyle(STYLE_BORDER_RADIUS) == COORD_MAX) {
+        return;
+    }
+    Rect candidate = clipRect;
+    int16_t borderWidth = static_cast<int16_t>(view->GetStyle(STYLE_BORDER_WIDTH));
+    if ((borderWidth > 0) && (view->GetStyle(STYLE_BORDER_OPA) != OPA_OPAQUE)) {
+        /* the views below show through a translucent border */
+        Rect inner = view->GetRect();
+        inner.SetLeft(inner.GetLeft() + borderWidth);
+        inner.SetTop(inner.GetTop() + borderWidth);
+        inner.SetRight(inner.GetRight() - borderWidth);
+        inner.SetBottom(inner.GetBottom() - borderWidth);
+        if (!candidate.Intersect(candidate, inner)) {
+            return;
+        }
+    }
+    /* OnPreDraw shrinks the rect to the opaque inner rect, or leaves it alone if the view can not tell */
+    Rect opaqueRect = candidate;
+    if (!view->OnPreDraw(opaqueRect) &&
+        ((opaqueRect.GetSize() == candidate.GetSize()) || !opaqueRect.Intersect(opaqueRect, candidate))) {
+        return;
+    }
+    uint32_t area = opaqueRect.GetSize();
+    if (area < MIN_OCCLUDER_AREA) {
+        return;
+    }
+    if (occluderNum_ == MAX_OCCLUDER_NUM) {
+        /* drop the smallest one, the others keep their paint order */
+        uint8_t smallest = 0;
+        for (uint8_t i = 1; i < occluderNum_; i++) {
+            if (occluders_[i].rect.GetSize() < occluders_[smallest].rect.GetSize()) {
+                smallest = i;
+            }
+        }
+        if (occluders_[smallest].rect.GetSize() >= area) {
+            return;
+        }
+        for (uint8_t i = smallest + 1; i < occluderNum_; i++) {
+            occluders_[i - 1] = occluders_[i];
+        }
+        occluderNum_--;
+    }
+    occluders_[occluderNum_++] = {view, opaqueRect};
+}
+
+void RootView::DrawVisibleParts(UIView* view, const Rect& rect)
+{
+    for (uint8_t i = occluderCursor_; i < occluderNum_; i++) {
+        if (occluders_[i].view == view) {
+            occluderCursor_ = i + 1;
+            break;
+        }
+    }
+    Rect parts[MAX_VISIBLE_PART_NUM];
+    parts[0] = rect;
+    uint8_t partNum = 1;
+    for (uint8_t i = occluderCursor_; (i < occluderNum_) && (partNum > 0); i++) {
+        partNum = SubtractRect(parts, partNum, occluders_[i].rect);
+    }
+    uint32_t drawnArea = 0;
+    for (uint8_t i = 0; i < partNum; i++) {
+        DrawView(view, *dc_.bufferInfo, parts[i]);
+        drawnArea += parts[i].GetSize();
+    }
+    overdrawStats_.drawnArea += drawnArea;
+    overdrawStats_.culledArea += rect.GetSize() - drawnArea;
+    if (partNum == 0) {
+        overdrawStats_.culledViewNum++;
+    }
+}
+
 UIView* RootView::GetTopUIView(const Rect& rect)
 {
     int16_t stackCount = 0;
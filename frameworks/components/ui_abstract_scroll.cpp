@@ -22,6 +22,7 @@
 #include "components/ui_abstract_scroll_bar.h"
 #include "components/ui_arc_scroll_bar.h"
 #include "components/ui_box_scroll_bar.h"
+#include "dock/focus_manager.h"
 #if DEFAULT_ANIMATION
 #include "graphic_timer.h"
 #endif
@@ -171,6 +172,9 @@ void UIAbstractScroll::MoveChildByOffset(int16_t offsetX, int16_t offsetY)
     if ((offsetX == 0) && (offsetY == 0)) {
         return;
     }
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::BeginMoveChildren(this);
+#endif
     UIView* view = GetChildrenHead();
     while (view != nullptr) {
         int16_t x = view->GetX() + offsetX;
@@ -178,6 +182,9 @@ void UIAbstractScroll::MoveChildByOffset(int16_t offsetX, int16_t offsetY)
         view->SetPosition(x, y);
         view = view->GetNextSibling();
     }
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::EndMoveChildren(this);
+#endif
     Invalidate();
 }
 
@@ -15,20 +15,35 @@
 
 #include "components/ui_analog_clock.h"
 
+#include "common/ui_arena.h"
 #include "components/ui_image_view.h"
 #include "draw/draw_image.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
 #include "gfx_utils/style.h"
 #include "imgdecode/cache_manager.h"
+#include "securec.h"
 #include "themes/theme.h"
 
 namespace OHOS {
-UIAnalogClock::UIAnalogClock()
+namespace {
+constexpr uint8_t ARGB8888_SIZE = 4;
+constexpr uint8_t ALPHA_INDEX = 3;
+} // namespace
+
+UIAnalogClock::UIAnalogClock() : handSprites_{}, spriteAngleStep_(0), spriteSize_(0)
 {
     touchable_ = true;
 }
 
+UIAnalogClock::~UIAnalogClock()
+{
+    for (uint8_t i = 0; i < HAND_NUM; i++) {
+        ClearHandSprites(i);
+    }
+}
+
 void UIAnalogClock::SetHandImage(HandType type, const UIImageView& img, Point position, Point center)
 {
     Hand* hand = nullptr;
@@ -40,6 +55,7 @@ void UIAnalogClock::SetHandImage(HandType type, const UIImageView& img, Point po
         hand = &secondHand_;
     }
 
+    ClearHandSprites(GetHandIndex(*hand));
     hand->center_ = center;
     hand->position_ = position;
     hand->initAngle_ = 0;
@@ -80,6 +96,7 @@ void UIAnalogClock::SetHandLine(HandType type,
         hand = &secondHand_;
     }
 
+    ClearHandSprites(GetHandIndex(*hand));
     hand->color_ = color;
     hand->height_ = height;
     hand->width_ = width;
@@ -249,12 +266,29 @@ void UIAnalogClock::CalculateRedrawArea(const Rect& current, Hand& hand, bool cl
     pivot.x_ = hand.center_.x;
     pivot.y_ = hand.center_.y;
 
-    /* Rotate the specified angle,  */
-    backwardMap.Rotate(hand.nextAngle_ - hand.initAngle_, pivot);
+    /* Rotate the specified angle, the angles of the rotated copies are multiples of the angle step */
+    bool useSprite = (spriteAngleStep_ != 0) && (hand.drawtype_ == DrawType::DRAW_IMAGE) &&
+                     (hand.imageInfo_.data != nullptr);
+    if (useSprite) {
+        backwardMap.Rotate(GetSpriteIndex(hand) * spriteAngleStep_, pivot);
+    } else {
+        backwardMap.Rotate(hand.nextAngle_ - hand.initAngle_, pivot);
+    }
     Rect redraw = hand.target_;
     hand.target_ = backwardMap.GetBoxRect();
     hand.trans_ = backwardMap;
     hand.preAngle_ = hand.nextAngle_;
+    HandSprite* sprite = useSprite ? GetHandSprite(current, imgRect, hand.target_, hand) : nullptr;
+    if (sprite != nullptr) {
+        hand.target_ = sprite->rect;
+        hand.target_.SetPosition(current.GetLeft() + sprite->rect.GetLeft(), current.GetTop() + sprite->rect.GetTop());
+        if (!clockInit) {
+            /* only the visible pixels of the old and the new hand, not the box around both */
+            InvalidateRect(redraw);
+            InvalidateRect(hand.target_);
+        }
+        return;
+    }
     if (!clockInit) {
         /* Prevent old images from being residued */
         redraw.Join(redraw, hand.target_);
@@ -279,6 +313,14 @@ void UIAnalogClock::DrawHandImage(BufferInfo& gfxDstBuffer,
     if (hand.imageInfo_.data == nullptr) {
         return;
     }
+    HandSprite* sprites = (spriteAngleStep_ != 0) ? handSprites_[GetHandIndex(hand)] : nullptr;
+    if ((sprites != nullptr) && (sprites[GetSpriteIndex(hand)].data != nullptr)) {
+        /* target_ is the area of the rotated copy, set by CalculateRedrawArea */
+        DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, hand.target_, invalidatedArea,
+                                            sprites[GetSpriteIndex(hand)].data, opaScale_,
+                                            DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+        return;
+    }
     uint8_t pxSize = DrawUtils::GetPxSizeByColorMode(hand.imageInfo_.header.colorMode);
     TransformDataInfo imageTranDataInfo = {hand.imageInfo_.header, hand.imageInfo_.data, pxSize, BlurLevel::LEVEL0,
                                            TransformAlgorithm::BILINEAR};
@@ -321,6 +363,151 @@ void UIAnalogClock::DrawHandLine(BufferInfo& gfxDstBuffer, const Rect& invalidat
                                            hand.opacity_);
 }
 
+uint8_t UIAnalogClock::GetHandIndex(const Hand& hand) const
+{
+    if (&hand == &hourHand_) {
+        return 0;
+    } else if (&hand == &minuteHand_) {
+        return 1;
+    } else {
+        return 2; // 2: the second hand
+    }
+}
+
+uint16_t UIAnalogClock::GetSpriteIndex(const Hand& hand) const
+{
+    uint16_t spriteNum = (CIRCLE_IN_DEGREE + spriteAngleStep_ - 1) / spriteAngleStep_;
+    uint16_t angle = (hand.nextAngle_ + CIRCLE_IN_DEGREE - hand.initAngle_ % CIRCLE_IN_DEGREE) % CIRCLE_IN_DEGREE;
+    /* 2: round to the nearest step */
+    return ((angle + spriteAngleStep_ / 2) / spriteAngleStep_) % spriteNum;
+}
+
+UIAnalogClock::HandSprite* UIAnalogClock::GetHandSprite(const Rect& current, const Rect& imgRect, const Rect& box,
+                                                        Hand& hand)
+{
+    uint8_t handIndex = GetHandIndex(hand);
+    if (handSprites_[handIndex] == nullptr) {
+        handSprites_[handIndex] = new HandSprite[(CIRCLE_IN_DEGREE + spriteAngleStep_ - 1) / spriteAngleStep_];
+        if (handSprites_[handIndex] == nullptr) {
+            GRAPHIC_LOGE("new HandSprite fail");
+            return nullptr;
+        }
+    }
+    HandSprite& sprite = handSprites_[handIndex][GetSpriteIndex(hand)];
+    if ((sprite.data == nullptr) && !sprite.failed) {
+        sprite.failed = !RenderHandSprite(current, imgRect, box, hand, sprite);
+    }
+    return (sprite.data != nullptr) ? &sprite : nullptr;
+}
+
+bool UIAnalogClock::RenderHandSprite(const Rect& current, const Rect& imgRect, const Rect& box, const Hand& hand,
+                                     HandSprite& sprite)
+{
+    int16_t width = box.GetWidth();
+    int16_t height = box.GetHeight();
+    if ((width <= 0) || (height <= 0)) {
+        return false;
+    }
+    uint32_t bufSize = static_cast<uint32_t>(width) * height * ARGB8888_SIZE;
+    uint8_t* buffer = static_cast<uint8_t*>(UIFrameAllocator::GetInstance()->Allocate(bufSize));
+    if ((buffer == nullptr) || (memset_s(buffer, bufSize, 0, bufSize) != EOK)) {
+        return false;
+    }
+
+    /* rotate the hand the same way as trans_, into a buffer starting at the top left of its box */
+    Rect rect = imgRect;
+    rect.SetPosition(imgRect.GetLeft() - box.GetLeft(), imgRect.GetTop() - box.GetTop());
+    TransformMap transMap(rect);
+    transMap.Rotate(GetSpriteIndex(hand) * spriteAngleStep_, Vector2<float>(hand.center_.x, hand.center_.y));
+    Rect bufRect(0, 0, width - 1, height - 1);
+    BufferInfo bufInfo{bufRect, 0, nullptr, nullptr, 0, 0, ARGB8888, 0};
+    bufInfo.stride = static_cast<uint32_t>(width) * ARGB8888_SIZE;
+    bufInfo.phyAddr = buffer;
+    bufInfo.virAddr = buffer;
+    bufInfo.width = width;
+    bufInfo.height = height;
+    uint8_t pxSize = DrawUtils::GetPxSizeByColorMode(hand.imageInfo_.header.colorMode);
+    TransformDataInfo imageTranDataInfo = {hand.imageInfo_.header, hand.imageInfo_.data, pxSize, BlurLevel::LEVEL0,
+                                           TransformAlgorithm::BILINEAR};
+    BaseGfxEngine::GetInstance()->DrawTransform(bufInfo, bufRect, {0, 0}, Color::Black(), OPA_OPAQUE, transMap,
+                                                imageTranDataInfo);
+
+    /* trim the transparent rows and columns around the hand */
+    Rect visible(width, height, -1, -1);
+    for (int16_t y = 0; y < height; y++) {
+        for (int16_t x = 0; x < width; x++) {
+            if (buffer[(y * width + x) * ARGB8888_SIZE + ALPHA_INDEX] != 0) {
+                visible.SetLeft(MATH_MIN(visible.GetLeft(), x));
+                visible.SetRight(MATH_MAX(visible.GetRight(), x));
+                visible.SetTop(MATH_MIN(visible.GetTop(), y));
+                visible.SetBottom(MATH_MAX(visible.GetBottom(), y));
+            }
+        }
+    }
+    if (visible.GetRight() < 0) {
+        return false;
+    }
+    uint32_t stride = static_cast<uint32_t>(visible.GetWidth()) * ARGB8888_SIZE;
+    uint32_t dataSize = stride * visible.GetHeight();
+    if (dataSize > MAX_HAND_SPRITE_SIZE - spriteSize_) {
+        return false;
+    }
+    sprite.data = static_cast<uint8_t*>(UIMalloc(dataSize));
+    if (sprite.data == nullptr) {
+        GRAPHIC_LOGE("UIAnalogClock::RenderHandSprite UIMalloc fail");
+        return false;
+    }
+    for (int16_t y = 0; y < visible.GetHeight(); y++) {
+        const uint8_t* src = buffer + ((visible.GetTop() + y) * width + visible.GetLeft()) * ARGB8888_SIZE;
+        if (memcpy_s(sprite.data + y * stride, dataSize - y * stride, src, stride) != EOK) {
+            UIFree(sprite.data);
+            sprite.data = nullptr;
+            return false;
+        }
+    }
+    spriteSize_ += dataSize;
+    sprite.rect = visible;
+    sprite.rect.SetPosition(box.GetLeft() - current.GetLeft() + visible.GetLeft(),
+                            box.GetTop() - current.GetTop() + visible.GetTop());
+    return true;
+}
+
+void UIAnalogClock::ClearHandSprites(uint8_t handIndex)
+{
+    HandSprite* sprites = handSprites_[handIndex];
+    if (sprites == nullptr) {
+        return;
+    }
+    uint16_t spriteNum = (CIRCLE_IN_DEGREE + spriteAngleStep_ - 1) / spriteAngleStep_;
+    for (uint16_t i = 0; i < spriteNum; i++) {
+        if (sprites[i].data != nullptr) {
+            spriteSize_ -= static_cast<uint32_t>(sprites[i].rect.GetWidth()) * sprites[i].rect.GetHeight() *
+                           ARGB8888_SIZE;
+            UIFree(sprites[i].data);
+        }
+    }
+    delete[] sprites;
+    handSprites_[handIndex] = nullptr;
+}
+
+void UIAnalogClock::SetHandSpriteCache(bool enable, uint16_t angleStep)
+{
+    if (angleStep == 0) {
+        angleStep = 1;
+    } else if (angleStep > CIRCLE_IN_DEGREE) {
+        angleStep = CIRCLE_IN_DEGREE;
+    }
+    uint16_t step = enable ? angleStep : 0;
+    if (step == spriteAngleStep_) {
+        return;
+    }
+    for (uint8_t i = 0; i < HAND_NUM; i++) {
+        ClearHandSprites(i);
+    }
+    spriteAngleStep_ = step;
+    Invalidate();
+}
+
 void UIAnalogClock::SetWorkMode(WorkMode newMode)
 {
     WorkMode oldMode = mode_;
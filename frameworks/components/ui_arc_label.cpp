@@ -19,6 +19,7 @@
 #include "draw/draw_label.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "font/ui_font.h"
+#include "gfx_utils/mem_api.h"
 #include "themes/theme_manager.h"
 
 namespace OHOS {
@@ -32,7 +33,9 @@ UIArcLabel::UIArcLabel()
       endAngle_(0),
       arcCenter_({0, 0}),
       orientation_(TextOrientation::INSIDE),
-      arcTextInfo_{0}
+      arcTextInfo_{0},
+      arcLetters_(nullptr),
+      arcLetterNum_(0)
 {
     Theme* theme = ThemeManager::GetInstance().GetCurrent();
     style_ = (theme != nullptr) ? &(theme->GetLabelStyle()) : &(StyleDefault::GetLabelStyle());
@@ -40,12 +43,19 @@ UIArcLabel::UIArcLabel()
 
 UIArcLabel::~UIArcLabel()
 {
+    ClearArcLetters();
     if (arcLabelText_ != nullptr) {
         delete arcLabelText_;
         arcLabelText_ = nullptr;
     }
 }
 
+void UIArcLabel::SetStyle(Style& style)
+{
+    UIView::SetStyle(style);
+    RefreshArcLabel();
+}
+
 void UIArcLabel::SetStyle(uint8_t key, int64_t value)
 {
     UIView::SetStyle(key, value);
@@ -138,6 +148,11 @@ void UIArcLabel::DrawArcText(BufferInfo& gfxDstBuffer,
     Point center;
     center.x = arcTextInfo_.arcCenter.x + GetRect().GetX();
     center.y = arcTextInfo_.arcCenter.y + GetRect().GetY();
+    if (UpdateArcLetters()) {
+        DrawLabel::DrawArcLetters(gfxDstBuffer, mask, arcLetters_, arcLetterNum_, center, arcLabelText_->GetFontId(),
+                                  arcLabelText_->GetFontSize(), *style_, opaScale, compatibilityMode_);
+        return;
+    }
     DrawLabel::DrawArcText(gfxDstBuffer, mask, arcLabelText_->GetText(), center, arcLabelText_->GetFontId(),
                            arcLabelText_->GetFontSize(), arcTextInfo,
                            orientation, *style_, opaScale, compatibilityMode_);
@@ -149,8 +164,40 @@ Rect UIArcLabel::GetArcTextRect(const char* text, uint16_t fontId, uint8_t fontS
     return TypedText::GetArcTextRect(text, fontId, fontSize, arcCenter, letterSpace, orientation, arcTextInfo);
 }
 
+bool UIArcLabel::UpdateArcLetters()
+{
+    if (arcLetters_ != nullptr) {
+        return true;
+    }
+    uint16_t fontId = arcLabelText_->GetFontId();
+    uint8_t fontSize = arcLabelText_->GetFontSize();
+    uint16_t letterNum = DrawLabel::GetArcLetters(arcLabelText_->GetText(), fontId, fontSize, arcTextInfo_,
+                                                  orientation_, *style_, compatibilityMode_, nullptr, 0);
+    if (letterNum == 0) {
+        return false;
+    }
+    arcLetters_ = static_cast<ArcLetterInfo*>(UIMalloc(letterNum * sizeof(ArcLetterInfo)));
+    if (arcLetters_ == nullptr) {
+        GRAPHIC_LOGE("UIArcLabel::UpdateArcLetters UIMalloc fail");
+        return false;
+    }
+    arcLetterNum_ = DrawLabel::GetArcLetters(arcLabelText_->GetText(), fontId, fontSize, arcTextInfo_, orientation_,
+                                             *style_, compatibilityMode_, arcLetters_, letterNum);
+    return true;
+}
+
+void UIArcLabel::ClearArcLetters()
+{
+    if (arcLetters_ != nullptr) {
+        UIFree(arcLetters_);
+        arcLetters_ = nullptr;
+    }
+    arcLetterNum_ = 0;
+}
+
 void UIArcLabel::RefreshArcLabel()
 {
+    ClearArcLetters();
     Invalidate();
     if (!needRefresh_) {
         needRefresh_ = true;
@@ -164,6 +211,7 @@ void UIArcLabel::ReMeasure()
     }
     needRefresh_ = false;
     InitArcLabelText();
+    ClearArcLetters();
 
     MeasureArcTextInfo();
     arcTextInfo_.shapingFontId = arcLabelText_->GetShapingFontId();
@@ -23,11 +23,28 @@
 #include "gfx_utils/image_info.h"
 #include "gfx_utils/mem_api.h"
 #include "imgdecode/cache_manager.h"
+#include "imgdecode/image_decode_service.h"
+#include "imgdecode/image_mipmap.h"
 #if defined(ENABLE_GIF) && (ENABLE_GIF == 1)
 #include "gif_lib.h"
 #endif
 
 namespace OHOS {
+class ImageViewDecodeListener : public ImageDecodeListener {
+public:
+    explicit ImageViewDecodeListener(UIImageView* view) : view_(view) {}
+
+    virtual ~ImageViewDecodeListener() {}
+
+    void OnDecodeFinished(const char* src, ImageInfo* imgInfo, uint8_t decodeShift) override
+    {
+        view_->OnAsyncDecodeFinished(src, imgInfo, decodeShift);
+    }
+
+private:
+    UIImageView* view_;
+};
+
 #if defined(ENABLE_GIF) && (ENABLE_GIF == 1)
 class GifImageAnimator : public Animator, public AnimatorCallback {
 public:
@@ -238,6 +255,11 @@ UIImageView::UIImageView()
 
 UIImageView::~UIImageView()
 {
+    CancelAsyncDecode();
+    if (decodeListener_ != nullptr) {
+        delete decodeListener_;
+        decodeListener_ = nullptr;
+    }
 #if defined(ENABLE_GIF) && (ENABLE_GIF == 1)
     RemoveAndStopGifAnimator();
 #endif
@@ -261,6 +283,7 @@ void UIImageView::SetResizeMode(ImageResizeMode mode)
         ReMeasure();
         // must update the mode, before calling UpdateDrawTransMap
         imageResizeMode_ = mode;
+        UpdateDecodeSize();
         UpdateDrawTransMap(true);
     }
 }
@@ -395,6 +418,7 @@ void UIImageView::SetHeight(int16_t height)
 {
     if (GetHeight() != height) {
         UIView::SetHeight(height);
+        UpdateDecodeSize();
         UpdateDrawTransMap(true);
     }
 }
@@ -403,6 +427,7 @@ void UIImageView::SetWidth(int16_t width)
 {
     if (GetWidth() != width) {
         UIView::SetWidth(width);
+        UpdateDecodeSize();
         UpdateDrawTransMap(true);
     }
 }
@@ -454,6 +479,7 @@ void UIImageView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
                 }
             } else if ((drawTransMap_ != nullptr) && !drawTransMap_->IsInvalid()) {
                 ImageInfo imgInfo;
+                const ImageMipmap* mipmap = nullptr;
                 if (srcType == IMG_SRC_FILE) {
                     CacheEntry entry;
                     RetCode ret = CacheManager::GetInstance().Open(GetPath(), *style_, entry);
@@ -461,8 +487,15 @@ void UIImageView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
                         return;
                     }
                     imgInfo = entry.GetImageInfo();
+                    mipmap = downscaleEnable_ ? CacheManager::GetInstance().GetMipmap(GetPath()) : nullptr;
                 } else {
                     imgInfo = *(GetImageInfo());
+                    mipmap = downscaleEnable_ ? image_.GetMipmap() : nullptr;
+                }
+                const TransformMap* transMap = drawTransMap_;
+                TransformMap levelMap;
+                if ((mipmap != nullptr) && mipmap->Select(*drawTransMap_, imgInfo, levelMap)) {
+                    transMap = &levelMap;
                 }
                 uint8_t pxSize = DrawUtils::GetPxSizeByColorMode(imgInfo.header.colorMode);
                 TransformDataInfo imageTranDataInfo = {imgInfo.header, imgInfo.data, pxSize,
@@ -470,7 +503,7 @@ void UIImageView::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
                                                        static_cast<TransformAlgorithm>(algorithm_)};
                 OpacityType opaScale = DrawUtils::GetMixOpacity(opa, style_->imageOpa_);
                 BaseGfxEngine::GetInstance()->DrawTransform(gfxDstBuffer, trunc, {0, 0}, Color::Black(),
-                                                            opaScale, *drawTransMap_, imageTranDataInfo);
+                                                            opaScale, *transMap, imageTranDataInfo);
             }
         }
     }
@@ -508,10 +541,14 @@ void UIImageView::SetSrc(const char* src)
         AddAndStartGifAnimator();
         updated = true;
     } else {
-        updated = image_.SetSrc(src);
+        CancelAsyncDecode();
+        image_.SetDecodeSize(GetDecodeSize());
+        updated = SetSrcAsync(src) || image_.SetSrc(src);
     }
 #else
-    bool updated = image_.SetSrc(src);
+    CancelAsyncDecode();
+    image_.SetDecodeSize(GetDecodeSize());
+    bool updated = SetSrcAsync(src) || image_.SetSrc(src);
 #endif
     if (!updated) {
         return;
@@ -552,6 +589,7 @@ void UIImageView::SetSrc(const ImageInfo* src)
     }
     gifFrameFlag_ = false;
 #endif
+    CancelAsyncDecode();
     bool updated = image_.SetSrc(src);
     if (!updated) {
         return;
@@ -563,6 +601,116 @@ void UIImageView::SetSrc(const ImageInfo* src)
     Invalidate();
 }
 
+void UIImageView::SetAsyncDecode(bool enable)
+{
+    if (!enable) {
+        CancelAsyncDecode();
+    }
+    asyncDecode_ = enable;
+}
+
+bool UIImageView::SetSrcAsync(const char* src)
+{
+    if (!asyncDecode_) {
+        return false;
+    }
+    if (decodeListener_ == nullptr) {
+        decodeListener_ = new ImageViewDecodeListener(this);
+        if (decodeListener_ == nullptr) {
+            GRAPHIC_LOGE("new ImageViewDecodeListener fail");
+            return false;
+        }
+    }
+    if (!ImageDecodeService::GetInstance()->Decode(src, decodeListener_, this, image_.GetDecodeSize())) {
+        return false;
+    }
+    // show the placeholder until the decoded image is delivered
+    image_.SetSrc(placeholder_);
+    asyncDecodeState_ = ASYNC_DECODE_PENDING;
+    return true;
+}
+
+void UIImageView::CancelAsyncDecode()
+{
+    if (decodeListener_ != nullptr) {
+        ImageDecodeService::GetInstance()->Cancel(decodeListener_);
+    }
+    asyncDecodeState_ = ASYNC_DECODE_NONE;
+}
+
+void UIImageView::OnAsyncDecodeFinished(const char* src, ImageInfo* imgInfo, uint8_t decodeShift)
+{
+    if (imgInfo == nullptr) {
+        GRAPHIC_LOGE("UIImageView decode %s failed", src);
+        asyncDecodeState_ = ASYNC_DECODE_FAILED;
+        return;
+    }
+    if (!image_.SetDecodedSrc(src, imgInfo, decodeShift)) {
+        UIFree(reinterpret_cast<void*>(const_cast<uint8_t*>(imgInfo->data)));
+        UIFree(reinterpret_cast<void*>(imgInfo));
+        asyncDecodeState_ = ASYNC_DECODE_FAILED;
+        return;
+    }
+    asyncDecodeState_ = ASYNC_DECODE_DONE;
+    needRefresh_ = true;
+    if (autoEnable_) {
+        UIImageView::ReMeasure();
+    }
+    Invalidate();
+}
+
+void UIImageView::SetDownscaleEnable(bool enable)
+{
+    if (downscaleEnable_ != enable) {
+        downscaleEnable_ = enable;
+        UpdateDecodeSize();
+        Invalidate();
+    }
+}
+
+Image::DecodeSize UIImageView::GetDecodeSize()
+{
+    Image::DecodeSize size = {0, 0, false};
+    if (!downscaleEnable_ || autoEnable_) {
+        return size;
+    }
+    switch (imageResizeMode_) {
+        case ImageResizeMode::COVER:
+        case ImageResizeMode::FILL:
+            size.fitInside = false;
+            break;
+        case ImageResizeMode::CONTAIN:
+        case ImageResizeMode::SCALE_DOWN:
+            size.fitInside = true;
+            break;
+        default:
+            // the other modes never shrink the image
+            return size;
+    }
+    Rect viewRect = GetOrigRect();
+    int16_t widgetWidth = viewRect.GetWidth() - style_->paddingLeft_ - style_->paddingRight_ -
+        style_->borderWidth_ * 2; // 2: excludes the border-left and border-right
+    int16_t widgetHeight = viewRect.GetHeight() - style_->paddingTop_ - style_->paddingBottom_ -
+        style_->borderWidth_ * 2; // 2: excludes the border-top and border-bottom
+    if ((widgetWidth > 0) && (widgetHeight > 0)) {
+        size.width = static_cast<uint16_t>(widgetWidth);
+        size.height = static_cast<uint16_t>(widgetHeight);
+    }
+    return size;
+}
+
+void UIImageView::UpdateDecodeSize()
+{
+    image_.SetDecodeSize(GetDecodeSize());
+    // a larger view may need the file decoded at a larger size
+    if (image_.ReDecode()) {
+        needRefresh_ = true;
+        ReMeasure();
+        UpdateDrawTransMap(true);
+        Invalidate();
+    }
+}
+
 #if defined(ENABLE_GIF) && (ENABLE_GIF == 1)
 void UIImageView::AddAndStartGifAnimator()
 {
@@ -14,11 +14,24 @@
  */
 
 #include "components/ui_label.h"
+#include "draw/draw_utils.h"
 #include "font/ui_font.h"
 #include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+#include "securec.h"
 #include "themes/theme_manager.h"
 
 namespace OHOS {
+/* the line of text scrolled in marquee mode, rendered once with the text at x 0 */
+struct UILabel::MarqueeStrip : public HeapBase {
+    uint8_t* data;
+    uint32_t dataSize;
+    int16_t width;
+    int16_t height;
+    uint32_t textColor;
+    bool dirty;
+};
+
 class LabelAnimator : public Animator, public AnimatorCallback {
 public:
     LabelAnimator(uint16_t textX, uint16_t labelX, int16_t startPos, UIView* view)
@@ -87,7 +100,7 @@ public:
         }
         offsetX_ = ((offsetX_ - labelX_) % (textX_ + labelX_)) + labelX_;
         static_cast<UILabel*>(view)->offsetX_ = offsetX_;
-        view->Invalidate();
+        static_cast<UILabel*>(view)->InvalidateMarquee();
     }
 
     void SetAnimatorSpeed(uint16_t animSpeed)
@@ -122,6 +135,7 @@ UILabel::UILabel()
       ellipsisIndex_(Text::TEXT_ELLIPSIS_END_INV),
       offsetX_(0),
       textColor_(Color::White()),
+      marqueeStrip_(nullptr),
       animator_{nullptr}
 {
     Theme* theme = ThemeManager::GetInstance().GetCurrent();
@@ -132,6 +146,13 @@ UILabel::UILabel()
 
 UILabel::~UILabel()
 {
+    if (marqueeStrip_ != nullptr) {
+        if (marqueeStrip_->data != nullptr) {
+            UIFree(marqueeStrip_->data);
+        }
+        delete marqueeStrip_;
+        marqueeStrip_ = nullptr;
+    }
     if (hasAnimator_) {
         delete animator_.animator;
         animator_.animator = nullptr;
@@ -313,6 +334,7 @@ void UILabel::SetHeight(int16_t height)
 void UILabel::RefreshLabel()
 {
     Invalidate();
+    MarkMarqueeStripDirty();
     ellipsisIndex_ = Text::TEXT_ELLIPSIS_END_INV;
     if (!needRefresh_) {
         needRefresh_ = true;
@@ -419,6 +441,111 @@ uint16_t UILabel::GetRollSpeed() const
     return hasAnimator_ ? static_cast<LabelAnimator*>(animator_.animator)->GetAnimatorSpeed() : animator_.speed;
 }
 
+void UILabel::SetMarqueeCacheEnable(bool enable)
+{
+    if (enable == (marqueeStrip_ != nullptr)) {
+        return;
+    }
+    if (enable) {
+        marqueeStrip_ = new MarqueeStrip();
+        if (marqueeStrip_ == nullptr) {
+            GRAPHIC_LOGE("new MarqueeStrip fail");
+            return;
+        }
+        marqueeStrip_->dirty = true;
+    } else {
+        if (marqueeStrip_->data != nullptr) {
+            UIFree(marqueeStrip_->data);
+        }
+        delete marqueeStrip_;
+        marqueeStrip_ = nullptr;
+    }
+    Invalidate();
+}
+
+void UILabel::MarkMarqueeStripDirty()
+{
+    if (marqueeStrip_ != nullptr) {
+        marqueeStrip_->dirty = true;
+    }
+}
+
+void UILabel::InvalidateMarquee()
+{
+    /* the border and the padding do not move, only the text does */
+    if ((marqueeStrip_ != nullptr) && (transMap_ == nullptr)) {
+        InvalidateRect(GetContentRect());
+    } else {
+        Invalidate();
+    }
+}
+
+bool UILabel::UpdateMarqueeStrip(int16_t width, int16_t height, const Style& style)
+{
+    MarqueeStrip* strip = marqueeStrip_;
+    if (!strip->dirty && (strip->width == width) && (strip->height == height) &&
+        (strip->textColor == style.textColor_.full)) {
+        return strip->data != nullptr;
+    }
+    uint32_t stride = static_cast<uint32_t>(width) * sizeof(uint32_t);
+    uint32_t dataSize = stride * static_cast<uint32_t>(height);
+    if (dataSize != strip->dataSize) {
+        if (strip->data != nullptr) {
+            UIFree(strip->data);
+        }
+        strip->data = static_cast<uint8_t*>(UIMalloc(dataSize));
+        strip->dataSize = (strip->data != nullptr) ? dataSize : 0;
+        if (strip->data == nullptr) {
+            GRAPHIC_LOGE("UILabel::UpdateMarqueeStrip UIMalloc fail");
+            return false;
+        }
+    }
+    if (memset_s(strip->data, dataSize, 0, dataSize) != EOK) {
+        return false;
+    }
+    strip->width = width;
+    strip->height = height;
+    strip->textColor = style.textColor_.full;
+    strip->dirty = false;
+
+    /* the text is as wide as the strip, both directions start it at x 0 */
+    Rect rect(0, 0, width - 1, height - 1);
+    BufferInfo bufInfo{rect, 0, nullptr, nullptr, 0, 0, ARGB8888, 0};
+    bufInfo.stride = stride;
+    bufInfo.phyAddr = strip->data;
+    bufInfo.virAddr = strip->data;
+    bufInfo.width = width;
+    bufInfo.height = height;
+    labelText_->OnDraw(bufInfo, rect, rect, rect, 0, style, Text::TEXT_ELLIPSIS_END_INV, OPA_OPAQUE);
+    return true;
+}
+
+bool UILabel::DrawMarqueeStrip(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea, const Style& style,
+                               OpacityType opaScale)
+{
+    if ((marqueeStrip_ == nullptr) || (lineBreakMode_ != LINE_BREAK_MARQUEE) || (labelText_->GetText() == nullptr)) {
+        return false;
+    }
+    Rect contentRect = GetContentRect();
+    int16_t textWidth = labelText_->GetTextSize().x;
+    if ((textWidth <= contentRect.GetWidth()) || !UpdateMarqueeStrip(textWidth, contentRect.GetHeight(), style)) {
+        return false;
+    }
+    Rect mask;
+    if (!mask.Intersect(invalidatedArea, contentRect)) {
+        return true;
+    }
+    /* the same place the text is drawn at in Text::Draw, rtl text scrolls the other way */
+    int16_t left = contentRect.GetLeft() + offsetX_;
+    if (labelText_->GetDirect() == TEXT_DIRECT_RTL) {
+        left = contentRect.GetRight() + 1 - textWidth - offsetX_;
+    }
+    Rect area(left, contentRect.GetTop(), left + textWidth - 1, contentRect.GetBottom());
+    DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, area, mask, marqueeStrip_->data, opaScale,
+                                        DrawUtils::GetPxSizeByColorMode(ARGB8888), ARGB8888);
+    return true;
+}
+
 void UILabel::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
 {
     InitLabelText();
@@ -426,6 +553,9 @@ void UILabel::OnDraw(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea)
     Style style = GetStyleConst();
     style.textColor_ = GetTextColor();
     OpacityType opa = GetMixOpaScale();
+    if (DrawMarqueeStrip(gfxDstBuffer, invalidatedArea, style, opa)) {
+        return;
+    }
     labelText_->OnDraw(gfxDstBuffer, invalidatedArea, GetOrigRect(),
                        GetContentRect(), offsetX_, style, ellipsisIndex_, opa);
 }
@@ -16,6 +16,7 @@
 #include "components/ui_list.h"
 
 #include "components/ui_abstract_scroll_bar.h"
+#include "dock/focus_manager.h"
 #include "gfx_utils/graphic_log.h"
 
 namespace OHOS {
@@ -657,6 +658,9 @@ void UIList::MoveChildByOffset(int16_t xOffset, int16_t yOffset)
         }
     }
     bool isSelectViewFind = false;
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::BeginMoveChildren(this);
+#endif
     do {
         int16_t x = view->GetX() + xOffset;
         int16_t y = view->GetY() + yOffset;
@@ -703,6 +707,9 @@ void UIList::MoveChildByOffset(int16_t xOffset, int16_t yOffset)
         }
         view = view->GetNextSibling();
     } while (view != nullptr);
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::EndMoveChildren(this);
+#endif
 }
 
 void UIList::StopAnimator()
@@ -15,6 +15,8 @@
 
 #include "components/ui_view.h"
 
+#include "animator/animator_timeline.h"
+#include "common/style_pool.h"
 #include "components/root_view.h"
 #include "components/ui_view_group.h"
 #include "core/render_manager.h"
@@ -28,6 +30,16 @@
 #include "themes/theme_manager.h"
 
 namespace OHOS {
+namespace {
+/* the index of the focusable views is built again when the view tree or the geometry of a view in it changes */
+inline void InvalidateFocusIndex(const UIView* view, bool moved = false)
+{
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::InvalidateIndex(view, moved);
+#endif
+}
+} // namespace
+
 UIView::UIView()
     : touchable_(false),
       visible_(true),
@@ -68,6 +80,8 @@ UIView::UIView()
 
 UIView::~UIView()
 {
+    AnimatorTimeline::GetInstance()->RemoveTracks(this);
+    InvalidateFocusIndex(this);
     if (transMap_ != nullptr) {
         delete transMap_;
         transMap_ = nullptr;
@@ -77,7 +91,7 @@ UIView::~UIView()
         visibleRect_ = nullptr;
     }
     if (styleAllocFlag_) {
-        delete style_;
+        StylePool::GetInstance()->Release(style_);
         style_ = nullptr;
         styleAllocFlag_ = false;
     }
@@ -187,8 +201,9 @@ void UIView::SetupThemeStyles()
 
 void UIView::SetStyle(Style& style)
 {
+    InvalidateFocusIndex(this);
     if (styleAllocFlag_) {
-        delete style_;
+        StylePool::GetInstance()->Release(style_);
         styleAllocFlag_ = false;
     }
     style_ = &style;
@@ -196,19 +211,23 @@ void UIView::SetStyle(Style& style)
 
 void UIView::SetStyle(uint8_t key, int64_t value)
 {
-    if (!styleAllocFlag_) {
-        style_ = new Style(*style_);
-        if (style_ == nullptr) {
-            GRAPHIC_LOGE("new Style fail");
-            return;
-        }
-        styleAllocFlag_ = true;
-    }
     int16_t width = GetWidth();
     int16_t height = GetHeight();
     int16_t x = GetX();
     int16_t y = GetY();
-    style_->SetStyle(key, value);
+    /* the pooled styles are shared by the views which look the same, a change gets another pooled style */
+    const Style* style = styleAllocFlag_ ? StylePool::GetInstance()->Update(style_, key, value) : nullptr;
+    if (style == nullptr) {
+        Style newStyle(*style_);
+        newStyle.SetStyle(key, value);
+        style = StylePool::GetInstance()->Acquire(newStyle);
+    }
+    if (style == nullptr) {
+        GRAPHIC_LOGE("new Style fail");
+        return;
+    }
+    style_ = const_cast<Style*>(style);
+    styleAllocFlag_ = true;
     Rect rect(x, y, x + width - 1, y + height - 1);
     UpdateRectInfo(key, rect);
 }
@@ -283,6 +302,7 @@ void UIView::Rotate(int16_t angle, const Vector2<float>& pivot)
 
 void UIView::Rotate(int16_t angle, const Vector3<float>& pivotStart, const Vector3<float>& pivotEnd)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -309,6 +329,7 @@ void UIView::Scale(const Vector2<float>& scale, const Vector2<float>& pivot)
 
 void UIView::Scale(const Vector3<float>& scale, const Vector3<float>& pivot)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -328,6 +349,7 @@ void UIView::Scale(const Vector3<float>& scale, const Vector3<float>& pivot)
 
 void UIView::Shear(const Vector2<float>& shearX, const Vector2<float>& shearY, const Vector2<float>& shearZ)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -356,6 +378,7 @@ void UIView::Translate(const Vector2<int16_t>& trans)
 
 void UIView::Translate(const Vector3<int16_t>& trans)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -383,6 +406,7 @@ bool UIView::IsTransInvalid()
 
 void UIView::SetCameraDistance(int16_t distance)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -397,6 +421,7 @@ void UIView::SetCameraDistance(int16_t distance)
 
 void UIView::SetCameraPosition(const Vector2<float>& position)
 {
+    InvalidateFocusIndex(this);
     if (transMap_ == nullptr) {
         ReMeasure();
         transMap_ = new TransformMap();
@@ -411,6 +436,7 @@ void UIView::SetCameraPosition(const Vector2<float>& position)
 
 void UIView::ResetTransParameter()
 {
+    InvalidateFocusIndex(this);
     if (transMap_ != nullptr) {
         delete transMap_;
         transMap_ = nullptr;
@@ -592,6 +618,8 @@ UIView::OnTouchListener*& UIView::GetTouchListener()
 
 void UIView::SetParent(UIView* parent)
 {
+    InvalidateFocusIndex(this);
+    InvalidateFocusIndex(parent);
     parent_ = parent;
 }
 
@@ -602,6 +630,7 @@ UIView* UIView::GetParent() const
 
 void UIView::SetNextSibling(UIView* sibling)
 {
+    InvalidateFocusIndex(this);
     nextSibling_ = sibling;
 }
 
@@ -624,6 +653,7 @@ void UIView::SetVisible(bool visible)
 {
     if (visible_ != visible) {
         visible_ = visible;
+        InvalidateFocusIndex(this);
         needRedraw_ = true;
         Invalidate();
     }
@@ -737,6 +767,7 @@ void UIView::GetTargetView(const Point& point, UIView** current, UIView** target
 #if ENABLE_FOCUS_MANAGER
 void UIView::SetFocusable(bool focusable)
 {
+    InvalidateFocusIndex(this);
     focusable_ = focusable;
 }
 
@@ -851,6 +882,7 @@ void UIView::SetTransformMap(const TransformMap& transMap)
     if ((transMap_ != nullptr) && (*transMap_ == transMap)) {
         return;
     }
+    InvalidateFocusIndex(this);
 
     if (transMap_ == nullptr) {
         transMap_ = new TransformMap();
@@ -870,6 +902,7 @@ void UIView::SetWidth(int16_t width)
         int16_t newWidth = width + style_->paddingLeft_ + style_->paddingRight_ +
                            (style_->borderWidth_ * 2); /* 2: left and right border */
         rect_.SetWidth(newWidth);
+        InvalidateFocusIndex(this);
     }
 }
 
@@ -896,6 +929,7 @@ void UIView::SetHeight(int16_t height)
         int16_t newHeight = height + style_->paddingTop_ + style_->paddingBottom_ +
                             (style_->borderWidth_ * 2); /* 2: top and bottom border */
         rect_.SetHeight(newHeight);
+        InvalidateFocusIndex(this);
     }
 }
 
@@ -938,6 +972,7 @@ void UIView::SetX(int16_t x)
 {
     if (GetX() != x) {
         rect_.SetX(x + GetStyle(STYLE_MARGIN_LEFT));
+        InvalidateFocusIndex(this, true);
     }
 }
 
@@ -961,6 +996,7 @@ void UIView::SetY(int16_t y)
 {
     if (GetY() != y) {
         rect_.SetY(y + GetStyle(STYLE_MARGIN_TOP));
+        InvalidateFocusIndex(this, true);
     }
 }
 
@@ -19,6 +19,7 @@
 
 #include "components/root_view.h"
 #include "components/ui_tree_manager.h"
+#include "dock/focus_manager.h"
 #include "gfx_utils/graphic_log.h"
 
 namespace OHOS {
@@ -39,6 +40,14 @@ UIViewGroup::UIViewGroup()
 
 UIViewGroup::~UIViewGroup() {}
 
+#if ENABLE_FOCUS_MANAGER
+void UIViewGroup::SetInterceptFocus(bool interceptFocus)
+{
+    isInterceptFocus_ = interceptFocus;
+    FocusManager::InvalidateIndex(this);
+}
+#endif
+
 void UIViewGroup::Add(UIView* view)
 {
     if ((view == this) || (view == nullptr)) {
@@ -67,6 +76,7 @@ void UIViewGroup::Add(UIView* view)
     }
     UpdateRenderView(view);
     OnChildChanged();
+    UITreeManager::GetInstance().OnLifeEvent(view, UITreeManager::ADD);
 }
 
 void UIViewGroup::Insert(UIView* prevView, UIView* insertView)
@@ -106,6 +116,7 @@ void UIViewGroup::Insert(UIView* prevView, UIView* insertView)
     }
     UpdateRenderView(insertView);
     OnChildChanged();
+    UITreeManager::GetInstance().OnLifeEvent(insertView, UITreeManager::ADD);
 }
 
 void UIViewGroup::Remove(UIView* view)
@@ -312,6 +323,9 @@ UIView* UIViewGroup::GetChildById(const char* id) const
 
 void UIViewGroup::MoveChildByOffset(int16_t xOffset, int16_t yOffset)
 {
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::BeginMoveChildren(this);
+#endif
     UIView* view = childrenHead_;
     while (view != nullptr) {
         int16_t x = view->GetX() + xOffset;
@@ -319,6 +333,9 @@ void UIViewGroup::MoveChildByOffset(int16_t xOffset, int16_t yOffset)
         view->SetPosition(x, y);
         view = view->GetNextSibling();
     }
+#if ENABLE_FOCUS_MANAGER
+    FocusManager::EndMoveChildren(this);
+#endif
 }
 
 void UIViewGroup::AutoResize()
@@ -16,6 +16,7 @@
 #include "core/render_manager.h"
 
 #include "components/root_view.h"
+#include "dfx/ui_render_trace.h"
 #include "gfx_utils/graphic_log.h"
 #include "hal_tick.h"
 #include "securec.h"
@@ -24,7 +25,29 @@
 #endif
 
 namespace OHOS {
-RenderManager::RenderManager() : fps_(0.f), needResetFPS_(true), onFPSChangedListener_(nullptr) {}
+namespace {
+constexpr uint32_t US_PER_MS = 1000;
+constexpr uint32_t PERCENT = 100;
+/* the upper bounds of the histogram buckets but the last, in percent of the budget */
+constexpr uint32_t HISTOGRAM_BOUNDS[RenderManager::FRAME_HISTOGRAM_SIZE - 1] = {25, 50, 75, 100, 150, 200, 300};
+} // namespace
+
+RenderManager::RenderManager()
+    : fps_(0.f),
+      needResetFPS_(true),
+      onFPSChangedListener_(nullptr),
+      onFrameStatsListener_(nullptr),
+      vsyncSource_(nullptr),
+      lastVsyncTime_(0),
+      taskPeriod_(DEFAULT_TASK_PERIOD),
+      phaseTime_{},
+      frameFlushed_(false),
+      frameStats_({})
+{
+#if ENABLE_WINDOW
+    skippedWindowNum_ = 0;
+#endif
+}
 
 RenderManager::~RenderManager() {}
 
@@ -41,23 +64,101 @@ void RenderManager::Init()
 
 void RenderManager::Callback()
 {
-#if ENABLE_WINDOW
-    ListNode<Window*>* winNode = winList_.Begin();
-    while (winNode != winList_.End()) {
-        WindowImpl* windowImpl = reinterpret_cast<WindowImpl*>(winNode->data_);
-        windowImpl->Render();
-        winNode = winNode->next_;
+    uint64_t startTime;
+    if (vsyncSource_ != nullptr) {
+        /* the task runs on every pass of the task handler, a frame starts on a vsync not drawn yet */
+        startTime = vsyncSource_->GetLastVsyncTime();
+        if (startTime == lastVsyncTime_) {
+            return;
+        }
+        lastVsyncTime_ = startTime;
+    } else {
+        startTime = VsyncSource::GetTime();
+    }
+    for (uint8_t i = 0; i < PHASE_NUM; i++) {
+        phaseTime_[i] = 0;
     }
+    frameFlushed_ = false;
+
+    UI_RENDER_TRACE_FRAME();
+    UI_RENDER_TRACE_SCOPE("Frame");
+#if ENABLE_WINDOW
+    RenderWindows();
 #else
     RootView::GetInstance()->Measure();
     RootView::GetInstance()->Render();
 #endif
+    EndFrame(startTime);
 
 #if ENABLE_FPS_SUPPORT
     UpdateFPS();
 #endif
 }
 
+uint64_t RenderManager::AddPhaseTime(FramePhase phase, uint64_t startTime)
+{
+    uint64_t curTime = VsyncSource::GetTime();
+    if (phase < PHASE_NUM) {
+        phaseTime_[phase] += static_cast<uint32_t>(curTime - startTime);
+        if (phase == PHASE_FLUSH) {
+            frameFlushed_ = true;
+        }
+    }
+    return curTime;
+}
+
+void RenderManager::EndFrame(uint64_t startTime)
+{
+    /* the passes with nothing to draw are not frames */
+    if (!frameFlushed_) {
+        return;
+    }
+    uint32_t budget = (vsyncSource_ != nullptr) ? vsyncSource_->GetPeriod() : period_ * US_PER_MS;
+    if (budget == 0) {
+        budget = DEFAULT_TASK_PERIOD * US_PER_MS;
+    }
+    uint32_t frameTime = static_cast<uint32_t>(VsyncSource::GetTime() - startTime);
+    frameStats_.frameNum++;
+    frameStats_.budget = budget;
+    frameStats_.frameTime = frameTime;
+    for (uint8_t i = 0; i < PHASE_NUM; i++) {
+        frameStats_.phaseTime[i] = phaseTime_[i];
+        if (phaseTime_[i] > frameStats_.maxPhaseTime[i]) {
+            frameStats_.maxPhaseTime[i] = phaseTime_[i];
+        }
+    }
+    if (frameTime > budget) {
+        frameStats_.jankNum++;
+        frameStats_.droppedNum += (frameTime - 1) / budget;
+    }
+    uint64_t percent = static_cast<uint64_t>(frameTime) * PERCENT / budget;
+    uint8_t bucket = 0;
+    while ((bucket < FRAME_HISTOGRAM_SIZE - 1) && (percent >= HISTOGRAM_BOUNDS[bucket])) {
+        bucket++;
+    }
+    frameStats_.histogram[bucket]++;
+    if (onFrameStatsListener_ != nullptr) {
+        onFrameStatsListener_->OnFrameStats(frameStats_);
+    }
+}
+
+void RenderManager::ResetFrameStats()
+{
+    frameStats_ = {};
+}
+
+void RenderManager::SetVsyncSource(VsyncSource* vsyncSource)
+{
+    if (vsyncSource_ == nullptr) {
+        taskPeriod_ = period_;
+    }
+    vsyncSource_ = vsyncSource;
+    lastVsyncTime_ = 0;
+    /* with a vsync source the vsyncs pace the frames instead of the task period */
+    SetPeriod((vsyncSource_ != nullptr) ? 0 : taskPeriod_);
+    needResetFPS_ = true;
+}
+
 #if ENABLE_FPS_SUPPORT
 void RenderManager::UpdateFPS()
 {
@@ -228,5 +329,87 @@ void RenderManager::RemoveFromDisplay(Window* window)
         winNode = winNode->next_;
     }
 }
+
+void RenderManager::RaiseToTop(Window* window)
+{
+    if (window == nullptr) {
+        return;
+    }
+    RemoveFromDisplay(window);
+    winList_.PushBack(window);
+}
+
+void RenderManager::LowerToBottom(Window* window)
+{
+    if (window == nullptr) {
+        return;
+    }
+    RemoveFromDisplay(window);
+    winList_.PushFront(window);
+}
+
+uint8_t RenderManager::GetWindowOccluders(ListNode<Window*>* winNode, Rect* occluders)
+{
+    Rect winRect = winNode->data_->GetRect();
+    uint8_t occluderNum = 0;
+    for (ListNode<Window*>* node = winNode->next_; node != winList_.End(); node = node->next_) {
+        WindowImpl* windowImpl = reinterpret_cast<WindowImpl*>(node->data_);
+        Rect common;
+        if (!windowImpl->IsShow() || !windowImpl->IsOpaque() || !common.Intersect(windowImpl->GetRect(), winRect)) {
+            continue;
+        }
+        /* relative to the window below, as its root view draws */
+        common.SetPosition(common.GetX() - winRect.GetX(), common.GetY() - winRect.GetY());
+        occluders[occluderNum++] = common;
+        if (occluderNum == RootView::MAX_WINDOW_OCCLUDER_NUM) {
+            break;
+        }
+    }
+    return occluderNum;
+}
+
+void RenderManager::RenderWindows()
+{
+    Rect occluders[RootView::MAX_WINDOW_OCCLUDER_NUM];
+    for (ListNode<Window*>* winNode = winList_.Begin(); winNode != winList_.End(); winNode = winNode->next_) {
+        WindowImpl* windowImpl = reinterpret_cast<WindowImpl*>(winNode->data_);
+        RootView* rootView = windowImpl->GetRootView();
+        if (rootView == nullptr) {
+            continue;
+        }
+        uint8_t occluderNum = GetWindowOccluders(winNode, occluders);
+        bool hidden = false;
+        if (!rootView->BeginComposite(occluders, occluderNum, hidden)) {
+            skippedWindowNum_ += hidden ? 1 : 0;
+            continue;
+        }
+        windowImpl->Render();
+    }
+
+    /* the windows drawn are flushed together once all of them are drawn */
+    uint64_t startTime = VsyncSource::GetTime();
+    Rect flushRect;
+    bool flushed = false;
+    for (ListNode<Window*>* winNode = winList_.Begin(); winNode != winList_.End(); winNode = winNode->next_) {
+        WindowImpl* windowImpl = reinterpret_cast<WindowImpl*>(winNode->data_);
+        RootView* rootView = windowImpl->GetRootView();
+        Rect rect;
+        if ((rootView == nullptr) || !rootView->FlushComposite(rect)) {
+            continue;
+        }
+        Rect winRect = windowImpl->GetRect();
+        rect.SetPosition(rect.GetX() + winRect.GetX(), rect.GetY() + winRect.GetY());
+        if (flushed) {
+            flushRect.Join(flushRect, rect);
+        } else {
+            flushRect = rect;
+            flushed = true;
+        }
+    }
+    if (flushed) {
+        BaseGfxEngine::GetInstance()->Flush(flushRect);
+        AddPhaseTime(PHASE_FLUSH, startTime);
+    }
+}
 #endif
 } // namespace OHOS
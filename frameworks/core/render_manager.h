@@ -17,6 +17,7 @@
 #define GRAPHIC_LITE_RENDER_MANAGER_H
 
 #include "common/task_manager.h"
+#include "common/vsync_source.h"
 #include "components/root_view.h"
 #include "components/ui_view.h"
 #include "gfx_utils/geometry2d.h"
@@ -36,6 +37,34 @@ static constexpr uint16_t MILLISECONDS_PER_SECOND = 1000;
 
 class RenderManager : public Task {
 public:
+    enum FramePhase : uint8_t {
+        PHASE_MEASURE,
+        PHASE_DRAW,
+        PHASE_FLUSH,
+        PHASE_NUM,
+    };
+
+    static constexpr uint8_t FRAME_HISTOGRAM_SIZE = 8;
+
+    /* the times are in microseconds, the budget is the vsync period, or the task period without a vsync source */
+    struct FrameStats {
+        uint32_t frameNum;
+        uint32_t jankNum; // frames which took longer than the budget
+        uint32_t droppedNum; // vsyncs missed by the janky frames
+        uint32_t budget;
+        uint32_t frameTime; // of the last frame, from its vsync to the end of its flush
+        uint32_t phaseTime[PHASE_NUM]; // of the last frame
+        uint32_t maxPhaseTime[PHASE_NUM];
+        /* frames by the part of the budget they took, under 25%, 50%, 75%, 100%, 150%, 200%, 300% and the rest */
+        uint32_t histogram[FRAME_HISTOGRAM_SIZE];
+    };
+
+    class OnFrameStatsListener : public HeapBase {
+    public:
+        /* Called after every frame drawn. */
+        virtual void OnFrameStats(const FrameStats& stats) = 0;
+    };
+
     static RenderManager& GetInstance();
 
     void Init() override;
@@ -67,10 +96,43 @@ public:
         needResetFPS_ = true;
     }
 
+    void RegisterFrameStatsListener(OnFrameStatsListener* onFrameStatsListener)
+    {
+        onFrameStatsListener_ = onFrameStatsListener;
+    }
+
+    const FrameStats& GetFrameStats() const
+    {
+        return frameStats_;
+    }
+
+    void ResetFrameStats();
+
+    /* Draws at most one frame per vsync of the source, nullptr draws one per task period. */
+    void SetVsyncSource(VsyncSource* vsyncSource);
+
+    VsyncSource* GetVsyncSource() const
+    {
+        return vsyncSource_;
+    }
+
+    /* Adds the time from startTime on to the phase of the current frame, returns the current time. */
+    uint64_t AddPhaseTime(FramePhase phase, uint64_t startTime);
+
 #if ENABLE_WINDOW
     void AddToDisplay(Window* window);
 
     void RemoveFromDisplay(Window* window);
+
+    void RaiseToTop(Window* window);
+
+    void LowerToBottom(Window* window);
+
+    /* Windows with damage not drawn because the opaque windows above them hide it. */
+    uint32_t GetSkippedWindowNum() const
+    {
+        return skippedWindowNum_;
+    }
 #endif
     static void RenderRect(const Rect& rect, RootView* rootView);
     void RefreshScreen();
@@ -80,6 +142,12 @@ private:
 
     ~RenderManager();
 
+    void EndFrame(uint64_t startTime);
+#if ENABLE_WINDOW
+    void RenderWindows();
+    uint8_t GetWindowOccluders(ListNode<Window*>* winNode, Rect* occluders);
+#endif
+
 #if ENABLE_FPS_SUPPORT
     void UpdateFPS();
 
@@ -103,8 +171,17 @@ private:
 
     SysInfo::OnFPSChangedListener* onFPSChangedListener_;
 
+    OnFrameStatsListener* onFrameStatsListener_;
+    VsyncSource* vsyncSource_;
+    uint64_t lastVsyncTime_;
+    uint32_t taskPeriod_; // restored when the vsync source is removed
+    uint32_t phaseTime_[PHASE_NUM]; // of the frame being drawn
+    bool frameFlushed_;
+    FrameStats frameStats_;
+
 #if ENABLE_WINDOW
-    List<Window*> winList_;
+    List<Window*> winList_; // from the bottom to the top
+    uint32_t skippedWindowNum_;
 #endif
 };
 } // namespace OHOS
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/dom_json_writer.h"
+
+#if ENABLE_DEBUG
+#include <cstring>
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint32_t FNV_PRIME = 16777619;
+constexpr uint8_t NUMBER_BUF_SIZE = 24;
+constexpr uint8_t MIN_PRINTABLE_CHAR = 0x20;
+} // namespace
+
+void DomJsonWriter::BeginObject(const char* key)
+{
+    WriteKey(key);
+    WriteChar('{');
+    needComma_ = false;
+}
+
+void DomJsonWriter::EndObject()
+{
+    WriteChar('}');
+    needComma_ = true;
+}
+
+void DomJsonWriter::BeginArray(const char* key)
+{
+    WriteKey(key);
+    WriteChar('[');
+    needComma_ = false;
+}
+
+void DomJsonWriter::EndArray()
+{
+    WriteChar(']');
+    needComma_ = true;
+}
+
+void DomJsonWriter::AddString(const char* key, const char* value)
+{
+    /* same as cJSON, a field without value is left out */
+    if (value == nullptr) {
+        return;
+    }
+    WriteKey(key);
+    WriteString(value);
+    needComma_ = true;
+}
+
+void DomJsonWriter::AddNumber(const char* key, int64_t value)
+{
+    char num[NUMBER_BUF_SIZE];
+    int32_t len = snprintf_s(num, sizeof(num), sizeof(num) - 1, "%lld", static_cast<long long>(value));
+    if (len < 0) {
+        error_ = true;
+        return;
+    }
+    WriteKey(key);
+    Write(num, len);
+    needComma_ = true;
+}
+
+void DomJsonWriter::AddBool(const char* key, bool value)
+{
+    WriteKey(key);
+    if (value) {
+        Write("true", 4); // 4: length of "true"
+    } else {
+        Write("false", 5); // 5: length of "false"
+    }
+    needComma_ = true;
+}
+
+bool DomJsonWriter::Finish()
+{
+    if (fd_ >= 0) {
+        Flush();
+    } else if ((buf_ != nullptr) && (size_ > 0)) {
+        buf_[used_] = '\0';
+    }
+    return !error_;
+}
+
+void DomJsonWriter::WriteKey(const char* key)
+{
+    if (needComma_) {
+        WriteChar(',');
+    }
+    if (key != nullptr) {
+        WriteString(key);
+        WriteChar(':');
+    }
+}
+
+void DomJsonWriter::WriteString(const char* str)
+{
+    WriteChar('"');
+    const char* start = str;
+    const char* cur = str;
+    for (; *cur != '\0'; cur++) {
+        uint8_t c = static_cast<uint8_t>(*cur);
+        if ((c >= MIN_PRINTABLE_CHAR) && (c != '"') && (c != '\\')) {
+            continue;
+        }
+        Write(start, cur - start);
+        start = cur + 1;
+        char escaped[7] = {'\\', static_cast<char>(c), '\0'}; // 7: "\u00XX" and '\0'
+        switch (c) {
+            case '\n':
+                escaped[1] = 'n';
+                break;
+            case '\r':
+                escaped[1] = 'r';
+                break;
+            case '\t':
+                escaped[1] = 't';
+                break;
+            case '\b':
+                escaped[1] = 'b';
+                break;
+            case '\f':
+                escaped[1] = 'f';
+                break;
+            case '"':
+            case '\\':
+                break;
+            default:
+                if (snprintf_s(escaped, sizeof(escaped), sizeof(escaped) - 1, "\\u%04x", c) < 0) {
+                    error_ = true;
+                    return;
+                }
+                break;
+        }
+        Write(escaped, strlen(escaped));
+    }
+    Write(start, cur - start);
+    WriteChar('"');
+}
+
+void DomJsonWriter::Write(const char* data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        hash_ = (hash_ ^ static_cast<uint8_t>(data[i])) * FNV_PRIME;
+    }
+    length_ += len;
+    if (error_) {
+        return;
+    }
+    if (fd_ >= 0) {
+        while (len > 0) {
+            if (used_ == STAGING_SIZE) {
+                Flush();
+                if (error_) {
+                    return;
+                }
+            }
+            uint32_t copyLen = MATH_MIN(len, STAGING_SIZE - used_);
+            if (memcpy_s(staging_ + used_, STAGING_SIZE - used_, data, copyLen) != EOK) {
+                error_ = true;
+                return;
+            }
+            used_ += copyLen;
+            data += copyLen;
+            len -= copyLen;
+        }
+    } else if (buf_ != nullptr) {
+        /* one byte is kept for the terminating '\0' */
+        if ((used_ + len >= size_) || (memcpy_s(buf_ + used_, size_ - used_, data, len) != EOK)) {
+            error_ = true;
+            return;
+        }
+        used_ += len;
+    }
+}
+
+void DomJsonWriter::Flush()
+{
+    if ((used_ == 0) || error_) {
+        return;
+    }
+    if (static_cast<uint32_t>(write(fd_, staging_, used_)) != used_) {
+        GRAPHIC_LOGE("DomJsonWriter::Flush write file failed Err!\n");
+        error_ = true;
+    }
+    used_ = 0;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
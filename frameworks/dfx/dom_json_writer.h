@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_DOM_JSON_WRITER_H
+#define GRAPHIC_LITE_DOM_JSON_WRITER_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/*
+ * Emits compact JSON while the DOM tree is walked, without building the tree in memory.
+ * The output goes to a file descriptor through a small staging buffer, to a bounded buffer, or nowhere at all.
+ * Whatever the target is, the length and a hash of the output are kept, so a writer without target can measure
+ * or fingerprint a piece of JSON.
+ */
+class DomJsonWriter : public HeapBase {
+public:
+    DomJsonWriter() : DomJsonWriter(-1, nullptr, 0) {}
+    explicit DomJsonWriter(int32_t fd) : DomJsonWriter(fd, nullptr, 0) {}
+    DomJsonWriter(char* buf, uint32_t size) : DomJsonWriter(-1, buf, size) {}
+    ~DomJsonWriter() {}
+
+    /* key is nullptr for the values in an array. */
+    void BeginObject(const char* key = nullptr);
+    void EndObject();
+    void BeginArray(const char* key = nullptr);
+    void EndArray();
+    void AddString(const char* key, const char* value);
+    void AddNumber(const char* key, int64_t value);
+    void AddBool(const char* key, bool value);
+
+    /* Flushes the staging buffer and terminates the bounded buffer, returns false if any output was lost. */
+    bool Finish();
+
+    /* Output bytes, the terminating '\0' of a bounded buffer not included. */
+    uint32_t GetLength() const
+    {
+        return length_;
+    }
+
+    uint32_t GetHash() const
+    {
+        return hash_;
+    }
+
+    bool HasError() const
+    {
+        return error_;
+    }
+
+private:
+    static constexpr uint16_t STAGING_SIZE = 512;
+    static constexpr uint32_t FNV_OFFSET_BASIS = 2166136261;
+
+    DomJsonWriter(int32_t fd, char* buf, uint32_t size)
+        : fd_(fd),
+          buf_(buf),
+          size_(size),
+          used_(0),
+          length_(0),
+          hash_(FNV_OFFSET_BASIS),
+          needComma_(false),
+          error_(false)
+    {
+    }
+
+    void WriteKey(const char* key);
+    void WriteString(const char* str);
+    void Write(const char* data, uint32_t len);
+    void WriteChar(char c)
+    {
+        Write(&c, 1);
+    }
+    void Flush();
+
+    int32_t fd_;
+    char* buf_;
+    uint32_t size_;
+    uint32_t used_;
+    uint32_t length_;
+    uint32_t hash_;
+    bool needComma_;
+    bool error_;
+    char staging_[STAGING_SIZE];
+};
+} // namespace OHOS
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_DOM_JSON_WRITER_H
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_render_trace.h"
+
+#if ENABLE_DEBUG
+#include <cstring>
+
+#include "components/ui_view.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "hal_tick.h"
+#include "securec.h"
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <pthread.h>
+#include <time.h>
+#endif
+
+namespace OHOS {
+namespace {
+constexpr uint32_t MAX_EVENT_NUM = 0x100000;
+constexpr uint16_t RECORD_BUFFER_SIZE = 256;
+constexpr uint32_t US_PER_MS = 1000;
+constexpr uint32_t US_PER_SECOND = 1000000;
+constexpr uint32_t NS_PER_US = 1000;
+const char* const TRACE_HEAD = "{\"traceEvents\":[\n";
+const char* const TRACE_TAIL = "\n],\"displayTimeUnit\":\"ms\"}\n";
+} // namespace
+
+std::atomic<bool> UIRenderTrace::tracing_(false);
+
+UIRenderTrace* UIRenderTrace::GetInstance()
+{
+    static UIRenderTrace instance;
+    return &instance;
+}
+
+UIRenderTrace::~UIRenderTrace()
+{
+    tracing_.store(false, std::memory_order_relaxed);
+    if (events_ != nullptr) {
+        delete[] events_;
+        events_ = nullptr;
+    }
+}
+
+bool UIRenderTrace::Start(uint32_t eventNum)
+{
+    if ((eventNum == 0) || (eventNum > MAX_EVENT_NUM)) {
+        return false;
+    }
+    tracing_.store(false, std::memory_order_relaxed);
+    uint32_t num = 1;
+    while (num < eventNum) {
+        num <<= 1;
+    }
+    if (num != eventNum_) {
+        if (events_ != nullptr) {
+            delete[] events_;
+        }
+        eventNum_ = 0;
+        events_ = new TraceEvent[num];
+        if (events_ == nullptr) {
+            GRAPHIC_LOGE("UIRenderTrace::Start new events failed");
+            return false;
+        }
+        eventNum_ = num;
+    }
+    for (uint32_t i = 0; i < eventNum_; i++) {
+        events_[i].seq.store(0, std::memory_order_relaxed);
+    }
+    writeIndex_.store(0, std::memory_order_relaxed);
+    frameIndex_.store(0, std::memory_order_relaxed);
+    tracing_.store(true, std::memory_order_release);
+    return true;
+}
+
+void UIRenderTrace::Stop()
+{
+    tracing_.store(false, std::memory_order_release);
+}
+
+uint64_t UIRenderTrace::GetTime()
+{
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    struct timespec time;
+    if (clock_gettime(CLOCK_MONOTONIC, &time) == 0) {
+        return static_cast<uint64_t>(time.tv_sec) * US_PER_SECOND + static_cast<uint64_t>(time.tv_nsec) / NS_PER_US;
+    }
+#endif
+    return static_cast<uint64_t>(HALTick::GetInstance().GetTime()) * US_PER_MS;
+}
+
+uint32_t UIRenderTrace::GetThreadId()
+{
+    uint32_t tid = 0;
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    pthread_t self = pthread_self();
+    // only the low bits are kept, which is enough to tell the threads apart in the trace
+    if (memcpy_s(&tid, sizeof(tid), &self, (sizeof(self) < sizeof(tid)) ? sizeof(self) : sizeof(tid)) != EOK) {
+        return 0;
+    }
+#endif
+    return tid;
+}
+
+void UIRenderTrace::AddEvent(const char* name, const UIView* view, uint64_t startTime)
+{
+    uint64_t endTime = GetTime();
+    if ((events_ == nullptr) || !IsTracing()) {
+        return;
+    }
+    /* every writer claims its own slot, so the ring needs no lock even with the image decoding threads */
+    uint32_t index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent& event = events_[index & (eventNum_ - 1)];
+    event.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.record.name = name;
+    event.record.start = startTime;
+    event.record.duration = static_cast<uint32_t>(endTime - startTime);
+    event.record.frame = frameIndex_.load(std::memory_order_relaxed);
+    event.record.tid = GetThreadId();
+    event.record.viewType = (view != nullptr) ? static_cast<uint8_t>(view->GetViewType()) : NO_VIEW;
+    event.seq.store(index + 1, std::memory_order_release);
+}
+
+bool UIRenderTrace::WriteRecord(int32_t fd, const TraceRecord& record, bool first)
+{
+    char buf[RECORD_BUFFER_SIZE];
+    const char* separator = first ? "" : ",\n";
+    int32_t len;
+    if (record.viewType < UI_NUMBER_MAX) {
+        len = snprintf_s(buf, sizeof(buf), sizeof(buf) - 1,
+                         "%s{\"name\":\"%s::%s\",\"cat\":\"view\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,"
+                         "\"pid\":0,\"tid\":%u,\"args\":{\"frame\":%u}}",
+                         separator, VIEW_TYPE_STRING[record.viewType], record.name,
+                         static_cast<unsigned long long>(record.start), record.duration, record.tid, record.frame);
+    } else {
+        len = snprintf_s(buf, sizeof(buf), sizeof(buf) - 1,
+                         "%s{\"name\":\"%s\",\"cat\":\"render\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%u,"
+                         "\"pid\":0,\"tid\":%u,\"args\":{\"frame\":%u}}",
+                         separator, record.name, static_cast<unsigned long long>(record.start), record.duration,
+                         record.tid, record.frame);
+    }
+    if (len < 0) {
+        return false;
+    }
+    return write(fd, buf, len) == len;
+}
+
+bool UIRenderTrace::DumpTrace(const char* path, uint32_t startFrame, uint32_t endFrame) const
+{
+    if ((path == nullptr) || (events_ == nullptr)) {
+        return false;
+    }
+    int32_t fd = open(path, O_CREAT | O_RDWR | O_TRUNC, DEFAULT_FILE_PERMISSION);
+    if (fd < 0) {
+        GRAPHIC_LOGE("UIRenderTrace::DumpTrace open file failed");
+        return false;
+    }
+    int32_t headLen = static_cast<int32_t>(strlen(TRACE_HEAD));
+    bool ret = (write(fd, TRACE_HEAD, headLen) == headLen);
+
+    uint32_t end = writeIndex_.load(std::memory_order_acquire);
+    uint32_t begin = (end > eventNum_) ? (end - eventNum_) : 0;
+    bool first = true;
+    for (uint32_t i = begin; ret && (i != end); i++) {
+        const TraceEvent& event = events_[i & (eventNum_ - 1)];
+        if (event.seq.load(std::memory_order_acquire) != i + 1) {
+            continue;
+        }
+        TraceRecord record = event.record;
+        // the slot may have been reused while it was copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (event.seq.load(std::memory_order_relaxed) != i + 1) {
+            continue;
+        }
+        if ((record.frame < startFrame) || (record.frame > endFrame)) {
+            continue;
+        }
+        ret = WriteRecord(fd, record, first);
+        first = false;
+    }
+
+    int32_t tailLen = static_cast<int32_t>(strlen(TRACE_TAIL));
+    ret = ret && (write(fd, TRACE_TAIL, tailLen) == tailLen);
+    if (close(fd) < 0) {
+        return false;
+    }
+    if (!ret) {
+        GRAPHIC_LOGE("UIRenderTrace::DumpTrace write file failed");
+    }
+    return ret;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
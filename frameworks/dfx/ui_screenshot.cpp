@@ -17,12 +17,21 @@
 #if ENABLE_DEBUG
 #include "iwindows_manager.h"
 #include "common/screen.h"
+#include "components/root_view.h"
 #include "draw/draw_utils.h"
+#include "engines/gfx/gfx_engine_manager.h"
 #include "gfx_utils/color.h"
 #include "gfx_utils/file.h"
 #include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
 #include "gfx_utils/image_info.h"
 #include "securec.h"
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <pthread.h>
+#define ENABLE_ASYNC_SCREEN_CAPTURE 1
+#else
+#define ENABLE_ASYNC_SCREEN_CAPTURE 0
+#endif
 
 namespace OHOS {
 class UIScreenshotListener : public IWindowsManager::ScreenshotListener {
@@ -127,12 +136,386 @@ private:
     }
 };
 
+/*
+ * Copies areas of the framebuffer into a ring of preallocated buffers on the render thread, and converts them to
+ * ARGB8888 and writes them on a writer thread, so a capture costs the render thread a copy of the area only.
+ */
+class UIScreenCapturer : public RootView::OnFlushListener {
+public:
+    UIScreenCapturer()
+        : bufferNum_(DEFAULT_BUFFER_NUM),
+          bufferSize_(0),
+          head_(0),
+          tail_(0),
+          convertBuffer_(nullptr),
+          frameFd_(-1),
+          frameIndex_(0),
+          droppedNum_(0),
+          quit_(false),
+          writerStarted_(false)
+    {
+        for (uint8_t i = 0; i < MAX_BUFFER_NUM; i++) {
+            slots_[i] = {nullptr, nullptr, {}, 0, 0, false};
+        }
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_mutex_init(&lock_, nullptr);
+        pthread_cond_init(&cond_, nullptr);
+#endif
+    }
+
+    virtual ~UIScreenCapturer()
+    {
+        Lock();
+        quit_ = true;
+        Notify();
+        Unlock();
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        if (writerStarted_) {
+            pthread_join(writer_, nullptr);
+        }
+#endif
+        if (frameFd_ >= 0) {
+            close(frameFd_);
+            frameFd_ = -1;
+        }
+        for (uint8_t i = 0; i < MAX_BUFFER_NUM; i++) {
+            UIFree(reinterpret_cast<void*>(slots_[i].pixels));
+            UIFree(reinterpret_cast<void*>(slots_[i].path));
+        }
+        UIFree(reinterpret_cast<void*>(convertBuffer_));
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_cond_destroy(&cond_);
+        pthread_mutex_destroy(&lock_);
+#endif
+    }
+
+    void SetBufferNum(uint8_t bufferNum)
+    {
+        if ((slots_[0].pixels == nullptr) && (bufferNum > 0)) {
+            bufferNum_ = MATH_MIN(bufferNum, static_cast<uint8_t>(MAX_BUFFER_NUM));
+        }
+    }
+
+    uint32_t GetDroppedNum() const
+    {
+        return droppedNum_;
+    }
+
+    bool Capture(const Rect& rect, const char* path, uint32_t frame)
+    {
+        BufferInfo* fbBufferInfo = BaseGfxEngine::GetInstance()->GetFBBufferInfo();
+        if ((fbBufferInfo == nullptr) || (fbBufferInfo->virAddr == nullptr) || !IsSupported(fbBufferInfo->mode) ||
+            !AllocBuffers(*fbBufferInfo)) {
+            return false;
+        }
+        Rect area;
+        Rect screenRect(0, 0, fbBufferInfo->width - 1, fbBufferInfo->height - 1);
+        if (!area.Intersect(rect, screenRect)) {
+            return false;
+        }
+        uint8_t pxBytes = DrawUtils::GetByteSizeByColorMode(fbBufferInfo->mode);
+        uint32_t rowSize = area.GetWidth() * pxBytes;
+        if (rowSize * area.GetHeight() > bufferSize_) {
+            return false;
+        }
+
+        Lock();
+        CaptureSlot& slot = slots_[head_];
+        bool busy = slot.filled;
+        Unlock();
+        if (busy) {
+            droppedNum_++;
+            return false;
+        }
+        if (path != nullptr) {
+            uint32_t pathLength = strlen(path) + 1;
+            slot.path = static_cast<char*>(UIMalloc(pathLength));
+            if ((slot.path == nullptr) || (strcpy_s(slot.path, pathLength, path) != EOK)) {
+                UIFree(reinterpret_cast<void*>(slot.path));
+                slot.path = nullptr;
+                return false;
+            }
+        }
+        const uint8_t* src = static_cast<const uint8_t*>(fbBufferInfo->virAddr) +
+                             area.GetTop() * fbBufferInfo->stride + area.GetLeft() * pxBytes;
+        uint8_t* dst = slot.pixels;
+        for (int16_t y = area.GetTop(); y <= area.GetBottom(); y++) {
+            if (memcpy_s(dst, rowSize, src, rowSize) != EOK) {
+                UIFree(reinterpret_cast<void*>(slot.path));
+                slot.path = nullptr;
+                return false;
+            }
+            src += fbBufferInfo->stride;
+            dst += rowSize;
+        }
+        slot.rect = area;
+        slot.frame = frame;
+        slot.mode = fbBufferInfo->mode;
+
+        if (!writerStarted_) {
+            WriteSlot(slot);
+            return true;
+        }
+        Lock();
+        slot.filled = true;
+        head_ = (head_ + 1) % bufferNum_;
+        Notify();
+        Unlock();
+        return true;
+    }
+
+    bool StartFrameCapture(const char* path)
+    {
+        StopFrameCapture();
+        unlink(path);
+        int32_t fd = open(path, O_RDWR | O_CREAT, DEFAULT_FILE_PERMISSION);
+        if (fd < 0) {
+            GRAPHIC_LOGE("UIScreenCapturer::StartFrameCapture open file failed Err!\n");
+            return false;
+        }
+        frameFd_ = fd;
+        frameIndex_ = 0;
+        RootView::GetInstance()->SetOnFlushListener(this);
+        return true;
+    }
+
+    void StopFrameCapture()
+    {
+        if (frameFd_ < 0) {
+            return;
+        }
+        RootView::GetInstance()->ClearOnFlushListener();
+        WaitFinished();
+        close(frameFd_);
+        frameFd_ = -1;
+    }
+
+    void WaitFinished()
+    {
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_mutex_lock(&lock_);
+        while (writerStarted_ && slots_[tail_].filled) {
+            pthread_cond_wait(&cond_, &lock_);
+        }
+        pthread_mutex_unlock(&lock_);
+#endif
+    }
+
+    void OnFlush(const Rect& flushRect) override
+    {
+        if (frameFd_ >= 0) {
+            Capture(flushRect, nullptr, frameIndex_++);
+        }
+    }
+
+private:
+    static constexpr uint8_t DEFAULT_BUFFER_NUM = 3;
+    static constexpr uint8_t MAX_BUFFER_NUM = 8;
+    static constexpr uint16_t CONVERT_BLOCK_SIZE = 2048; // unit: 4 bytes
+    static constexpr uint8_t ARGB8888_SIZE = 4;
+
+    struct CaptureSlot {
+        uint8_t* pixels;
+        char* path; // nullptr for a frame of the frame capture
+        Rect rect;
+        uint32_t frame;
+        uint8_t mode;
+        bool filled;
+    };
+
+    static bool IsSupported(uint8_t mode)
+    {
+        return (mode == ARGB8888) || (mode == RGB888) || (mode == RGB565) || (mode == ARGB1555);
+    }
+
+    void Lock()
+    {
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_mutex_lock(&lock_);
+#endif
+    }
+
+    void Unlock()
+    {
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_mutex_unlock(&lock_);
+#endif
+    }
+
+    void Notify()
+    {
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        pthread_cond_broadcast(&cond_);
+#endif
+    }
+
+    bool AllocBuffers(const BufferInfo& fbBufferInfo)
+    {
+        if (slots_[0].pixels != nullptr) {
+            return true;
+        }
+        /* large enough for the screen in any supported color mode */
+        bufferSize_ = fbBufferInfo.width * fbBufferInfo.height * ARGB8888_SIZE;
+        uint32_t convertSize = MATH_MAX(static_cast<uint32_t>(CONVERT_BLOCK_SIZE), fbBufferInfo.width) * ARGB8888_SIZE;
+        convertBuffer_ = static_cast<uint32_t*>(UIMalloc(convertSize));
+        for (uint8_t i = 0; (i < bufferNum_) && (convertBuffer_ != nullptr); i++) {
+            slots_[i].pixels = static_cast<uint8_t*>(UIMalloc(bufferSize_));
+            if (slots_[i].pixels == nullptr) {
+                /* fewer buffers are still a ring */
+                bufferNum_ = i;
+                break;
+            }
+        }
+        if ((convertBuffer_ == nullptr) || (bufferNum_ == 0)) {
+            GRAPHIC_LOGE("UIScreenCapturer::AllocBuffers memory allocation failed Err!");
+            UIFree(reinterpret_cast<void*>(convertBuffer_));
+            convertBuffer_ = nullptr;
+            bufferNum_ = DEFAULT_BUFFER_NUM;
+            return false;
+        }
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+        writerStarted_ = (pthread_create(&writer_, nullptr, WriterMain, this) == 0);
+        if (!writerStarted_) {
+            GRAPHIC_LOGE("UIScreenCapturer create writer failed, captures are written synchronously");
+        }
+#endif
+        return true;
+    }
+
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+    static void* WriterMain(void* arg)
+    {
+        static_cast<UIScreenCapturer*>(arg)->WriteLoop();
+        return nullptr;
+    }
+
+    void WriteLoop()
+    {
+        pthread_mutex_lock(&lock_);
+        while (true) {
+            CaptureSlot& slot = slots_[tail_];
+            if (!slot.filled) {
+                if (quit_) {
+                    break;
+                }
+                pthread_cond_wait(&cond_, &lock_);
+                continue;
+            }
+            pthread_mutex_unlock(&lock_);
+            WriteSlot(slot);
+            pthread_mutex_lock(&lock_);
+            slot.filled = false;
+            tail_ = (tail_ + 1) % bufferNum_;
+            pthread_cond_broadcast(&cond_);
+        }
+        pthread_mutex_unlock(&lock_);
+    }
+#endif
+
+    void WriteSlot(CaptureSlot& slot)
+    {
+        uint16_t width = slot.rect.GetWidth();
+        uint16_t height = slot.rect.GetHeight();
+        if (slot.path == nullptr) {
+            UIScreenshot::CaptureFrameHeader header = {slot.frame, slot.rect.GetLeft(), slot.rect.GetTop(), width,
+                                                       height};
+            if ((write(frameFd_, &header, sizeof(header)) != sizeof(header)) || !WritePixels(frameFd_, slot)) {
+                GRAPHIC_LOGE("UIScreenCapturer::WriteSlot write frame failed Err!");
+            }
+            return;
+        }
+        unlink(slot.path);
+        int32_t fd = open(slot.path, O_RDWR | O_CREAT, DEFAULT_FILE_PERMISSION);
+        UIFree(reinterpret_cast<void*>(slot.path));
+        slot.path = nullptr;
+        if (fd < 0) {
+            GRAPHIC_LOGE("UIScreenCapturer::WriteSlot open file failed Err!\n");
+            return;
+        }
+        ImageHeader header = {0};
+        header.colorMode = ARGB8888;
+        header.width = width;
+        header.height = height;
+        if ((write(fd, &header, sizeof(ImageHeader)) != sizeof(ImageHeader)) || !WritePixels(fd, slot)) {
+            GRAPHIC_LOGE("UIScreenCapturer::WriteSlot write file failed Err!");
+        }
+        close(fd);
+    }
+
+    bool WritePixels(int32_t fd, const CaptureSlot& slot) const
+    {
+        uint32_t width = slot.rect.GetWidth();
+        uint32_t height = slot.rect.GetHeight();
+        if (slot.mode == ARGB8888) {
+            uint32_t size = width * height * ARGB8888_SIZE;
+            return static_cast<uint32_t>(write(fd, slot.pixels, size)) == size;
+        }
+        uint32_t blockRow = MATH_MAX(CONVERT_BLOCK_SIZE / width, 1u);
+        uint8_t pxBytes = DrawUtils::GetByteSizeByColorMode(slot.mode);
+        const uint8_t* src = slot.pixels;
+        for (uint32_t row = 0; row < height; row += blockRow) {
+            uint32_t pixelNum = MATH_MIN(blockRow, height - row) * width;
+            for (uint32_t i = 0; i < pixelNum; i++) {
+                convertBuffer_[i] = ToARGB8888(src, slot.mode);
+                src += pxBytes;
+            }
+            uint32_t size = pixelNum * ARGB8888_SIZE;
+            if (static_cast<uint32_t>(write(fd, convertBuffer_, size)) != size) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static uint32_t ToARGB8888(const uint8_t* pixel, uint8_t mode)
+    {
+        Color32 color;
+        color.alpha = OPA_OPAQUE;
+        if (mode == RGB888) {
+            const Color24* color24 = reinterpret_cast<const Color24*>(pixel);
+            color.red = color24->red;
+            color.green = color24->green;
+            color.blue = color24->blue;
+        } else if (mode == RGB565) {
+            const Color16* color16 = reinterpret_cast<const Color16*>(pixel);
+            // 3, 2: widen the 5 and 6 bit channels to 8 bits
+            color.red = (color16->red << 3) | (color16->red >> 2);
+            color.green = (color16->green << 2) | (color16->green >> 4); // 4: 6 bit channel
+            color.blue = (color16->blue << 3) | (color16->blue >> 2);
+        } else {
+            return PixelFormatUtils::ARGB1555ToARGB8888(*reinterpret_cast<const uint16_t*>(pixel));
+        }
+        return color.full;
+    }
+
+    CaptureSlot slots_[MAX_BUFFER_NUM];
+    uint8_t bufferNum_;
+    uint32_t bufferSize_;
+    uint8_t head_; // next slot to fill
+    uint8_t tail_; // next slot to write
+    uint32_t* convertBuffer_;
+    int32_t frameFd_;
+    uint32_t frameIndex_;
+    uint32_t droppedNum_;
+    bool quit_;
+    bool writerStarted_;
+#if ENABLE_ASYNC_SCREEN_CAPTURE
+    pthread_mutex_t lock_;
+    pthread_cond_t cond_;
+    pthread_t writer_;
+#endif
+};
+
 UIScreenshot::~UIScreenshot()
 {
     if (screenshotListener_ != nullptr) {
         delete screenshotListener_;
         screenshotListener_ = nullptr;
     }
+    if (screenCapturer_ != nullptr) {
+        delete screenCapturer_;
+        screenCapturer_ = nullptr;
+    }
 }
 
 UIScreenshot* UIScreenshot::GetInstance()
@@ -168,5 +551,60 @@ bool UIScreenshot::ScreenshotToFile(const char* path)
     IWindowsManager::GetInstance()->Screenshot();
     return true;
 }
+
+bool UIScreenshot::InitCapturer()
+{
+    if (screenCapturer_ == nullptr) {
+        screenCapturer_ = new UIScreenCapturer();
+        if (screenCapturer_ == nullptr) {
+            GRAPHIC_LOGE("UIScreenshot::InitCapturer create screen capturer failed Err!\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UIScreenshot::ScreenshotRectToFile(const Rect& rect, const char* path)
+{
+    if (!InitCapturer()) {
+        return false;
+    }
+    const char* destPath = (path == nullptr) ? DEFAULT_SCREENSHOT_PATH : path;
+    return screenCapturer_->Capture(rect, destPath, 0);
+}
+
+bool UIScreenshot::StartFrameCapture(const char* path)
+{
+    if ((path == nullptr) || !InitCapturer()) {
+        return false;
+    }
+    return screenCapturer_->StartFrameCapture(path);
+}
+
+void UIScreenshot::StopFrameCapture()
+{
+    if (screenCapturer_ != nullptr) {
+        screenCapturer_->StopFrameCapture();
+    }
+}
+
+void UIScreenshot::WaitCaptureFinished()
+{
+    if (screenCapturer_ != nullptr) {
+        screenCapturer_->WaitFinished();
+    }
+}
+
+uint32_t UIScreenshot::GetDroppedCaptureNum() const
+{
+    return (screenCapturer_ != nullptr) ? screenCapturer_->GetDroppedNum() : 0;
+}
+
+void UIScreenshot::SetCaptureBufferNum(uint8_t bufferNum)
+{
+    if (InitCapturer()) {
+        screenCapturer_->SetBufferNum(bufferNum);
+    }
+}
 } // namespace OHOS
 #endif // ENABLE_DEBUG
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dock/focus_index.h"
+#if ENABLE_FOCUS_MANAGER
+#include <algorithm>
+#include <functional>
+
+#include "components/ui_view_group.h"
+#include "dock/focus_manager.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "gfx_utils/mem_api.h"
+
+namespace OHOS {
+namespace {
+/* a rect turned so that the direction is up: the candidates are above the focused view, the nearest lowest */
+struct Box {
+    int32_t left;
+    int32_t top;
+    int32_t right;
+    int32_t bottom;
+};
+
+Box ToBox(const Rect& rect, uint8_t direction)
+{
+    switch (direction) {
+        case FOCUS_DIRECTION_DOWN:
+            return {rect.GetLeft(), -rect.GetBottom(), rect.GetRight(), -rect.GetTop()};
+        case FOCUS_DIRECTION_LEFT:
+            return {rect.GetTop(), rect.GetLeft(), rect.GetBottom(), rect.GetRight()};
+        case FOCUS_DIRECTION_RIGHT:
+            return {rect.GetTop(), -rect.GetRight(), rect.GetBottom(), -rect.GetLeft()};
+        default:
+            return {rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom()};
+    }
+}
+
+uint64_t GetDistance(int32_t xDiff, int32_t yDiff)
+{
+    return static_cast<uint64_t>(static_cast<int64_t>(xDiff) * xDiff) +
+           static_cast<uint64_t>(static_cast<int64_t>(yDiff) * yDiff);
+}
+} // namespace
+
+struct FocusIndex::Query {
+    uint8_t direction;
+    Box focused;
+    int16_t cornerX;
+    int16_t cornerY;
+    const Node* focusedNode;
+    const Node* scope;
+    const Entry* best;
+    int32_t bestEdge;
+    uint64_t bestDistance;
+};
+
+void FocusIndex::Clear()
+{
+    if (nodes_ != nullptr) {
+        UIFree(nodes_);
+        nodes_ = nullptr;
+    }
+    if (entries_ != nullptr) {
+        UIFree(entries_);
+        entries_ = nullptr;
+    }
+    if (bounds_ != nullptr) {
+        UIFree(bounds_);
+        bounds_ = nullptr;
+    }
+    root_ = nullptr;
+    nodeNum_ = 0;
+    entryNum_ = 0;
+}
+
+bool FocusIndex::Build(UIView* root)
+{
+    Clear();
+    if (root == nullptr) {
+        return false;
+    }
+    nodeNum_ = CountViews(root);
+    nodes_ = static_cast<Node*>(UIMalloc(sizeof(Node) * nodeNum_));
+    entries_ = static_cast<Entry*>(UIMalloc(sizeof(Entry) * nodeNum_));
+    if ((nodes_ == nullptr) || (entries_ == nullptr)) {
+        GRAPHIC_LOGE("FocusIndex::Build UIMalloc fail");
+        Clear();
+        return false;
+    }
+    uint32_t order = 0;
+    AddViews(root, 0, 0, order);
+    std::sort(nodes_, nodes_ + nodeNum_,
+              [](const Node& a, const Node& b) { return std::less<UIView*>()(a.view, b.view); });
+    if (entryNum_ > 0) {
+        bounds_ = static_cast<Bounds*>(UIMalloc(sizeof(Bounds) * entryNum_));
+        if (bounds_ == nullptr) {
+            GRAPHIC_LOGE("FocusIndex::Build UIMalloc fail");
+            Clear();
+            return false;
+        }
+        BuildTree(0, entryNum_, true);
+    }
+    root_ = root;
+    return true;
+}
+
+uint32_t FocusIndex::CountViews(UIView* view) const
+{
+    uint32_t num = 1;
+    if (view->IsViewGroup()) {
+        for (UIView* child = static_cast<UIViewGroup*>(view)->GetChildrenHead(); child != nullptr;
+             child = child->GetNextSibling()) {
+            num += CountViews(child);
+        }
+    }
+    return num;
+}
+
+void FocusIndex::AddViews(UIView* view, uint16_t depth, uint16_t blockDepth, uint32_t& order)
+{
+    uint32_t index = order++;
+    Node& node = nodes_[index];
+    node.view = view;
+    node.order = index;
+    node.depth = depth;
+    bool focusable = view->IsVisible() && view->IsFocusable();
+    Entry* entry = nullptr;
+    if (focusable && (!view->IsViewGroup() || static_cast<UIViewGroup*>(view)->IsInterceptFocus())) {
+        entry = &entries_[entryNum_++];
+        entry->view = view;
+        entry->rect = view->GetRect();
+        entry->order = index;
+        entry->blockDepth = blockDepth;
+    }
+    if (view->IsViewGroup()) {
+        /* the scan skips the children of a group not focusable or intercepting the focus, unless it is a parent */
+        uint16_t childBlockDepth = ((entry != nullptr) || !focusable) ? depth : blockDepth;
+        for (UIView* child = static_cast<UIViewGroup*>(view)->GetChildrenHead(); child != nullptr;
+             child = child->GetNextSibling()) {
+            AddViews(child, depth + 1, childBlockDepth, order);
+        }
+    }
+    node.last = order - 1;
+    if (entry != nullptr) {
+        entry->last = order - 1;
+    }
+}
+
+void FocusIndex::BuildTree(uint32_t begin, uint32_t end, bool splitX)
+{
+    if (begin >= end) {
+        return;
+    }
+    uint32_t mid = begin + (end - begin) / 2; // 2: split at the median
+    std::nth_element(entries_ + begin, entries_ + mid, entries_ + end, [splitX](const Entry& a, const Entry& b) {
+        return splitX ? (a.rect.GetLeft() < b.rect.GetLeft()) : (a.rect.GetTop() < b.rect.GetTop());
+    });
+    BuildTree(begin, mid, !splitX);
+    BuildTree(mid + 1, end, !splitX);
+    UpdateBounds(begin, end);
+}
+
+void FocusIndex::UpdateRects(const UIView* viewGroup)
+{
+    const Node* node = FindNode(viewGroup);
+    if ((node == nullptr) || (node->last == node->order)) {
+        return;
+    }
+    UpdateTree(0, entryNum_, node->order + 1, node->last);
+}
+
+void FocusIndex::UpdateTree(uint32_t begin, uint32_t end, uint32_t first, uint32_t last)
+{
+    if (begin >= end) {
+        return;
+    }
+    uint32_t mid = begin + (end - begin) / 2; // 2: split at the median
+    if ((bounds_[mid].maxOrder < first) || (bounds_[mid].minOrder > last)) {
+        return;
+    }
+    /* the split is kept, the searches only rely on the bounds */
+    UpdateTree(begin, mid, first, last);
+    UpdateTree(mid + 1, end, first, last);
+    Entry& entry = entries_[mid];
+    if ((entry.order >= first) && (entry.order <= last)) {
+        entry.rect = entry.view->GetRect();
+    }
+    UpdateBounds(begin, end);
+}
+
+void FocusIndex::UpdateBounds(uint32_t begin, uint32_t end)
+{
+    uint32_t mid = begin + (end - begin) / 2; // 2: split at the median
+    const Entry& entry = entries_[mid];
+    Bounds& bounds = bounds_[mid];
+    bounds.rect = entry.rect;
+    bounds.minOrder = entry.order;
+    bounds.maxOrder = entry.order;
+    bounds.minBlockDepth = entry.blockDepth;
+    uint32_t children[] = {begin + (mid - begin) / 2, mid + 1 + (end - mid - 1) / 2}; // 2: the medians of the halves
+    for (uint32_t child : children) {
+        if ((child == mid) || (child >= end)) {
+            continue;
+        }
+        bounds.rect.Join(bounds.rect, bounds_[child].rect);
+        bounds.minOrder = MATH_MIN(bounds.minOrder, bounds_[child].minOrder);
+        bounds.maxOrder = MATH_MAX(bounds.maxOrder, bounds_[child].maxOrder);
+        bounds.minBlockDepth = MATH_MIN(bounds.minBlockDepth, bounds_[child].minBlockDepth);
+    }
+}
+
+const FocusIndex::Node* FocusIndex::FindNode(const UIView* view) const
+{
+    const Node* node = std::lower_bound(nodes_, nodes_ + nodeNum_, view, [](const Node& a, const UIView* b) {
+        return std::less<const UIView*>()(a.view, b);
+    });
+    return ((node != nodes_ + nodeNum_) && (node->view == view)) ? node : nullptr;
+}
+
+bool FocusIndex::GetNextFocus(UIView* focusedView, UIView*& candidate, uint8_t direction) const
+{
+    if ((direction > FOCUS_DIRECTION_DOWN) || (entryNum_ == 0)) {
+        return false;
+    }
+    Query query = {};
+    query.focusedNode = FindNode(focusedView);
+    if (query.focusedNode == nullptr) {
+        return false;
+    }
+    Rect rect = focusedView->GetRect();
+    query.direction = direction;
+    query.focused = ToBox(rect, direction);
+    query.cornerX = rect.GetLeft();
+    query.cornerY = rect.GetTop();
+    for (UIView* parent = focusedView->GetParent(); parent != nullptr; parent = parent->GetParent()) {
+        query.scope = FindNode(parent);
+        if (query.scope == nullptr) {
+            return false;
+        }
+        SearchInLine(query, 0, entryNum_, true);
+        if (query.best == nullptr) {
+            SearchNearest(query, 0, entryNum_, true);
+        }
+        if (query.best != nullptr) {
+            candidate = query.best->view;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FocusIndex::IsCandidate(const Query& query, const Entry& entry) const
+{
+    const Node& scope = *query.scope;
+    const Node& focused = *query.focusedNode;
+    if ((entry.order <= scope.order) || (entry.order > scope.last) || (entry.blockDepth > scope.depth)) {
+        return false;
+    }
+    /* neither the focused view, a parent of it nor a child of it */
+    return ((focused.order < entry.order) || (focused.order > entry.last)) &&
+           ((entry.order < focused.order) || (entry.order > focused.last));
+}
+
+bool FocusIndex::IsOutOfScope(const Query& query, const Bounds& bounds) const
+{
+    return (bounds.maxOrder <= query.scope->order) || (bounds.minOrder > query.scope->last) ||
+           (bounds.minBlockDepth > query.scope->depth);
+}
+
+void FocusIndex::SearchInLine(Query& query, uint32_t begin, uint32_t end, bool splitX) const
+{
+    if (begin >= end) {
+        return;
+    }
+    uint32_t mid = begin + (end - begin) / 2; // 2: the median, as built
+    const Bounds& bounds = bounds_[mid];
+    Box box = ToBox(bounds.rect, query.direction);
+    const Box& focused = query.focused;
+    if (IsOutOfScope(query, bounds) || (box.top >= focused.bottom) || (box.left >= focused.right) ||
+        (box.right <= focused.left)) {
+        return;
+    }
+    int32_t edge = MATH_MIN(box.bottom, focused.bottom - 1);
+    if ((query.best != nullptr) &&
+        ((edge < query.bestEdge) || ((edge == query.bestEdge) && (bounds.minOrder > query.best->order)))) {
+        return;
+    }
+
+    const Entry& entry = entries_[mid];
+    if (IsCandidate(query, entry)) {
+        Box entryBox = ToBox(entry.rect, query.direction);
+        if ((entryBox.bottom < focused.bottom) && (entryBox.left < focused.right) && (entryBox.right > focused.left) &&
+            ((query.best == nullptr) || (entryBox.bottom > query.bestEdge) ||
+             ((entryBox.bottom == query.bestEdge) && (entry.order < query.best->order)))) {
+            query.best = &entry;
+            query.bestEdge = entryBox.bottom;
+        }
+    }
+    /* the half on the side of the focused view first */
+    bool lowFirst = splitX ? (query.cornerX < entry.rect.GetLeft()) : (query.cornerY < entry.rect.GetTop());
+    if (lowFirst) {
+        SearchInLine(query, begin, mid, !splitX);
+        SearchInLine(query, mid + 1, end, !splitX);
+    } else {
+        SearchInLine(query, mid + 1, end, !splitX);
+        SearchInLine(query, begin, mid, !splitX);
+    }
+}
+
+void FocusIndex::SearchNearest(Query& query, uint32_t begin, uint32_t end, bool splitX) const
+{
+    if (begin >= end) {
+        return;
+    }
+    uint32_t mid = begin + (end - begin) / 2; // 2: the median, as built
+    const Bounds& bounds = bounds_[mid];
+    if (IsOutOfScope(query, bounds) || (ToBox(bounds.rect, query.direction).top >= query.focused.bottom)) {
+        return;
+    }
+    /* the top left corners of the entries are in the bounds */
+    const Rect& rect = bounds.rect;
+    int32_t xDiff = (query.cornerX < rect.GetLeft()) ? (rect.GetLeft() - query.cornerX) :
+                    ((query.cornerX > rect.GetRight()) ? (query.cornerX - rect.GetRight()) : 0);
+    int32_t yDiff = (query.cornerY < rect.GetTop()) ? (rect.GetTop() - query.cornerY) :
+                    ((query.cornerY > rect.GetBottom()) ? (query.cornerY - rect.GetBottom()) : 0);
+    uint64_t distance = GetDistance(xDiff, yDiff);
+    if ((query.best != nullptr) && ((distance > query.bestDistance) ||
+                                    ((distance == query.bestDistance) && (bounds.minOrder > query.best->order)))) {
+        return;
+    }
+
+    const Entry& entry = entries_[mid];
+    if (IsCandidate(query, entry) && (ToBox(entry.rect, query.direction).bottom < query.focused.bottom)) {
+        distance = GetDistance(query.cornerX - entry.rect.GetLeft(), query.cornerY - entry.rect.GetTop());
+        if ((query.best == nullptr) || (distance < query.bestDistance) ||
+            ((distance == query.bestDistance) && (entry.order < query.best->order))) {
+            query.best = &entry;
+            query.bestDistance = distance;
+        }
+    }
+    bool lowFirst = splitX ? (query.cornerX < entry.rect.GetLeft()) : (query.cornerY < entry.rect.GetTop());
+    if (lowFirst) {
+        SearchNearest(query, begin, mid, !splitX);
+        SearchNearest(query, mid + 1, end, !splitX);
+    } else {
+        SearchNearest(query, mid + 1, end, !splitX);
+        SearchNearest(query, begin, mid, !splitX);
+    }
+}
+} // namespace OHOS
+#endif
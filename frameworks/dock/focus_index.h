@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_FOCUS_INDEX_H
+#define GRAPHIC_LITE_FOCUS_INDEX_H
+
+#include "graphic_config.h"
+#if ENABLE_FOCUS_MANAGER
+#include "components/ui_view.h"
+
+namespace OHOS {
+/*
+ * Keeps the focusable views under a root in a kd-tree of their rects, so the next view to focus in a direction is
+ * found without visiting every view. The candidates are the ones FocusManager scans: the visible and focusable views
+ * whose view groups are visible and focusable, a group intercepting the focus standing for its children. As for the
+ * scan, the closest parent of the focused view holding a candidate in the direction is searched first. In it the
+ * views in line with the focused view come first, the nearest edge first, then the others by the distance of their
+ * top left corners. The index is built again when the views change, except for the moves of the children of a view
+ * group, as a scroll does, after which only the rects under the view group are updated.
+ */
+class FocusIndex : public HeapBase {
+public:
+    FocusIndex() : root_(nullptr), nodes_(nullptr), nodeNum_(0), entries_(nullptr), bounds_(nullptr), entryNum_(0) {}
+    ~FocusIndex()
+    {
+        Clear();
+    }
+
+    bool Build(UIView* root);
+
+    void Clear();
+
+    UIView* GetRoot() const
+    {
+        return root_;
+    }
+
+    uint32_t GetEntryNum() const
+    {
+        return entryNum_;
+    }
+
+    bool Contains(const UIView* view) const
+    {
+        return FindNode(view) != nullptr;
+    }
+
+    void UpdateRects(const UIView* viewGroup);
+
+    bool GetNextFocus(UIView* focusedView, UIView*& candidate, uint8_t direction) const;
+
+private:
+    /* every view under the root, sorted by address, order and last bound the orders of the views under it */
+    struct Node {
+        UIView* view;
+        uint32_t order;
+        uint32_t last;
+        uint16_t depth;
+    };
+
+    /* a candidate, blockDepth is the depth of its closest parent which hides it from the scan */
+    struct Entry {
+        UIView* view;
+        Rect rect;
+        uint32_t order;
+        uint32_t last;
+        uint16_t blockDepth;
+    };
+
+    /* the entries under a node of the kd-tree */
+    struct Bounds {
+        Rect rect;
+        uint32_t minOrder;
+        uint32_t maxOrder;
+        uint16_t minBlockDepth;
+    };
+
+    struct Query;
+
+    FocusIndex(const FocusIndex&) = delete;
+    FocusIndex& operator=(const FocusIndex&) = delete;
+    FocusIndex(FocusIndex&&) = delete;
+    FocusIndex& operator=(FocusIndex&&) = delete;
+
+    uint32_t CountViews(UIView* view) const;
+    void AddViews(UIView* view, uint16_t depth, uint16_t blockDepth, uint32_t& order);
+    void BuildTree(uint32_t begin, uint32_t end, bool splitX);
+    void UpdateTree(uint32_t begin, uint32_t end, uint32_t first, uint32_t last);
+    void UpdateBounds(uint32_t begin, uint32_t end);
+    const Node* FindNode(const UIView* view) const;
+    void SearchInLine(Query& query, uint32_t begin, uint32_t end, bool splitX) const;
+    void SearchNearest(Query& query, uint32_t begin, uint32_t end, bool splitX) const;
+    bool IsCandidate(const Query& query, const Entry& entry) const;
+    bool IsOutOfScope(const Query& query, const Bounds& bounds) const;
+
+    UIView* root_;
+    Node* nodes_;
+    uint32_t nodeNum_;
+    Entry* entries_;
+    Bounds* bounds_;
+    uint32_t entryNum_;
+};
+} // namespace OHOS
+#endif
+#endif // GRAPHIC_LITE_FOCUS_INDEX_H
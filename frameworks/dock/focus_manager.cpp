@@ -16,17 +16,67 @@
 #include "dock/focus_manager.h"
 #if ENABLE_FOCUS_MANAGER
 #include "components/root_view.h"
+#include "dock/focus_index.h"
 #include "gfx_utils/graphic_math.h"
 
 #include "common/input_method_manager.h"
 
 namespace OHOS {
+FocusIndex* FocusManager::index_ = nullptr;
+bool FocusManager::indexDirty_ = true;
+const UIView* FocusManager::movingGroup_ = nullptr;
+uint32_t FocusManager::indexBuildNum_ = 0;
+
 FocusManager* FocusManager::GetInstance()
 {
     static FocusManager instance;
     return &instance;
 }
 
+FocusManager::~FocusManager()
+{
+    if (index_ != nullptr) {
+        delete index_;
+        index_ = nullptr;
+    }
+}
+
+void FocusManager::InvalidateIndex(const UIView* view, bool moved)
+{
+    if (indexDirty_ || (index_ == nullptr) || (view == nullptr)) {
+        return;
+    }
+    /* the rects of the children of a moving group are updated in the index when the move ends */
+    if (moved && (movingGroup_ != nullptr) && (view->GetParent() == movingGroup_)) {
+        return;
+    }
+    /* the views of other roots or not added yet are not in the index */
+    if (index_->Contains(view)) {
+        indexDirty_ = true;
+    }
+}
+
+void FocusManager::BeginMoveChildren(const UIView* viewGroup)
+{
+    if (movingGroup_ != nullptr) {
+        /* a move started by the listeners of another one is not tracked */
+        indexDirty_ = true;
+        return;
+    }
+    movingGroup_ = viewGroup;
+}
+
+void FocusManager::EndMoveChildren(const UIView* viewGroup)
+{
+    if ((viewGroup == nullptr) || (movingGroup_ != viewGroup)) {
+        return;
+    }
+    movingGroup_ = nullptr;
+    if (!indexDirty_ && (index_ != nullptr) && index_->Contains(viewGroup)) {
+        index_->UpdateRects(viewGroup);
+    }
+}
+
 bool FocusManager::RequestFocus(UIView* view)
 {
     if (view == nullptr || view == focusView_ || !view->IsFocusable() ||
@@ -109,7 +159,7 @@ bool FocusManager::IsAtSameCol(const Rect& rect1, const Rect& rect2)
 
 bool FocusManager::IsAtSameRow(const Rect& rect1, const Rect& rect2)
 {
-    return ((rect1.GetBottom() < rect2.GetTop()) && (rect1.GetTop() > rect2.GetBottom()));
+    return ((rect1.GetTop() < rect2.GetBottom()) && (rect1.GetBottom() > rect2.GetTop()));
 }
 
 bool FocusManager::CompareCandidatesByUp(UIView* focusedView, UIView*& candidate, UIView* current)
@@ -197,6 +247,23 @@ bool FocusManager::GetNextFocus(UIView* focusedView, UIView*& candidate, uint8_t
     if (parent == nullptr) {
         return false;
     }
+    /* answered by the index of the root of the focused view, built again if the views changed since */
+    UIView* root = parent;
+    while (root->GetParent() != nullptr) {
+        root = root->GetParent();
+    }
+    if (index_ == nullptr) {
+        index_ = new FocusIndex();
+    }
+    if ((index_ != nullptr) && (indexDirty_ || (index_->GetRoot() != root))) {
+        indexDirty_ = !index_->Build(root);
+        indexBuildNum_++;
+    }
+    if ((index_ != nullptr) && !indexDirty_) {
+        return index_->GetNextFocus(focusedView, candidate, direction);
+    }
+
+    /* scan the views if the index could not be built */
     UIView* child = nullptr;
     bool isFoundBestCandidate = false;
     UIView* current = focusedView;
@@ -15,6 +15,7 @@
 
 #include "draw/draw_image.h"
 
+#include "common/ui_arena.h"
 #include "gfx_utils/color.h"
 #include "gfx_utils/graphic_log.h"
 #include "imgdecode/cache_manager.h"
@@ -59,7 +60,9 @@ void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const R
         if (width <= 0) {
             return;
         }
-        uint8_t* buf = static_cast<uint8_t*>(UIMalloc(static_cast<uint32_t>(width) * ((COLOR_DEPTH >> SHIFT_3) + 1)));
+        /* given back when the frame is flushed */
+        uint8_t* buf = static_cast<uint8_t*>(
+            UIFrameAllocator::GetInstance()->Allocate(static_cast<uint32_t>(width) * ((COLOR_DEPTH >> SHIFT_3) + 1)));
         if (buf == nullptr) {
             return;
         }
@@ -72,7 +75,6 @@ void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const R
         for (int16_t row = valid.GetTop(); row <= valid.GetBottom(); row++) {
             if (entry.ReadLine(start, width, buf) != RetCode::OK) {
                 CacheManager::GetInstance().Close(path);
-                UIFree(buf);
                 return;
             }
             DrawUtils::GetInstance()->DrawImage(gfxDstBuffer, line, mask, buf, opa, pxBitSize,
@@ -81,7 +83,6 @@ void DrawImage::DrawCommon(BufferInfo& gfxDstBuffer, const Rect& coords, const R
             line.SetBottom(line.GetBottom() + 1);
             start.y++;
         }
-        UIFree(buf);
     }
 }
 } // namespace OHOS
@@ -17,6 +17,7 @@
 #include <cstdio>
 #include "common/typed_text.h"
 #include "draw/draw_utils.h"
+#include "draw/rotated_glyph_cache.h"
 #include "engines/gfx/gfx_engine_manager.h"
 #include "font/ui_font.h"
 #include "font/ui_font_header.h"
@@ -39,12 +40,11 @@ uint16_t DrawLabel::DrawTextOneLine(BufferInfo& gfxDstBuffer, const LabelLineInf
     uint32_t i = 0;
     uint16_t retOffsetY = 0; // ret value elipse offsetY
     uint16_t offsetPosY = 0;
-    uint8_t maxLetterSize = GetLineMaxLetterSize(labelLine.text, labelLine.lineLength, labelLine.fontId,
-                                                 labelLine.fontSize, letterIndex, labelLine.sizeSpans);
+    uint8_t maxLetterSize = GetLineMaxLetterSize(labelLine, letterIndex);
     DrawLineBackgroundColor(gfxDstBuffer, letterIndex, labelLine);
     GlyphNode glyphNode;
-    while (i < labelLine.lineLength) {
-        uint32_t letter = TypedText::GetUTF8Next(labelLine.text, i, i);
+    uint32_t letter;
+    while (GetNextLetter(labelLine, i, letter)) {
         uint16_t fontId = labelLine.fontId;
         uint8_t fontSize = labelLine.fontSize;
         if (labelLine.sizeSpans != nullptr && labelLine.sizeSpans[letterIndex].isSizeSpan) {
@@ -86,7 +86,8 @@ uint16_t DrawLabel::DrawTextOneLine(BufferInfo& gfxDstBuffer, const LabelLineInf
         glyphNode.textStyle = letterInfo.textStyle;
 #endif
         glyphNode.advance = 0;
-        uint8_t* fontMap = fontEngine->GetBitmap(letterInfo.letter, glyphNode, letterInfo.fontId, letterInfo.fontSize,
+        /* other threads may add glyphs to the font cache meanwhile, the bitmap is pinned until it is drawn */
+        uint8_t* fontMap = fontEngine->PinBitmap(letterInfo.letter, glyphNode, letterInfo.fontId, letterInfo.fontSize,
                                                  letterInfo.shapingId);
         if (fontMap != nullptr) {
             uint8_t weight = UIFont::GetInstance()->GetFontWeight(glyphNode.fontId);
@@ -98,6 +99,7 @@ uint16_t DrawLabel::DrawTextOneLine(BufferInfo& gfxDstBuffer, const LabelLineInf
                 retOffsetY = offsetPosY;
                 DrawUtils::GetInstance()->DrawNormalLetter(gfxDstBuffer, letterInfo, fontMap, glyphNode, maxLetterSize);
             }
+            fontEngine->UnpinBitmap(fontMap);
         }
         if (labelLine.direct == TEXT_DIRECT_RTL) {
             labelLine.pos.x -= (glyphNode.advance + labelLine.style.letterSpace_);
@@ -110,21 +112,37 @@ uint16_t DrawLabel::DrawTextOneLine(BufferInfo& gfxDstBuffer, const LabelLineInf
     return retOffsetY;
 }
 
-uint8_t DrawLabel::GetLineMaxLetterSize(const char* text, uint16_t lineLength, uint16_t fontId, uint8_t fontSize,
-                                        uint16_t letterIndex, SizeSpan* sizeSpans)
+bool DrawLabel::GetNextLetter(const LabelLineInfo& labelLine, uint32_t& i, uint32_t& letter)
 {
+    if (labelLine.codePoints != nullptr) {
+        if (i >= labelLine.codePointNum) {
+            return false;
+        }
+        letter = labelLine.codePoints[i++];
+        return true;
+    }
+    if (i >= labelLine.lineLength) {
+        return false;
+    }
+    letter = TypedText::GetUTF8Next(labelLine.text, i, i);
+    return true;
+}
+
+uint8_t DrawLabel::GetLineMaxLetterSize(const LabelLineInfo& labelLine, uint16_t letterIndex)
+{
+    SizeSpan* sizeSpans = labelLine.sizeSpans;
     if (sizeSpans == nullptr) {
-        return fontSize;
+        return labelLine.fontSize;
     }
     uint32_t i = 0;
-    uint8_t maxLetterSize = fontSize;
-    while (i < lineLength) {
-        uint32_t unicode = TypedText::GetUTF8Next(text, i, i);
-        if (TypedText::IsColourWord(unicode, fontId, fontSize)) {
+    uint32_t unicode;
+    uint8_t maxLetterSize = labelLine.fontSize;
+    while (GetNextLetter(labelLine, i, unicode)) {
+        if (TypedText::IsColourWord(unicode, labelLine.fontId, labelLine.fontSize)) {
             letterIndex++;
             continue;
         }
-        if (sizeSpans != nullptr && sizeSpans[letterIndex].isSizeSpan) {
+        if (sizeSpans[letterIndex].isSizeSpan) {
             uint8_t tempSize = sizeSpans[letterIndex].size;
             if (tempSize > maxLetterSize) {
                 maxLetterSize = tempSize;
@@ -189,6 +207,61 @@ void DrawLabel::DrawArcText(BufferInfo& gfxDstBuffer,
     }
 }
 
+uint16_t DrawLabel::GetArcLetters(const char* text, uint16_t fontId, uint8_t fontSize, const ArcTextInfo arcTextInfo,
+                                  TextOrientation orientation, const Style& style, bool compatibilityMode,
+                                  ArcLetterInfo* letters, uint16_t letterNum)
+{
+    if ((text == nullptr) || (arcTextInfo.lineStart == arcTextInfo.lineEnd) || (arcTextInfo.radius == 0)) {
+        return 0;
+    }
+    uint16_t letterHeight = UIFont::GetInstance()->GetHeight(fontId, fontSize);
+    uint32_t i = arcTextInfo.lineStart;
+    float angle = arcTextInfo.startAngle;
+    float rotateAngle;
+    bool orientationFlag = (orientation == TextOrientation::INSIDE);
+    bool directFlag = (arcTextInfo.direct == TEXT_DIRECT_LTR);
+    bool xorFlag = !((orientationFlag && directFlag) || (!orientationFlag && !directFlag));
+    Point center = {0, 0};
+    uint16_t count = 0;
+    while (i < arcTextInfo.lineEnd) {
+        uint32_t tmp = i;
+        uint32_t letter = TypedText::GetUTF8Next(text, tmp, i);
+        if (letter == 0) {
+            continue;
+        }
+        if ((letter == '\r') || (letter == '\n')) {
+            break;
+        }
+        uint16_t letterWidth = UIFont::GetInstance()->GetWidth(letter, fontId, fontSize, 0);
+        ArcLetterInfo info = {letter, 0, 0, 0};
+        if (!DrawLabel::CalculateAngle(letterWidth, letterHeight, style.letterSpace_, arcTextInfo, xorFlag, tmp,
+                                       orientation, info.posX, info.posY, rotateAngle, angle, center,
+                                       compatibilityMode)) {
+            continue;
+        }
+        if ((letters != nullptr) && (count < letterNum)) {
+            info.rotateAngle = static_cast<int16_t>(rotateAngle);
+            letters[count] = info;
+        }
+        count++;
+    }
+    return count;
+}
+
+void DrawLabel::DrawArcLetters(BufferInfo& gfxDstBuffer, const Rect& mask, const ArcLetterInfo* letters,
+                               uint16_t letterNum, const Point& arcCenter, uint16_t fontId, uint8_t fontSize,
+                               const Style& style, uint8_t opaScale, bool compatibilityMode)
+{
+    if ((letters == nullptr) || (DrawUtils::GetMixOpacity(opaScale, style.textOpa_) == OPA_TRANSPARENT)) {
+        return;
+    }
+    for (uint16_t i = 0; i < letterNum; i++) {
+        Point pos = {MATH_ROUND(arcCenter.x + letters[i].posX), MATH_ROUND(arcCenter.y + letters[i].posY)};
+        DrawLetterWithRotate(gfxDstBuffer, mask, fontId, fontSize, letters[i].letter, pos, letters[i].rotateAngle,
+                             style.textColor_, opaScale, compatibilityMode);
+    }
+}
+
 bool DrawLabel::CalculateAngle(uint16_t letterWidth,
                                uint16_t letterHeight,
                                int16_t letterSpace,
@@ -249,6 +322,20 @@ void DrawLabel::DrawLetterWithRotate(BufferInfo& gfxDstBuffer,
                                      OpacityType opaScale,
                                      bool compatibilityMode)
 {
+    /* the same letter at the same angle is blended from the cache */
+    const RotatedGlyphCache::Glyph* glyph =
+        RotatedGlyphCache::GetInstance().GetGlyph(letter, fontId, fontSize, rotateAngle, compatibilityMode);
+    if (glyph != nullptr) {
+        Rect fontRect = glyph->rect;
+        fontRect.SetPosition(pos.x + glyph->rect.GetX(), pos.y + glyph->rect.GetY());
+        Rect subRect;
+        if (subRect.Intersect(fontRect, mask)) {
+            BaseGfxEngine::GetInstance()->DrawLetter(gfxDstBuffer, glyph->alpha, fontRect, subRect, FONT_WEIGHT_8,
+                                                     color, opaScale);
+        }
+        return;
+    }
+
     UIFont* fontEngine = UIFont::GetInstance();
     FontHeader head;
     GlyphNode node;
@@ -259,7 +346,7 @@ void DrawLabel::DrawLetterWithRotate(BufferInfo& gfxDstBuffer,
         return;
     }
 
-    const uint8_t* fontMap = fontEngine->GetBitmap(letter, node, fontId, fontSize, 0);
+    uint8_t* fontMap = fontEngine->PinBitmap(letter, node, fontId, fontSize, 0);
     if (fontMap == nullptr) {
         return;
     }
@@ -276,6 +363,7 @@ void DrawLabel::DrawLetterWithRotate(BufferInfo& gfxDstBuffer,
                                             BlurLevel::LEVEL0, TransformAlgorithm::BILINEAR};
     BaseGfxEngine::GetInstance()->DrawTransform(gfxDstBuffer, mask, Point { 0, 0 }, color, opaScale, transMap,
                                                 letterTranDataInfo);
+    fontEngine->UnpinBitmap(fontMap);
 }
 
 void DrawLabel::GetLineBackgroundColor(uint16_t letterIndex, List<LineBackgroundColor>* linebackgroundColor,
@@ -327,8 +415,8 @@ void DrawLabel::GetForegroundColor(uint16_t letterIndex, List<ForegroundColor>*
 void DrawLabel::DrawLineBackgroundColor(BufferInfo& gfxDstBuffer, uint16_t letterIndex, const LabelLineInfo& labelLine)
 {
     uint32_t i = 0;
-    while (i < labelLine.lineLength) {
-        TypedText::GetUTF8Next(labelLine.text, i, i);
+    uint32_t letter;
+    while (GetNextLetter(labelLine, i, letter)) {
         bool havelinebackground = false;
         ColorType linebackgroundColor;
         GetLineBackgroundColor(letterIndex, labelLine.linebackgroundColor, havelinebackground, linebackgroundColor);
@@ -23,6 +23,14 @@
 #include "gfx_utils/style.h"
 
 namespace OHOS {
+/* a letter of an arc text placed by DrawLabel::GetArcLetters, its position is relative to the arc center */
+struct ArcLetterInfo {
+    uint32_t letter;
+    float posX;
+    float posY;
+    int16_t rotateAngle;
+};
+
 class DrawLabel : public HeapBase {
 public:
     static uint16_t DrawTextOneLine(BufferInfo& gfxDstBuffer, const LabelLineInfo& labelLine,
@@ -32,6 +40,15 @@ public:
                             uint16_t fontId, uint8_t fontSize, const ArcTextInfo arcTextInfo,
                             TextOrientation orientation, const Style& style, uint8_t opaScale, bool compatibilityMode);
 
+    /* Places the letters of an arc text, returns the number of letters even if more than letterNum. */
+    static uint16_t GetArcLetters(const char* text, uint16_t fontId, uint8_t fontSize, const ArcTextInfo arcTextInfo,
+                                  TextOrientation orientation, const Style& style, bool compatibilityMode,
+                                  ArcLetterInfo* letters, uint16_t letterNum);
+
+    static void DrawArcLetters(BufferInfo& gfxDstBuffer, const Rect& mask, const ArcLetterInfo* letters,
+                               uint16_t letterNum, const Point& arcCenter, uint16_t fontId, uint8_t fontSize,
+                               const Style& style, uint8_t opaScale, bool compatibilityMode);
+
     static bool CalculateAngle(uint16_t letterWidth,
                                uint16_t letterHeight,
                                int16_t letterSpace,
@@ -57,8 +74,7 @@ public:
                                      OpacityType opaScale,
                                      bool compatibilityMode);
 
-    static uint8_t GetLineMaxLetterSize(const char* text, uint16_t lineLength, uint16_t fontId, uint8_t fontSize,
-                                        uint16_t letterIndex, SizeSpan* sizeSpans);
+    static uint8_t GetLineMaxLetterSize(const LabelLineInfo& labelLine, uint16_t letterIndex);
     static void GetLineBackgroundColor(uint16_t letterIndex, List<LineBackgroundColor>* linebackgroundColor,
                                        bool& havelinebackground, ColorType& linebgColor);
     static void GetBackgroundColor(uint16_t letterIndex, List<BackgroundColor>* backgroundColor,
@@ -66,6 +82,10 @@ public:
     static void GetForegroundColor(uint16_t letterIndex, List<ForegroundColor>* foregroundColor, ColorType& fgColor);
     static void DrawLineBackgroundColor(BufferInfo& gfxDstBuffer, uint16_t letterIndex,
                                         const LabelLineInfo& labelLine);
+
+private:
+    /* Steps i over the next letter of the line, from its code points when they are decoded. */
+    static bool GetNextLetter(const LabelLineInfo& labelLine, uint32_t& i, uint32_t& letter);
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_DRAW_LABEL_H
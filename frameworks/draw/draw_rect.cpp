@@ -18,9 +18,160 @@
 #include "engines/gfx/gfx_engine_manager.h"
 #include "gfx_utils/graphic_log.h"
 #include "gfx_utils/graphic_math.h"
+#include "gfx_utils/mem_api.h"
 #include "gfx_utils/style.h"
 
 namespace OHOS {
+namespace {
+/* the masks of larger corners take too much memory, such corners are drawn by DrawArc */
+constexpr int16_t MAX_CORNER_MASK_RADIUS = 64;
+constexpr uint8_t CORNER_MASK_CACHE_SIZE = 8;
+constexpr float HALF_PIXEL = 0.5f;
+
+/*
+ * Coverage of the top left corner of a rounded rect, the other corners are mirrored from it.
+ * The map of the background and the map of the border are both radius * radius.
+ */
+struct CornerMask {
+    int16_t radius;
+    int16_t borderWidth;
+    uint32_t lastUse;
+    uint8_t* covers;
+};
+CornerMask g_cornerMasks[CORNER_MASK_CACHE_SIZE] = {};
+uint32_t g_cornerMaskUse = 0;
+
+inline uint8_t GetCoverage(float radius, float distance)
+{
+    float coverage = radius - distance + HALF_PIXEL;
+    if (coverage <= 0) {
+        return OPA_TRANSPARENT;
+    }
+    return (coverage >= 1) ? OPA_OPAQUE : static_cast<uint8_t>(coverage * OPA_OPAQUE);
+}
+
+void BuildCornerMask(CornerMask& mask)
+{
+    int16_t radius = mask.radius;
+    int16_t innerRadius = radius - mask.borderWidth;
+    uint8_t* bgCovers = mask.covers;
+    uint8_t* borderCovers = mask.covers + radius * radius;
+    for (int16_t row = 0; row < radius; row++) {
+        float dy = radius - row - HALF_PIXEL;
+        for (int16_t col = 0; col < radius; col++) {
+            float dx = radius - col - HALF_PIXEL;
+            float distance = Sqrt(dx * dx + dy * dy);
+            uint8_t outer = GetCoverage(radius, distance);
+            uint8_t inner = GetCoverage(innerRadius, distance);
+            bgCovers[row * radius + col] = inner;
+            borderCovers[row * radius + col] = outer - inner;
+        }
+    }
+}
+
+const CornerMask* GetCornerMask(int16_t radius, int16_t borderWidth)
+{
+    g_cornerMaskUse++;
+    CornerMask* victim = &g_cornerMasks[0];
+    for (uint8_t i = 0; i < CORNER_MASK_CACHE_SIZE; i++) {
+        CornerMask& mask = g_cornerMasks[i];
+        if ((mask.covers != nullptr) && (mask.radius == radius) && (mask.borderWidth == borderWidth)) {
+            mask.lastUse = g_cornerMaskUse;
+            return &mask;
+        }
+        if ((victim->covers != nullptr) && ((mask.covers == nullptr) || (mask.lastUse < victim->lastUse))) {
+            victim = &mask;
+        }
+    }
+    UIFree(victim->covers);
+    /* 2: the background map and the border map */
+    victim->covers = static_cast<uint8_t*>(UIMalloc(2 * radius * radius));
+    if (victim->covers == nullptr) {
+        return nullptr;
+    }
+    victim->radius = radius;
+    victim->borderWidth = borderWidth;
+    victim->lastUse = g_cornerMaskUse;
+    BuildCornerMask(*victim);
+    return victim;
+}
+} // namespace
+
+void DrawRect::ClearCornerMasks()
+{
+    for (uint8_t i = 0; i < CORNER_MASK_CACHE_SIZE; i++) {
+        UIFree(g_cornerMasks[i].covers);
+        g_cornerMasks[i].covers = nullptr;
+    }
+}
+
+bool DrawRect::DrawRectByCornerMasks(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
+                                     const Style& style, OpacityType opaScale)
+{
+    // 2 : half
+    int16_t radius = MATH_MIN(style.borderRadius_, MATH_MIN(rect.GetWidth(), rect.GetHeight()) / 2);
+    int16_t borderWidth = style.borderWidth_;
+    if ((radius > MAX_CORNER_MASK_RADIUS) || (borderWidth > radius)) {
+        return false;
+    }
+    const CornerMask* cornerMask = GetCornerMask(radius, borderWidth);
+    if (cornerMask == nullptr) {
+        return false;
+    }
+    int16_t left = rect.GetLeft();
+    int16_t top = rect.GetTop();
+    int16_t right = rect.GetRight();
+    int16_t bottom = rect.GetBottom();
+    OpacityType opa = DrawUtils::GetMixOpacity(opaScale, style.borderOpa_);
+    OpacityType opaBg = DrawUtils::GetMixOpacity(opaScale, style.bgOpa_);
+    DrawUtils* drawUtils = DrawUtils::GetInstance();
+
+    // draw corners, the border is blended over the anti-aliased edge of the background
+    const uint8_t* bgCovers = cornerMask->covers;
+    const uint8_t* borderCovers = cornerMask->covers + radius * radius;
+    Rect corners[] = {Rect(left, top, left + radius - 1, top + radius - 1),
+                      Rect(right - radius + 1, top, right, top + radius - 1),
+                      Rect(left, bottom - radius + 1, left + radius - 1, bottom),
+                      Rect(right - radius + 1, bottom - radius + 1, right, bottom)};
+    for (uint8_t i = 0; i < sizeof(corners) / sizeof(corners[0]); i++) {
+        bool mirrorX = (i & 0x1) != 0;
+        bool mirrorY = (i & 0x2) != 0;
+        drawUtils->DrawCoverage(gfxDstBuffer, corners[i], dirtyRect, bgCovers, mirrorX, mirrorY, style.bgColor_,
+                                opaBg);
+        if (borderWidth > 0) {
+            drawUtils->DrawCoverage(gfxDstBuffer, corners[i], dirtyRect, borderCovers, mirrorX, mirrorY,
+                                    style.borderColor_, opa);
+        }
+    }
+
+    // draw top and bottom rectangles between the corners
+    int16_t bandLeft = left + radius;
+    int16_t bandRight = right - radius;
+    if (borderWidth > 0) {
+        Rect topBorderRect(bandLeft, top, bandRight, top + borderWidth - 1);
+        drawUtils->DrawColorArea(gfxDstBuffer, topBorderRect, dirtyRect, style.borderColor_, opa);
+        Rect bottomBorderRect(bandLeft, bottom - borderWidth + 1, bandRight, bottom);
+        drawUtils->DrawColorArea(gfxDstBuffer, bottomBorderRect, dirtyRect, style.borderColor_, opa);
+    }
+    Rect topInnerRect(bandLeft, top + borderWidth, bandRight, top + radius - 1);
+    drawUtils->DrawColorArea(gfxDstBuffer, topInnerRect, dirtyRect, style.bgColor_, opaBg);
+    Rect bottomInnerRect(bandLeft, bottom - radius + 1, bandRight, bottom - borderWidth);
+    drawUtils->DrawColorArea(gfxDstBuffer, bottomInnerRect, dirtyRect, style.bgColor_, opaBg);
+
+    // draw middle rectangles
+    int16_t middleTop = top + radius;
+    int16_t middleBottom = bottom - radius;
+    if (borderWidth > 0) {
+        Rect leftBorderRect(left, middleTop, left + borderWidth - 1, middleBottom);
+        drawUtils->DrawColorArea(gfxDstBuffer, leftBorderRect, dirtyRect, style.borderColor_, opa);
+        Rect rightBorderRect(right - borderWidth + 1, middleTop, right, middleBottom);
+        drawUtils->DrawColorArea(gfxDstBuffer, rightBorderRect, dirtyRect, style.borderColor_, opa);
+    }
+    Rect middleInnerRect(left + borderWidth, middleTop, right - borderWidth, middleBottom);
+    drawUtils->DrawColorArea(gfxDstBuffer, middleInnerRect, dirtyRect, style.bgColor_, opaBg);
+    return true;
+}
+
 void DrawRect::Draw(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                     const Style& style, OpacityType opaScale)
 {
@@ -82,6 +233,9 @@ void DrawRect::Draw(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirt
 void DrawRect::DrawRectRadiusWithoutBorder(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                                            const Style& style, OpacityType opaScale)
 {
+    if (DrawRectByCornerMasks(gfxDstBuffer, rect, dirtyRect, style, opaScale)) {
+        return;
+    }
     // 2 : half
     if ((rect.GetWidth() > rect.GetHeight()) && (style.borderRadius_ >= rect.GetHeight() / 2)) {
         DrawRectRadiusWithoutBorderCon1(gfxDstBuffer, rect, dirtyRect, style, opaScale);
@@ -293,6 +447,9 @@ void DrawRect::DrawRectBorderWithoutRadius(BufferInfo& gfxDstBuffer, const Rect&
 void DrawRect::DrawRectRadiusEqualBorder(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                                          const Style& style, OpacityType opaScale)
 {
+    if (DrawRectByCornerMasks(gfxDstBuffer, rect, dirtyRect, style, opaScale)) {
+        return;
+    }
     int16_t col1X = rect.GetLeft();
     int16_t col2X = rect.GetLeft() + style.borderRadius_ - 1;
     int16_t col3X = rect.GetRight() - style.borderRadius_ + 1;
@@ -442,6 +599,9 @@ void DrawRect::DrawRectRadiusSmallThanBorder(BufferInfo& gfxDstBuffer, const Rec
 void DrawRect::DrawRectRadiusBiggerThanBorder(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                                               const Style& style, OpacityType opaScale)
 {
+    if (DrawRectByCornerMasks(gfxDstBuffer, rect, dirtyRect, style, opaScale)) {
+        return;
+    }
     // 2 : half
     if ((rect.GetWidth() > rect.GetHeight()) && (style.borderRadius_ >= rect.GetHeight() / 2)) {
         DrawRectRadiusBiggerThanBorderCon1(gfxDstBuffer, rect, dirtyRect, style, opaScale);
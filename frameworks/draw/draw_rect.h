@@ -32,7 +32,13 @@ public:
     static void Draw(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                      const Style& style, OpacityType opaScale);
 
+    /* Frees the cached corner coverage masks. */
+    static void ClearCornerMasks();
+
 private:
+    static bool DrawRectByCornerMasks(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
+                                      const Style& style, OpacityType opaScale);
+
     static void DrawRectRadiusWithoutBorder(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& dirtyRect,
                                             const Style& style, OpacityType opaScale);
 
@@ -482,6 +482,53 @@ void DrawUtils::DrawLetter(BufferInfo& gfxDstBuffer,
     }
 }
 
+void DrawUtils::DrawCoverage(BufferInfo& gfxDstBuffer,
+                             const Rect& area,
+                             const Rect& mask,
+                             const uint8_t* covers,
+                             bool mirrorX,
+                             bool mirrorY,
+                             const ColorType& color,
+                             OpacityType opa) const
+{
+    if (covers == nullptr) {
+        return;
+    }
+    Rect maskedArea;
+    if (!maskedArea.Intersect(area, mask)) {
+        return;
+    }
+    DRAW_UTILS_PREPROCESS(gfxDstBuffer, opa);
+    Color32 fillColor;
+    fillColor.full = Color::ColorTo32(color);
+    int16_t coversWidth = area.GetWidth();
+    int16_t colStart = maskedArea.GetLeft() - area.GetLeft();
+    /* the columns of a mirrored map are read backwards */
+    int16_t colStep = mirrorX ? -1 : 1;
+    if (mirrorX) {
+        colStart = coversWidth - 1 - colStart;
+    }
+    for (int16_t y = maskedArea.GetTop(); y <= maskedArea.GetBottom(); y++) {
+        int16_t row = y - area.GetTop();
+        if (mirrorY) {
+            row = area.GetHeight() - 1 - row;
+        }
+        const uint8_t* cover = covers + row * coversWidth + colStart;
+        uint8_t* dst = screenBuffer + (y * screenBufferWidth + maskedArea.GetLeft()) * bufferPxSize;
+        for (int16_t x = maskedArea.GetLeft(); x <= maskedArea.GetRight(); x++) {
+            OpacityType coverOpa = *cover;
+            if (coverOpa != OPA_TRANSPARENT) {
+                if (opa != OPA_OPAQUE) {
+                    coverOpa = static_cast<OpacityType>((static_cast<uint16_t>(coverOpa) * opa) >> SHIFT_8);
+                }
+                COLOR_FILL_BLEND(dst, bufferMode, &fillColor, ARGB8888, coverOpa);
+            }
+            cover += colStep;
+            dst += bufferPxSize;
+        }
+    }
+}
+
 void DrawUtils::DrawImage(BufferInfo& gfxDstBuffer,
                           const Rect& area,
                           const Rect& mask,
@@ -806,6 +853,155 @@ inline void DrawUtils::StepToNextLine(TriangleEdge& edge1, TriangleEdge& edge2)
 #endif
 }
 
+namespace {
+constexpr uint8_t BILINEAR_TAP_NUM = 4;
+
+/*
+ * The bilinear taps of a pixel lying across the border of the image. Taps outside of the image are transparent and
+ * take the color of the closest edge pixel, so the image fades out across its border without being copied into a
+ * buffer with a transparent border first.
+ */
+struct BorderTaps {
+    int16_t u[BILINEAR_TAP_NUM];
+    int16_t v[BILINEAR_TAP_NUM];
+    int32_t weight[BILINEAR_TAP_NUM]; // shifted 8 bit left
+    bool isInside[BILINEAR_TAP_NUM];
+};
+
+bool GetBorderTaps(const ImageHeader& header, float u, float v, BorderTaps& taps)
+{
+    const int16_t width = header.width;
+    const int16_t height = header.height;
+    if ((u < -1) || (u >= width) || (v < -1) || (v >= height)) {
+        return false;
+    }
+    const int16_t intU = (u < 0) ? -1 : static_cast<int16_t>(u);
+    const int16_t intV = (v < 0) ? -1 : static_cast<int16_t>(v);
+    const float decU = u - intU;
+    const float decV = v - intV;
+    const float decUMinus1 = 1.0f - decU;
+    const float decVMinus1 = 1.0f - decV;
+    const bool isLeftInside = (intU >= 0);
+    const bool isRightInside = (intU + 1 < width);
+    const bool isTopInside = (intV >= 0);
+    const bool isBottomInside = (intV + 1 < height);
+    const int16_t left = isLeftInside ? intU : 0;
+    const int16_t right = isRightInside ? (intU + 1) : (width - 1);
+    const int16_t top = isTopInside ? intV : 0;
+    const int16_t bottom = isBottomInside ? (intV + 1) : (height - 1);
+    taps = {
+        {left, right, left, right},
+        {top, top, bottom, bottom},
+        {
+            static_cast<int32_t>(decUMinus1 * decVMinus1 * 256.0f), // 256:shift 8 bit left
+            static_cast<int32_t>(decU * decVMinus1 * 256.0f),       // 256:shift 8 bit left
+            static_cast<int32_t>(decUMinus1 * decV * 256.0f),       // 256:shift 8 bit left
+            static_cast<int32_t>(decU * decV * 256.0f),             // 256:shift 8 bit left
+        },
+        {isLeftInside && isTopInside, isRightInside && isTopInside, isLeftInside && isBottomInside,
+         isRightInside && isBottomInside},
+    };
+    return true;
+}
+
+Color32 GetTrueColorPx(const TriangleScanInfo& in, int16_t u, int16_t v)
+{
+    const uint8_t* px = in.info.data + v * in.srcLineWidth + u * in.pixelSize;
+    Color32 color;
+    switch (in.info.header.colorMode) {
+        case RGB565: {
+            const Color16 p16 = *(reinterpret_cast<const Color16*>(px));
+            color.red = p16.red << 3;     // 3:5 bit to 8 bit
+            color.green = p16.green << 2; // 2:6 bit to 8 bit
+            color.blue = p16.blue << 3;   // 3:5 bit to 8 bit
+            color.alpha = OPA_OPAQUE;
+            break;
+        }
+        case RGB888: {
+            const Color24 p24 = *(reinterpret_cast<const Color24*>(px));
+            color.red = p24.red;
+            color.green = p24.green;
+            color.blue = p24.blue;
+            color.alpha = OPA_OPAQUE;
+            break;
+        }
+        default:
+            color = *(reinterpret_cast<const Color32*>(px));
+            break;
+    }
+    return color;
+}
+
+void DrawTrueColorBilinearBorderPixel(const TriangleScanInfo& in,
+                                      uint8_t* screenBuffer,
+                                      float u,
+                                      float v,
+                                      const ColorMode bufferMode)
+{
+    BorderTaps taps;
+    if (!GetBorderTaps(in.info.header, u, v, taps)) {
+        return;
+    }
+    int32_t outR = 0;
+    int32_t outG = 0;
+    int32_t outB = 0;
+    int32_t outA = 0;
+    for (uint8_t i = 0; i < BILINEAR_TAP_NUM; i++) {
+        const Color32 p = GetTrueColorPx(in, taps.u[i], taps.v[i]);
+        outR += p.red * taps.weight[i];
+        outG += p.green * taps.weight[i];
+        outB += p.blue * taps.weight[i];
+        if (taps.isInside[i]) {
+            outA += p.alpha * taps.weight[i];
+        }
+    }
+    Color32 result;
+    result.red = static_cast<uint8_t>(outR >> 8);   // 8:shift 8 bit right
+    result.green = static_cast<uint8_t>(outG >> 8); // 8:shift 8 bit right
+    result.blue = static_cast<uint8_t>(outB >> 8);  // 8:shift 8 bit right
+    result.alpha = static_cast<uint8_t>(outA >> 8); // 8:shift 8 bit right
+    if (result.alpha != OPA_TRANSPARENT) {
+        COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
+    }
+}
+
+#if ENABLE_FIXED_POINT
+inline void DrawTrueColorBilinearBorderPixel(const TriangleScanInfo& in,
+                                             uint8_t* screenBuffer,
+                                             int64_t u,
+                                             int64_t v,
+                                             const ColorMode bufferMode)
+{
+    DrawTrueColorBilinearBorderPixel(in, screenBuffer, static_cast<float>(u) / FIXED_NUM_1,
+                                     static_cast<float>(v) / FIXED_NUM_1, bufferMode);
+}
+#endif
+} // namespace
+
+void DrawUtils::DrawAlphaBilinearBorderPixel(const TriangleScanInfo& in,
+                                             uint8_t* screenBuffer,
+                                             float u,
+                                             float v,
+                                             const ColorMode bufferMode)
+{
+    BorderTaps taps;
+    if (!GetBorderTaps(in.info.header, u, v, taps)) {
+        return;
+    }
+    int32_t outA = 0;
+    for (uint8_t i = 0; i < BILINEAR_TAP_NUM; i++) {
+        if (taps.isInside[i]) {
+            outA += GetPxAlphaForAlphaImg(in.info, {taps.u[i], taps.v[i]}) * taps.weight[i];
+        }
+    }
+    Color32 result;
+    result.full = Color::ColorTo32(in.color);
+    result.alpha = static_cast<uint8_t>(outA >> 8); // 8:shift 8 bit right
+    if (result.alpha != OPA_TRANSPARENT) {
+        COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
+    }
+}
+
 void DrawUtils::DrawTriangleAlphaBilinear(const TriangleScanInfo& in, const ColorMode bufferMode)
 {
     int16_t maskLeft = in.mask.GetLeft();
@@ -888,6 +1084,13 @@ void DrawUtils::DrawTriangleAlphaBilinear(const TriangleScanInfo& in, const Colo
                 result.alpha = static_cast<uint8_t>(outA >> 8); // 8:shift 8 bit right
 #endif
                 COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
+            } else {
+#if ENABLE_FIXED_POINT
+                DrawAlphaBilinearBorderPixel(in, screenBuffer, static_cast<float>(u) / FIXED_NUM_1,
+                                             static_cast<float>(v) / FIXED_NUM_1, bufferMode);
+#else
+                DrawAlphaBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
+#endif
             }
             u += in.init.duHorizon;
             v += in.init.dvHorizon;
@@ -1008,6 +1211,8 @@ void DrawUtils::DrawTriangleTrueColorBilinear565(const TriangleScanInfo& in, con
                 } else {
                     COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, RGB565, in.opaScale);
                 }
+            } else {
+                DrawTrueColorBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
             }
             u += in.init.duHorizon;
             v += in.init.dvHorizon;
@@ -1128,6 +1333,8 @@ void DrawUtils::DrawTriangleTrueColorBilinear888(const TriangleScanInfo& in, con
                 } else {
                     COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, RGB888, in.opaScale);
                 }
+            } else {
+                DrawTrueColorBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
             }
             u += in.init.duHorizon;
             v += in.init.dvHorizon;
@@ -1206,6 +1413,8 @@ static void DrawTriangleTrueColorBilinear8888Inner(const TriangleScanInfo& in,
             } else {
                 COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
             }
+        } else {
+            DrawTrueColorBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
         }
         u += in.init.duHorizon;
         v += in.init.dvHorizon;
@@ -1275,6 +1484,8 @@ static void DrawFixedTriangleTrueColorBilinear8888Inner(const TriangleScanInfo&
             } else {
                 COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
             }
+        } else {
+            DrawTrueColorBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
         }
         u += in.init.duHorizon;
         v += in.init.dvHorizon;
@@ -1548,6 +1759,8 @@ void DrawUtils::Draw3DTriangleTrueColorBilinear8888(const TriangleScanInfo& in,
                 } else {
                     COLOR_FILL_BLEND(screenBuffer, bufferMode, &result, ARGB8888, in.opaScale);
                 }
+            } else {
+                DrawTrueColorBilinearBorderPixel(in, screenBuffer, u, v, bufferMode);
             }
             screenBuffer += in.bufferPxSize;
         }
@@ -1653,11 +1866,11 @@ void DrawUtils::DrawTriangleTrueColorNearest(const TriangleScanInfo& in, const C
 #if ENABLE_FIXED_POINT
             int16_t intU = FO_TO_INTEGER(u);
             int16_t intV = FO_TO_INTEGER(v);
-            if ((u >= 0) && (intU < (in.info.header.width - 1)) && (v >= 0) && (intV < (in.info.header.height - 1))) {
+            if ((u >= 0) && (intU < in.info.header.width) && (v >= 0) && (intV < in.info.header.height)) {
 #else
             const int16_t intU = static_cast<int16_t>(u);
             const int16_t intV = static_cast<int16_t>(v);
-            if ((u >= 0) && (intU < in.info.header.width - 1) && (v >= 0) && (intV < in.info.header.height - 1)) {
+            if ((u >= 0) && (intU < in.info.header.width) && (v >= 0) && (intV < in.info.header.height)) {
 #endif
 #if ENABLE_ARM_MATH
                 uint32_t val1 = __SMUAD(intV, in.srcLineWidth);
@@ -1881,66 +2094,15 @@ BottomHalf:
     DrawTriangleTransformPart(gfxDstBuffer, part);
 }
 
-void DrawUtils::AddBorderToImageData(TransformDataInfo& newDataInfo, ImageInfo& imageinfo)
-{
-    int16_t border = 1;          // 1 : border width
-    int16_t offset = border * 2; // 2 : offset
-    uint16_t width = newDataInfo.header.width;
-    uint16_t height = newDataInfo.header.height;
-    int16_t diff = 0;
-    if (newDataInfo.pxSize > FONT_WEIGHT_8) {
-        width += offset;
-        height += offset;
-        diff = border * newDataInfo.pxSize / FONT_WEIGHT_8;
-    } else {
-        width += offset * FONT_WEIGHT_8 / newDataInfo.pxSize;
-        height += offset;
-        diff = border;
-    }
-    uint16_t widthInByte = width * newDataInfo.pxSize / FONT_WEIGHT_8;
-    if ((width * newDataInfo.pxSize) % FONT_WEIGHT_8 != 0) {
-        widthInByte++;
-    }
-    imageinfo.header.width = newDataInfo.header.width;
-    imageinfo.header.height = newDataInfo.header.height;
-    imageinfo.dataSize = widthInByte * height;
-    uint8_t* newData = static_cast<uint8_t*>(ImageCacheMalloc(imageinfo));
-    if (newData == nullptr) {
-        return;
-    }
-    imageinfo.data = newData;
-    if (memset_s(newData, widthInByte * height, 0, widthInByte * height) != EOK) {
-        ImageCacheFree(imageinfo);
-        newData = nullptr;
-        return;
-    }
-    uint8_t* tmp = newData;
-    uint8_t* data = const_cast<uint8_t*>(newDataInfo.data);
-    tmp += widthInByte * border + diff;
-    for (int i = 0; i < newDataInfo.header.height; ++i) {
-        // 2 : double
-        if (memcpy_s(tmp, widthInByte - diff * 2, data, widthInByte - diff * 2) != EOK) {
-        ImageCacheFree(imageinfo);
-            newData = nullptr;
-            return;
-        }
-        tmp += widthInByte;
-        data += widthInByte - diff * 2; // 2 : double
-    }
-    newDataInfo.header.width = width;
-    newDataInfo.header.height = height;
-    newDataInfo.data = newData;
-}
-
-void DrawUtils::UpdateTransMap(int16_t width, int16_t height, TransformMap& transMap)
+void DrawUtils::ExpandTransMap(int16_t border, TransformMap& transMap)
 {
     Rect rect = transMap.GetTransMapRect();
     Matrix4<float> matrix = transMap.GetTransformMatrix();
     matrix = matrix * (Matrix4<float>::Translate(Vector3<float>(-rect.GetX(), -rect.GetY(), 0)));
-    int16_t offsetX = (width - rect.GetWidth()) / 2;   //  2 : half;
-    int16_t offsetY = (height - rect.GetHeight()) / 2; //  2 : half;
-    rect.SetPosition(rect.GetX() - offsetX, rect.GetY() - offsetY);
-    rect.Resize(width, height);
+    // the image keeps its position, only the polygon covers the border around it
+    Vector2<float> origin(rect.GetX(), rect.GetY());
+    rect.SetPosition(rect.GetX() - border, rect.GetY() - border);
+    rect.Resize(rect.GetWidth() + border * 2, rect.GetHeight() + border * 2); // 2: both sides
     Polygon polygon = Polygon(rect);
     uint8_t vertexNum = transMap.GetPolygon().GetVertexNum();
     Vector4<float> imgPoint4;
@@ -1966,7 +2128,7 @@ void DrawUtils::UpdateTransMap(int16_t width, int16_t height, TransformMap& tran
     transMap.SetPolygon(polygon);
     Matrix3<float> matrix3(matrix[0][0], matrix[0][1], matrix[0][3], matrix[1][0], matrix[1][1], matrix[1][3],
                            matrix[3][0], matrix[3][1], matrix[3][3]);
-    transMap.invMatrix_ = (matrix3 * (Matrix3<float>::Translate(Vector2<float>(rect.GetX(), rect.GetY())))).Inverse();
+    transMap.invMatrix_ = (matrix3 * (Matrix3<float>::Translate(origin))).Inverse();
 }
 
 void DrawUtils::DrawTransform(BufferInfo& gfxDstBuffer,
@@ -1983,32 +2145,23 @@ void DrawUtils::DrawTransform(BufferInfo& gfxDstBuffer,
     if ((gfxDstBuffer.virAddr == nullptr) || (dataInfo.data == nullptr)) {
         return;
     }
-    ImageInfo imageinfo;
-    TransformDataInfo newDataInfo = dataInfo;
     TransformMap newTransMap = transMap;
-    // If the width and height of the rectangle of transMap are not equal to the width and height of the ImageHeader,
-    // a border of transparency values to the data cannot be added.
+    // The samplers read the pixels outside of the image as transparent. If the rectangle of transMap matches the
+    // image, expand the polygon by one pixel so that the image fades out across its border.
     if ((transMap.GetTransMapRect().GetWidth() == dataInfo.header.width) &&
         (transMap.GetTransMapRect().GetHeight() == dataInfo.header.height)) {
-        // Add a border of transparency values to the data
-        AddBorderToImageData(newDataInfo, imageinfo);
-        // Update the transMap according to new rect width and height
-        UpdateTransMap(newDataInfo.header.width, newDataInfo.header.height, newTransMap);
+        ExpandTransMap(1, newTransMap); // 1: border width
     }
 
     Rect trans = newTransMap.GetBoxRect();
     trans.SetX(trans.GetX() + position.x);
     trans.SetY(trans.GetY() + position.y);
-    imageinfo.data = newDataInfo.data;
     if (!trans.Intersect(trans, mask)) {
-        if (newDataInfo.data != dataInfo.data) {
-            ImageCacheFree(imageinfo);
-        }
         return;
     }
 
     TriangleTransformDataInfo triangleInfo{
-        newDataInfo,
+        dataInfo,
     };
     Polygon polygon = newTransMap.GetPolygon();
     Point p1;
@@ -2047,9 +2200,6 @@ void DrawUtils::DrawTransform(BufferInfo& gfxDstBuffer,
     if ((triangleInfo.p1.y <= mask.GetBottom()) && (triangleInfo.p3.y >= mask.GetTop())) {
         DrawTriangleTransform(gfxDstBuffer, mask, position, color, opaScale, newTransMap, triangleInfo);
     }
-    if (newDataInfo.data != dataInfo.data) {
-        ImageCacheFree(imageinfo);
-    }
 }
 
 OpacityType DrawUtils::GetPxAlphaForAlphaImg(const TransformDataInfo& dataInfo, const Point& point)
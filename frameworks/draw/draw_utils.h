@@ -72,7 +72,8 @@ struct LabelLineInfo {
     uint8_t fontSize;
     uint8_t txtFlag;
     UITextLanguageDirect direct;
-    uint32_t* codePoints;
+    const uint32_t* codePoints; // the letters of the line decoded, drawn instead of decoding text when not null
+    uint16_t codePointNum;
     bool baseLine;
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     TextStyle* textStyles;
@@ -231,6 +232,10 @@ public:
     void DrawImage(BufferInfo& gfxDstBuffer, const Rect& area, const Rect& mask,
                    const uint8_t* image, OpacityType opa, uint8_t pxBitSize, ColorMode colorMode) const;
 
+    /* Blends the color with an A8 coverage map of the area's size, which can be mirrored horizontally or vertically. */
+    void DrawCoverage(BufferInfo& gfxDstBuffer, const Rect& area, const Rect& mask, const uint8_t* covers,
+                      bool mirrorX, bool mirrorY, const ColorType& color, OpacityType opa) const;
+
     static void
         GetXAxisErrForJunctionLine(bool ignoreJunctionPoint, bool isRightPart, int16_t& xMinErr, int16_t& xMaxErr);
 
@@ -356,9 +361,13 @@ private:
 
     static OpacityType GetPxAlphaForAlphaImg(const TransformDataInfo& dataInfo, const Point& point);
 
-    static void AddBorderToImageData(TransformDataInfo& newDataInfo, ImageInfo& imageinfo);
+    static void DrawAlphaBilinearBorderPixel(const TriangleScanInfo& in,
+                                             uint8_t* screenBuffer,
+                                             float u,
+                                             float v,
+                                             const ColorMode bufferMode);
 
-    static void UpdateTransMap(int16_t width, int16_t height, TransformMap& transMap);
+    static void ExpandTransMap(int16_t border, TransformMap& transMap);
 
     void FillArea(BufferInfo& gfxDstBuffer, const Rect& rect, const Rect& mask,
                   bool isTransparent, const ColorType* colorBuf);
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/rotated_glyph_cache.h"
+
+#include "common/ui_arena.h"
+#include "engines/gfx/gfx_engine_manager.h"
+#include "font/ui_font.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+#include "gfx_utils/transform.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t ARGB8888_SIZE = 4;
+constexpr uint8_t ALPHA_INDEX = 3;
+constexpr int16_t CIRCLE_DEGREE = 360;
+} // namespace
+
+RotatedGlyphCache& RotatedGlyphCache::GetInstance()
+{
+    static RotatedGlyphCache instance;
+    return instance;
+}
+
+const RotatedGlyphCache::Glyph* RotatedGlyphCache::GetGlyph(uint32_t letter, uint16_t fontId, uint8_t fontSize,
+                                                            int16_t angle, bool compatibilityMode)
+{
+    if (!enabled_) {
+        return nullptr;
+    }
+    angle %= CIRCLE_DEGREE;
+    if (angle < 0) {
+        angle += CIRCLE_DEGREE;
+    }
+    useCount_++;
+    for (uint8_t i = 0; i < MAX_GLYPH_NUM; i++) {
+        Glyph& glyph = glyphs_[i];
+        if ((glyph.alpha != nullptr) && (glyph.letter == letter) && (glyph.angle == angle) &&
+            (glyph.fontId == fontId) && (glyph.fontSize == fontSize) &&
+            (glyph.compatibilityMode == compatibilityMode)) {
+            glyph.lastUse = useCount_;
+            stats_.hitNum++;
+            return &glyph;
+        }
+    }
+    stats_.missNum++;
+
+    Glyph glyph = {letter, fontId, fontSize, compatibilityMode, angle, Rect(), nullptr, useCount_};
+    if (!Render(glyph)) {
+        return nullptr;
+    }
+    uint32_t size = static_cast<uint32_t>(glyph.rect.GetWidth()) * glyph.rect.GetHeight();
+    Glyph* slot = GetFreeGlyph(size);
+    if (slot == nullptr) {
+        UIFree(glyph.alpha);
+        return nullptr;
+    }
+    *slot = glyph;
+    stats_.glyphNum++;
+    stats_.usedBytes += size;
+    return slot;
+}
+
+bool RotatedGlyphCache::Render(Glyph& glyph)
+{
+    UIFont* fontEngine = UIFont::GetInstance();
+    FontHeader head;
+    GlyphNode node;
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    node.textStyle = TEXT_STYLE_NORMAL;
+#endif
+    if (fontEngine->GetFontHeader(head, glyph.fontId, glyph.fontSize) != 0) {
+        return false;
+    }
+    ColorMode colorMode = fontEngine->GetColorType(glyph.fontId);
+    if ((colorMode != A1) && (colorMode != A2) && (colorMode != A4) && (colorMode != A8)) {
+        return false;
+    }
+    /* the bitmap is rotated into a buffer of this cache, it is pinned only while it is read */
+    uint8_t* fontMap = fontEngine->PinBitmap(glyph.letter, node, glyph.fontId, glyph.fontSize, 0);
+    if (fontMap == nullptr) {
+        return false;
+    }
+    int16_t offset = glyph.compatibilityMode ? head.ascender : 0;
+    bool ret = (node.cols != 0) && (node.rows != 0) && Rotate(glyph, node, offset, fontMap);
+    fontEngine->UnpinBitmap(fontMap);
+    return ret;
+}
+
+bool RotatedGlyphCache::Rotate(Glyph& glyph, const GlyphNode& node, int16_t offset, const uint8_t* fontMap)
+{
+    /* the same transform as DrawLabel::DrawLetterWithRotate, for a letter at 0, 0 */
+    Vector2<float> pivot(-node.left, node.top - offset);
+    Rect rectLetter;
+    rectLetter.SetPosition(node.left, offset - node.top);
+    rectLetter.Resize(node.cols, node.rows);
+    TransformMap boxMap(rectLetter);
+    boxMap.Rotate(glyph.angle, pivot);
+    glyph.rect = boxMap.GetBoxRect();
+    if ((glyph.rect.GetWidth() <= 0) || (glyph.rect.GetHeight() <= 0)) {
+        return false;
+    }
+
+    /* rotate it into a buffer starting at the top left of the rotated letter */
+    uint32_t pxNum = static_cast<uint32_t>(glyph.rect.GetWidth()) * glyph.rect.GetHeight();
+    uint8_t* buffer = static_cast<uint8_t*>(UIFrameAllocator::GetInstance()->Allocate(pxNum * ARGB8888_SIZE));
+    glyph.alpha = static_cast<uint8_t*>(UIMalloc(pxNum));
+    if ((buffer == nullptr) || (glyph.alpha == nullptr) ||
+        (memset_s(buffer, pxNum * ARGB8888_SIZE, 0, pxNum * ARGB8888_SIZE) != EOK)) {
+        if (glyph.alpha != nullptr) {
+            UIFree(glyph.alpha);
+            glyph.alpha = nullptr;
+        }
+        return false;
+    }
+    rectLetter.SetPosition(rectLetter.GetX() - glyph.rect.GetX(), rectLetter.GetY() - glyph.rect.GetY());
+    TransformMap transMap(rectLetter);
+    transMap.Rotate(glyph.angle, pivot);
+    Rect bufferRect(0, 0, glyph.rect.GetWidth() - 1, glyph.rect.GetHeight() - 1);
+    BufferInfo bufInfo{bufferRect, 0, nullptr, nullptr, 0, 0, ARGB8888, 0};
+    bufInfo.stride = glyph.rect.GetWidth() * ARGB8888_SIZE;
+    bufInfo.phyAddr = buffer;
+    bufInfo.virAddr = buffer;
+    bufInfo.width = glyph.rect.GetWidth();
+    bufInfo.height = glyph.rect.GetHeight();
+    UIFont* fontEngine = UIFont::GetInstance();
+    ColorMode colorMode = fontEngine->GetColorType(glyph.fontId);
+    TransformDataInfo letterTranDataInfo = {ImageHeader{colorMode, 0, 0, 0, node.cols, node.rows}, fontMap,
+                                            fontEngine->GetFontWeight(glyph.fontId), BlurLevel::LEVEL0,
+                                            TransformAlgorithm::BILINEAR};
+    BaseGfxEngine::GetInstance()->DrawTransform(bufInfo, bufferRect, Point {0, 0}, Color::White(), OPA_OPAQUE,
+                                                transMap, letterTranDataInfo);
+    for (uint32_t i = 0; i < pxNum; i++) {
+        glyph.alpha[i] = buffer[i * ARGB8888_SIZE + ALPHA_INDEX];
+    }
+    return true;
+}
+
+RotatedGlyphCache::Glyph* RotatedGlyphCache::GetFreeGlyph(uint32_t size)
+{
+    if (size > MAX_CACHE_SIZE) {
+        return nullptr;
+    }
+    while (true) {
+        Glyph* oldest = nullptr;
+        Glyph* free = nullptr;
+        for (uint8_t i = 0; i < MAX_GLYPH_NUM; i++) {
+            if (glyphs_[i].alpha == nullptr) {
+                free = &glyphs_[i];
+            } else if ((oldest == nullptr) || (glyphs_[i].lastUse < oldest->lastUse)) {
+                oldest = &glyphs_[i];
+            }
+        }
+        if ((free != nullptr) && (stats_.usedBytes + size <= MAX_CACHE_SIZE)) {
+            return free;
+        }
+        if (oldest == nullptr) {
+            return nullptr;
+        }
+        FreeGlyph(*oldest);
+    }
+}
+
+void RotatedGlyphCache::FreeGlyph(Glyph& glyph)
+{
+    if (glyph.alpha == nullptr) {
+        return;
+    }
+    stats_.glyphNum--;
+    stats_.usedBytes -= static_cast<uint32_t>(glyph.rect.GetWidth()) * glyph.rect.GetHeight();
+    UIFree(glyph.alpha);
+    glyph.alpha = nullptr;
+}
+
+void RotatedGlyphCache::SetEnabled(bool enabled)
+{
+    enabled_ = enabled;
+    if (!enabled_) {
+        Clear();
+    }
+}
+
+void RotatedGlyphCache::Clear()
+{
+    for (uint8_t i = 0; i < MAX_GLYPH_NUM; i++) {
+        FreeGlyph(glyphs_[i]);
+    }
+}
+} // namespace OHOS
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
+#define GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
+
+#include "gfx_utils/geometry2d.h"
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+struct GlyphNode;
+
+/*
+ * Keeps the glyphs of the arc texts rotated, as 8 bit alpha maps, so drawing a letter at an angle it was drawn at
+ * before is one blend instead of a transform. The angles are whole degrees, as the arc texts draw them. The least
+ * recently used glyphs are dropped when the cache is full. Only used on the UI thread.
+ */
+class RotatedGlyphCache : public HeapBase {
+public:
+    struct Glyph {
+        uint32_t letter;
+        uint16_t fontId;
+        uint8_t fontSize;
+        bool compatibilityMode;
+        int16_t angle;
+        Rect rect; // relative to the position of the letter
+        uint8_t* alpha;
+        uint32_t lastUse;
+    };
+
+    struct Stats {
+        uint32_t hitNum;
+        uint32_t missNum;
+        uint16_t glyphNum;
+        uint32_t usedBytes;
+    };
+
+    static RotatedGlyphCache& GetInstance();
+
+    /* Returns the glyph rotated by angle, or nullptr if it can not be cached, colored glyphs are not. */
+    const Glyph* GetGlyph(uint32_t letter, uint16_t fontId, uint8_t fontSize, int16_t angle, bool compatibilityMode);
+
+    void Clear();
+
+    /* Disabled, every glyph is drawn through the transform again, the cached glyphs are dropped. */
+    void SetEnabled(bool enabled);
+
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    const Stats& GetStats() const
+    {
+        return stats_;
+    }
+
+    static constexpr uint8_t MAX_GLYPH_NUM = 64;
+    static constexpr uint32_t MAX_CACHE_SIZE = 32768;
+
+private:
+    RotatedGlyphCache() : enabled_(true), useCount_(0), stats_({}), glyphs_{} {}
+    ~RotatedGlyphCache() {}
+
+    RotatedGlyphCache(const RotatedGlyphCache&) = delete;
+    RotatedGlyphCache& operator=(const RotatedGlyphCache&) = delete;
+    RotatedGlyphCache(RotatedGlyphCache&&) = delete;
+    RotatedGlyphCache& operator=(RotatedGlyphCache&&) = delete;
+
+    bool Render(Glyph& glyph);
+    bool Rotate(Glyph& glyph, const GlyphNode& node, int16_t offset, const uint8_t* fontMap);
+    Glyph* GetFreeGlyph(uint32_t size);
+    void FreeGlyph(Glyph& glyph);
+
+    bool enabled_;
+    uint32_t useCount_;
+    Stats stats_;
+    Glyph glyphs_[MAX_GLYPH_NUM];
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_ROTATED_GLYPH_CACHE_H
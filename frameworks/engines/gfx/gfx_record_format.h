@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_GFX_RECORD_FORMAT_H
+#define GRAPHIC_LITE_GFX_RECORD_FORMAT_H
+
+#include <cstdint>
+
+namespace OHOS {
+/*
+ * Layout of a graphics engine recording, shared by RecordingEngine and GfxReplayer:
+ *
+ *   RecFileHeader | RecHeader | payload | RecHeader | payload | ...
+ *
+ * Every engine call is a record whose payload is one of the structures below. The buffers drawn into are declared
+ * once by a REC_TARGET record and referenced by index, and the pixels read by a call (glyphs, images, blitted
+ * buffers) are stored once by a REC_DATA record and referenced by index, however often they are drawn.
+ * A REC_FRAME record closes each frame. The fields are written in the byte order of the recording device, and
+ * colors keep the ColorType of the build, so the replay runs on a build with the same color depth.
+ */
+constexpr uint32_t REC_FILE_MAGIC = 0x52584647; // "GFXR"
+constexpr uint16_t REC_FILE_VERSION = 1;
+constexpr uint32_t REC_NO_DATA = 0xFFFFFFFF;
+
+enum RecOp : uint8_t {
+    REC_FRAME,
+    REC_TARGET,
+    REC_DATA,
+    REC_DRAW_ARC,
+    REC_DRAW_LINE,
+    REC_DRAW_LETTER,
+    REC_DRAW_CUBIC_BEZIER,
+    REC_DRAW_RECT,
+    REC_DRAW_TRANSFORM,
+    REC_BLIT,
+    REC_FILL,
+    REC_DRAW_PATH,
+    REC_FILL_PATH,
+    REC_OP_NUM
+};
+
+struct RecFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t screenWidth;
+    uint16_t screenHeight;
+    uint16_t reserved;
+};
+
+struct RecHeader {
+    uint8_t op;
+    uint8_t reserved;
+    uint16_t target;   // index of the buffer drawn into
+    uint32_t size;     // bytes of the payload
+    uint32_t duration; // microseconds the call took on the recording device
+};
+
+struct RecRect {
+    int16_t left;
+    int16_t top;
+    int16_t right;
+    int16_t bottom;
+};
+
+/* REC_TARGET, also describes the source of REC_BLIT */
+struct RecBuffer {
+    RecRect rect;
+    uint32_t stride;
+    uint16_t width;
+    uint16_t height;
+    uint8_t mode;
+    uint8_t reserved[3]; // 3: padding
+};
+
+/* REC_DATA, followed by size bytes */
+struct RecData {
+    uint32_t id;
+    uint32_t size;
+};
+
+/* REC_FRAME */
+struct RecFrame {
+    RecRect flushRect;
+};
+
+/* the fields of Style used by the engine */
+struct RecStyle {
+    uint32_t bgColor;
+    uint32_t borderColor;
+    uint32_t lineColor;
+    uint32_t textColor;
+    int16_t borderRadius;
+    int16_t borderWidth;
+    int16_t lineWidth;
+    uint8_t bgOpa;
+    uint8_t borderOpa;
+    uint8_t lineOpa;
+    uint8_t lineCap;
+    uint8_t imageOpa;
+    uint8_t textOpa;
+};
+
+struct RecDrawArc {
+    RecRect mask;
+    RecStyle style;
+    uint32_t imageData; // REC_NO_DATA if the arc has no image
+    uint16_t imageWidth;
+    uint16_t imageHeight;
+    int16_t centerX;
+    int16_t centerY;
+    int16_t imageX;
+    int16_t imageY;
+    uint16_t radius;
+    int16_t startAngle;
+    int16_t endAngle;
+    uint8_t imageColorMode;
+    uint8_t opacity;
+    uint8_t cap;
+    uint8_t reserved[3]; // 3: padding
+};
+
+struct RecDrawLine {
+    RecRect mask;
+    uint32_t color;
+    int16_t startX;
+    int16_t startY;
+    int16_t endX;
+    int16_t endY;
+    int16_t width;
+    uint8_t opacity;
+    uint8_t reserved;
+};
+
+struct RecDrawLetter {
+    RecRect fontRect;
+    RecRect subRect;
+    uint32_t fontMap;
+    uint32_t color;
+    uint8_t fontWeight;
+    uint8_t opacity;
+    uint8_t reserved[2]; // 2: padding
+};
+
+struct RecDrawCubicBezier {
+    RecRect mask;
+    uint32_t color;
+    int16_t points[8]; // 8: x and y of start, control1, control2 and end
+    int16_t width;
+    uint8_t opacity;
+    uint8_t reserved;
+};
+
+struct RecDrawRect {
+    RecRect rect;
+    RecRect dirtyRect;
+    RecStyle style;
+    uint8_t opacity;
+    uint8_t reserved[3]; // 3: padding
+};
+
+struct RecDrawTransform {
+    RecRect mask;
+    RecRect mapRect;
+    float matrix[16]; // 16: 4x4 transform matrix, in the order of Matrix4::operator[]
+    uint32_t data;
+    uint32_t color;
+    int16_t positionX;
+    int16_t positionY;
+    uint16_t width;
+    uint16_t height;
+    uint8_t colorMode;
+    uint8_t pxSize;
+    uint8_t blurLevel;
+    uint8_t algorithm;
+    uint8_t opacity;
+    uint8_t reserved[3]; // 3: padding
+};
+
+struct RecBlit {
+    RecBuffer src;
+    RecRect subRect;
+    uint32_t data;
+    uint32_t srcColor;
+    int16_t dstX;
+    int16_t dstY;
+    uint8_t blendMode;
+    uint8_t opacity;
+    uint8_t reserved[2]; // 2: padding
+};
+
+struct RecFill {
+    RecRect area;
+    uint32_t color;
+    uint8_t opacity;
+    uint8_t reserved[3]; // 3: padding
+};
+
+/* REC_DRAW_PATH and REC_FILL_PATH, the path itself is private to the canvas and is not recorded */
+struct RecPath {
+    RecRect rect;
+    RecRect invalidatedArea;
+    RecStyle style;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_GFX_RECORD_FORMAT_H
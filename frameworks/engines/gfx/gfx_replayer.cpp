@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engines/gfx/gfx_replayer.h"
+
+#if ENABLE_DEBUG
+#include "common/image.h"
+#include "dfx/ui_render_trace.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t MATRIX_ORDER = 4;
+constexpr uint16_t REPORT_LINE_SIZE = 128;
+constexpr uint32_t MAX_FILE_SIZE = 0x40000000;
+const char* const OP_NAMES[REC_OP_NUM] = {
+    "Frame",    "Target",        "Data", "DrawArc", "DrawLine", "DrawLetter", "DrawCubicBezier",
+    "DrawRect", "DrawTransform", "Blit", "Fill",    "DrawPath", "FillPath",
+};
+
+Rect ToRect(const RecRect& rect)
+{
+    return Rect(rect.left, rect.top, rect.right, rect.bottom);
+}
+
+ColorType ToColor(uint32_t full)
+{
+    ColorType color;
+    color.full = full;
+    return color;
+}
+
+void ToStyle(const RecStyle& recStyle, Style& style)
+{
+    style.bgColor_ = ToColor(recStyle.bgColor);
+    style.borderColor_ = ToColor(recStyle.borderColor);
+    style.lineColor_ = ToColor(recStyle.lineColor);
+    style.textColor_ = ToColor(recStyle.textColor);
+    style.borderRadius_ = recStyle.borderRadius;
+    style.borderWidth_ = recStyle.borderWidth;
+    style.lineWidth_ = recStyle.lineWidth;
+    style.bgOpa_ = recStyle.bgOpa;
+    style.borderOpa_ = recStyle.borderOpa;
+    style.lineOpa_ = recStyle.lineOpa;
+    style.lineCap_ = recStyle.lineCap;
+    style.imageOpa_ = recStyle.imageOpa;
+    style.textOpa_ = recStyle.textOpa;
+}
+
+bool WriteLine(int32_t fd, const char* line, int32_t len)
+{
+    return (len >= 0) && (write(fd, line, len) == len);
+}
+} // namespace
+
+GfxReplayer::~GfxReplayer()
+{
+    Reset();
+}
+
+void GfxReplayer::Reset()
+{
+    for (uint16_t i = 0; i < targetNum_; i++) {
+        UIFree(targets_[i].virAddr);
+    }
+    UIFree(targets_);
+    UIFree(data_);
+    UIFree(dataSizes_);
+    UIFree(calls_);
+    UIFree(file_);
+    targets_ = nullptr;
+    data_ = nullptr;
+    dataSizes_ = nullptr;
+    calls_ = nullptr;
+    file_ = nullptr;
+    fileSize_ = 0;
+    targetNum_ = 0;
+    dataNum_ = 0;
+    callNum_ = 0;
+    frameNum_ = 0;
+    skippedNum_ = 0;
+}
+
+bool GfxReplayer::Load(const char* path)
+{
+    Reset();
+    if (path == nullptr) {
+        return false;
+    }
+#ifdef _WIN32
+    int32_t fd = open(path, O_RDONLY | O_BINARY);
+#else
+    int32_t fd = open(path, O_RDONLY);
+#endif
+    if (fd < 0) {
+        GRAPHIC_LOGE("GfxReplayer::Load open file failed Err!\n");
+        return false;
+    }
+    int32_t fileSize = lseek(fd, 0, SEEK_END);
+    if ((fileSize < static_cast<int32_t>(sizeof(RecFileHeader))) || (fileSize > static_cast<int32_t>(MAX_FILE_SIZE)) ||
+        (lseek(fd, 0, SEEK_SET) != 0)) {
+        close(fd);
+        return false;
+    }
+    file_ = static_cast<uint8_t*>(UIMalloc(fileSize));
+    if ((file_ == nullptr) || (read(fd, file_, fileSize) != fileSize)) {
+        close(fd);
+        Reset();
+        return false;
+    }
+    close(fd);
+    fileSize_ = static_cast<uint32_t>(fileSize);
+
+    RecFileHeader fileHeader;
+    if ((memcpy_s(&fileHeader, sizeof(fileHeader), file_, sizeof(fileHeader)) != EOK) ||
+        (fileHeader.magic != REC_FILE_MAGIC) || (fileHeader.version != REC_FILE_VERSION) || !Parse()) {
+        GRAPHIC_LOGE("GfxReplayer::Load broken recording Err!\n");
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+uint32_t GfxReplayer::GetPayloadSize(uint8_t op)
+{
+    switch (op) {
+        case REC_FRAME:
+            return sizeof(RecFrame);
+        case REC_TARGET:
+            return sizeof(RecBuffer);
+        case REC_DRAW_ARC:
+            return sizeof(RecDrawArc);
+        case REC_DRAW_LINE:
+            return sizeof(RecDrawLine);
+        case REC_DRAW_LETTER:
+            return sizeof(RecDrawLetter);
+        case REC_DRAW_CUBIC_BEZIER:
+            return sizeof(RecDrawCubicBezier);
+        case REC_DRAW_RECT:
+            return sizeof(RecDrawRect);
+        case REC_DRAW_TRANSFORM:
+            return sizeof(RecDrawTransform);
+        case REC_BLIT:
+            return sizeof(RecBlit);
+        case REC_FILL:
+            return sizeof(RecFill);
+        case REC_DRAW_PATH:
+        case REC_FILL_PATH:
+            return sizeof(RecPath);
+        default:
+            return 0;
+    }
+}
+
+bool GfxReplayer::Parse()
+{
+    /* count the records first, so the tables are allocated once */
+    uint32_t targetNum = 0;
+    for (uint32_t pos = sizeof(RecFileHeader); pos < fileSize_;) {
+        RecHeader header;
+        if ((fileSize_ - pos < sizeof(header)) ||
+            (memcpy_s(&header, sizeof(header), file_ + pos, sizeof(header)) != EOK)) {
+            return false;
+        }
+        pos += sizeof(header);
+        if (header.size > fileSize_ - pos) {
+            return false;
+        }
+        if (header.op == REC_DATA) {
+            RecData recData;
+            if ((header.size < sizeof(recData)) ||
+                (memcpy_s(&recData, sizeof(recData), file_ + pos, sizeof(recData)) != EOK) ||
+                (recData.id != dataNum_) || (recData.size > header.size - sizeof(recData))) {
+                return false;
+            }
+            dataNum_++;
+        } else if ((header.op >= REC_OP_NUM) || (header.size != GetPayloadSize(header.op))) {
+            return false;
+        } else if (header.op == REC_TARGET) {
+            targetNum++;
+        } else if (IsCall(header.op)) {
+            callNum_++;
+        }
+        pos += header.size;
+    }
+    if (targetNum > UINT16_MAX) {
+        return false;
+    }
+
+    targets_ = static_cast<BufferInfo*>(UIMalloc(sizeof(BufferInfo) * targetNum + 1));
+    data_ = static_cast<const uint8_t**>(UIMalloc(sizeof(uint8_t*) * dataNum_ + 1));
+    dataSizes_ = static_cast<uint32_t*>(UIMalloc(sizeof(uint32_t) * dataNum_ + 1));
+    calls_ = static_cast<CallTiming*>(UIMalloc(sizeof(CallTiming) * callNum_ + 1));
+    if ((targets_ == nullptr) || (data_ == nullptr) || (dataSizes_ == nullptr) || (calls_ == nullptr)) {
+        return false;
+    }
+
+    uint32_t dataIndex = 0;
+    uint32_t callIndex = 0;
+    uint32_t frame = 0;
+    for (uint32_t pos = sizeof(RecFileHeader); pos < fileSize_;) {
+        RecHeader header;
+        if (memcpy_s(&header, sizeof(header), file_ + pos, sizeof(header)) != EOK) {
+            return false;
+        }
+        pos += sizeof(header);
+        const uint8_t* payload = file_ + pos;
+        pos += header.size;
+        if (header.op == REC_DATA) {
+            RecData recData;
+            if (memcpy_s(&recData, sizeof(recData), payload, sizeof(recData)) != EOK) {
+                return false;
+            }
+            data_[dataIndex] = payload + sizeof(recData);
+            dataSizes_[dataIndex] = recData.size;
+            dataIndex++;
+        } else if (header.op == REC_TARGET) {
+            RecBuffer buffer;
+            if ((memcpy_s(&buffer, sizeof(buffer), payload, sizeof(buffer)) != EOK) || (header.target != targetNum_) ||
+                !CreateTarget(header.target, buffer)) {
+                return false;
+            }
+        } else if (header.op == REC_FRAME) {
+            frame++;
+        } else {
+            if (header.target >= targetNum_) {
+                return false;
+            }
+            calls_[callIndex] = {frame, header.target, header.op, header.duration, UINT32_MAX};
+            callIndex++;
+        }
+    }
+    frameNum_ = frame;
+    return true;
+}
+
+bool GfxReplayer::CreateTarget(uint16_t id, const RecBuffer& buffer)
+{
+    BufferInfo& info = targets_[id];
+    info = {};
+    info.rect = ToRect(buffer.rect);
+    info.stride = buffer.stride;
+    info.width = buffer.width;
+    info.height = buffer.height;
+    info.mode = static_cast<ColorMode>(buffer.mode);
+    uint32_t size = buffer.stride * buffer.height;
+    info.virAddr = UIMalloc(size);
+    if (info.virAddr == nullptr) {
+        return false;
+    }
+    targetNum_++;
+    return memset_s(info.virAddr, size, 0, size) == EOK;
+}
+
+const uint8_t* GfxReplayer::GetData(uint32_t id, uint32_t size) const
+{
+    /* a call never reads more than the recorder stored for it */
+    if ((id >= dataNum_) || (dataSizes_[id] < size)) {
+        return nullptr;
+    }
+    return data_[id];
+}
+
+bool GfxReplayer::Replay(uint16_t loopNum)
+{
+    if ((file_ == nullptr) || (engine_ == nullptr)) {
+        return false;
+    }
+    for (uint16_t loop = 0; loop < loopNum; loop++) {
+        uint32_t callIndex = 0;
+        skippedNum_ = 0;
+        for (uint32_t pos = sizeof(RecFileHeader); pos < fileSize_;) {
+            RecHeader header;
+            if (memcpy_s(&header, sizeof(header), file_ + pos, sizeof(header)) != EOK) {
+                return false;
+            }
+            pos += sizeof(header);
+            const uint8_t* payload = file_ + pos;
+            pos += header.size;
+            if (!IsCall(header.op)) {
+                continue;
+            }
+            uint64_t startTime = UIRenderTrace::GetTime();
+            if (!Execute(header, payload, targets_[header.target])) {
+                return false;
+            }
+            uint64_t duration = UIRenderTrace::GetTime() - startTime;
+            CallTiming& call = calls_[callIndex++];
+            if (duration < call.replayTime) {
+                call.replayTime = static_cast<uint32_t>(duration);
+            }
+        }
+        engine_->MemoryBarrier();
+    }
+    return true;
+}
+
+bool GfxReplayer::Execute(const RecHeader& header, const uint8_t* payload, BufferInfo& dst)
+{
+    switch (header.op) {
+        case REC_DRAW_ARC: {
+            RecDrawArc arc;
+            if (memcpy_s(&arc, sizeof(arc), payload, sizeof(arc)) != EOK) {
+                return false;
+            }
+            Style style;
+            ToStyle(arc.style, style);
+            ArcInfo arcInfo = {{arc.centerX, arc.centerY}, {arc.imageX, arc.imageY}, arc.radius, arc.startAngle,
+                               arc.endAngle, nullptr};
+            Image image;
+            ImageInfo imageInfo = {};
+            if (arc.imageData != REC_NO_DATA) {
+                imageInfo.header.width = arc.imageWidth;
+                imageInfo.header.height = arc.imageHeight;
+                imageInfo.header.colorMode = arc.imageColorMode;
+                imageInfo.dataSize = (arc.imageData < dataNum_) ? dataSizes_[arc.imageData] : 0;
+                imageInfo.data = GetData(arc.imageData, imageInfo.dataSize);
+                if ((imageInfo.data != nullptr) && image.SetSrc(&imageInfo)) {
+                    arcInfo.imgSrc = &image;
+                }
+            }
+            engine_->DrawArc(dst, arcInfo, ToRect(arc.mask), style, arc.opacity, arc.cap);
+            break;
+        }
+        case REC_DRAW_LINE: {
+            RecDrawLine line;
+            if (memcpy_s(&line, sizeof(line), payload, sizeof(line)) != EOK) {
+                return false;
+            }
+            engine_->DrawLine(dst, {line.startX, line.startY}, {line.endX, line.endY}, ToRect(line.mask), line.width,
+                              ToColor(line.color), line.opacity);
+            break;
+        }
+        case REC_DRAW_LETTER: {
+            RecDrawLetter letter;
+            if (memcpy_s(&letter, sizeof(letter), payload, sizeof(letter)) != EOK) {
+                return false;
+            }
+            Rect fontRect = ToRect(letter.fontRect);
+            // 7, 3: rows of the glyph are padded to whole bytes
+            uint32_t rowSize = (static_cast<uint32_t>(fontRect.GetWidth()) * letter.fontWeight + 7) >> 3;
+            const uint8_t* fontMap = GetData(letter.fontMap, rowSize * fontRect.GetHeight());
+            if (fontMap == nullptr) {
+                skippedNum_++;
+                break;
+            }
+            engine_->DrawLetter(dst, fontMap, fontRect, ToRect(letter.subRect), letter.fontWeight,
+                                ToColor(letter.color), letter.opacity);
+            break;
+        }
+        case REC_DRAW_CUBIC_BEZIER: {
+            RecDrawCubicBezier curve;
+            if (memcpy_s(&curve, sizeof(curve), payload, sizeof(curve)) != EOK) {
+                return false;
+            }
+            const int16_t* p = curve.points;
+            // 0 - 7: x and y of start, control1, control2 and end
+            engine_->DrawCubicBezier(dst, {p[0], p[1]}, {p[2], p[3]}, {p[4], p[5]}, {p[6], p[7]}, ToRect(curve.mask),
+                                     curve.width, ToColor(curve.color), curve.opacity);
+            break;
+        }
+        case REC_DRAW_RECT: {
+            RecDrawRect rect;
+            if (memcpy_s(&rect, sizeof(rect), payload, sizeof(rect)) != EOK) {
+                return false;
+            }
+            Style style;
+            ToStyle(rect.style, style);
+            engine_->DrawRect(dst, ToRect(rect.rect), ToRect(rect.dirtyRect), style, rect.opacity);
+            break;
+        }
+        case REC_DRAW_TRANSFORM: {
+            RecDrawTransform trans;
+            if (memcpy_s(&trans, sizeof(trans), payload, sizeof(trans)) != EOK) {
+                return false;
+            }
+            TransformDataInfo dataInfo = {};
+            dataInfo.header.width = trans.width;
+            dataInfo.header.height = trans.height;
+            dataInfo.header.colorMode = trans.colorMode;
+            // 7, 3: pxSize is in bits and the rows are padded to whole bytes
+            uint32_t rowSize = (static_cast<uint32_t>(trans.width) * trans.pxSize + 7) >> 3;
+            dataInfo.data = GetData(trans.data, rowSize * trans.height);
+            if (dataInfo.data == nullptr) {
+                skippedNum_++;
+                break;
+            }
+            dataInfo.pxSize = trans.pxSize;
+            dataInfo.blurLevel = static_cast<BlurLevel>(trans.blurLevel);
+            dataInfo.algorithm = static_cast<TransformAlgorithm>(trans.algorithm);
+            TransformMap transMap(ToRect(trans.mapRect));
+            Matrix4<float> matrix;
+            for (uint8_t row = 0; row < MATRIX_ORDER; row++) {
+                for (uint8_t col = 0; col < MATRIX_ORDER; col++) {
+                    matrix[row][col] = trans.matrix[row * MATRIX_ORDER + col];
+                }
+            }
+            transMap.SetMatrix(matrix);
+            engine_->DrawTransform(dst, ToRect(trans.mask), {trans.positionX, trans.positionY}, ToColor(trans.color),
+                                   trans.opacity, transMap, dataInfo);
+            break;
+        }
+        case REC_BLIT: {
+            RecBlit blit;
+            if (memcpy_s(&blit, sizeof(blit), payload, sizeof(blit)) != EOK) {
+                return false;
+            }
+            BufferInfo src = {};
+            src.rect = ToRect(blit.src.rect);
+            src.stride = blit.src.stride;
+            src.width = blit.src.width;
+            src.height = blit.src.height;
+            src.mode = static_cast<ColorMode>(blit.src.mode);
+            src.color = ToColor(blit.srcColor);
+            src.virAddr = const_cast<uint8_t*>(GetData(blit.data, src.stride * src.rect.GetHeight()));
+            if (src.virAddr == nullptr) {
+                skippedNum_++;
+                break;
+            }
+            BlendOption blendOption;
+            blendOption.mode = static_cast<BlendMode>(blit.blendMode);
+            blendOption.opacity = blit.opacity;
+            engine_->Blit(dst, {blit.dstX, blit.dstY}, src, ToRect(blit.subRect), blendOption);
+            break;
+        }
+        case REC_FILL: {
+            RecFill fill;
+            if (memcpy_s(&fill, sizeof(fill), payload, sizeof(fill)) != EOK) {
+                return false;
+            }
+            engine_->Fill(dst, ToRect(fill.area), ToColor(fill.color), fill.opacity);
+            break;
+        }
+        default:
+            /* the paths of the canvas are not recorded */
+            skippedNum_++;
+            break;
+    }
+    return true;
+}
+
+GfxReplayer::OpStats GfxReplayer::GetOpStats(uint8_t op) const
+{
+    OpStats stats = {0, 0, 0};
+    for (uint32_t i = 0; i < callNum_; i++) {
+        if (calls_[i].op != op) {
+            continue;
+        }
+        stats.count++;
+        stats.recordTime += calls_[i].recordTime;
+        if (calls_[i].replayTime != UINT32_MAX) {
+            stats.replayTime += calls_[i].replayTime;
+        }
+    }
+    return stats;
+}
+
+const char* GfxReplayer::GetOpName(uint8_t op)
+{
+    return (op < REC_OP_NUM) ? OP_NAMES[op] : "Unknown";
+}
+
+bool GfxReplayer::DumpReport(int32_t fd) const
+{
+    if (fd < 0) {
+        return false;
+    }
+    char line[REPORT_LINE_SIZE];
+    int32_t len = snprintf_s(line, sizeof(line), sizeof(line) - 1, "frame,call,op,target,record_us,replay_us\n");
+    bool ret = WriteLine(fd, line, len);
+    for (uint32_t i = 0; ret && (i < callNum_); i++) {
+        const CallTiming& call = calls_[i];
+        int64_t replayTime = (call.replayTime == UINT32_MAX) ? -1 : static_cast<int64_t>(call.replayTime);
+        len = snprintf_s(line, sizeof(line), sizeof(line) - 1, "%u,%u,%s,%u,%u,%lld\n", call.frame, i,
+                         GetOpName(call.op), call.target, call.recordTime, static_cast<long long>(replayTime));
+        ret = WriteLine(fd, line, len);
+    }
+    len = snprintf_s(line, sizeof(line), sizeof(line) - 1, "\nop,count,record_us,replay_us\n");
+    ret = ret && WriteLine(fd, line, len);
+    for (uint8_t op = REC_DRAW_ARC; ret && (op < REC_OP_NUM); op++) {
+        OpStats stats = GetOpStats(op);
+        if (stats.count == 0) {
+            continue;
+        }
+        len = snprintf_s(line, sizeof(line), sizeof(line) - 1, "%s,%u,%llu,%llu\n", GetOpName(op), stats.count,
+                         static_cast<unsigned long long>(stats.recordTime),
+                         static_cast<unsigned long long>(stats.replayTime));
+        ret = WriteLine(fd, line, len);
+    }
+    return ret;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
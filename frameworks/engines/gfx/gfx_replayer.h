@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_GFX_REPLAYER_H
+#define GRAPHIC_LITE_GFX_REPLAYER_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG
+#include "engines/gfx/gfx_engine_manager.h"
+#include "engines/gfx/gfx_record_format.h"
+
+namespace OHOS {
+/*
+ * Re-executes a file written by RecordingEngine against an engine, usually a SoftEngine, and times every call.
+ * The calls draw into headless buffers shaped like the buffers of the recording, so the replay needs no screen.
+ * Paths of the canvas are not in the recording and are skipped, so are the calls whose pixels were not recorded.
+ */
+class GfxReplayer : public HeapBase {
+public:
+    struct CallTiming {
+        uint32_t frame;
+        uint16_t target;
+        uint8_t op;
+        uint32_t recordTime; // microseconds on the recording device
+        uint32_t replayTime; // fastest replay in microseconds
+    };
+
+    struct OpStats {
+        uint32_t count;
+        uint64_t recordTime;
+        uint64_t replayTime;
+    };
+
+    explicit GfxReplayer(BaseGfxEngine* engine)
+        : engine_(engine),
+          file_(nullptr),
+          fileSize_(0),
+          targets_(nullptr),
+          targetNum_(0),
+          data_(nullptr),
+          dataSizes_(nullptr),
+          dataNum_(0),
+          calls_(nullptr),
+          callNum_(0),
+          frameNum_(0),
+          skippedNum_(0)
+    {
+    }
+    ~GfxReplayer();
+
+    /* Reads and checks the whole recording, returns false if it is broken. */
+    bool Load(const char* path);
+
+    /* Runs the recording loopNum times, keeping the fastest time of each call. */
+    bool Replay(uint16_t loopNum = 1);
+
+    /* Writes the timing of each call and the totals of each kind of call as CSV. */
+    bool DumpReport(int32_t fd) const;
+
+    uint32_t GetFrameNum() const
+    {
+        return frameNum_;
+    }
+
+    uint32_t GetCallNum() const
+    {
+        return callNum_;
+    }
+
+    /* Calls the last loop of Replay could not execute. */
+    uint32_t GetSkippedNum() const
+    {
+        return skippedNum_;
+    }
+
+    const CallTiming* GetCallTiming(uint32_t index) const
+    {
+        return (index < callNum_) ? &calls_[index] : nullptr;
+    }
+
+    OpStats GetOpStats(uint8_t op) const;
+
+    const BufferInfo* GetTarget(uint16_t id) const
+    {
+        return (id < targetNum_) ? &targets_[id] : nullptr;
+    }
+
+    static const char* GetOpName(uint8_t op);
+
+private:
+    static bool IsCall(uint8_t op)
+    {
+        return (op >= REC_DRAW_ARC) && (op < REC_OP_NUM);
+    }
+
+    static uint32_t GetPayloadSize(uint8_t op);
+    bool Parse();
+    bool CreateTarget(uint16_t id, const RecBuffer& buffer);
+    const uint8_t* GetData(uint32_t id, uint32_t size) const;
+    bool Execute(const RecHeader& header, const uint8_t* payload, BufferInfo& dst);
+    void Reset();
+
+    BaseGfxEngine* engine_;
+    uint8_t* file_;
+    uint32_t fileSize_;
+    BufferInfo* targets_;
+    uint16_t targetNum_;
+    const uint8_t** data_;
+    uint32_t* dataSizes_;
+    uint32_t dataNum_;
+    CallTiming* calls_;
+    uint32_t callNum_;
+    uint32_t frameNum_;
+    uint32_t skippedNum_;
+};
+} // namespace OHOS
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_GFX_REPLAYER_H
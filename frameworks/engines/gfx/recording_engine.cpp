@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engines/gfx/recording_engine.h"
+
+#if ENABLE_DEBUG
+#include "common/image.h"
+#include "dfx/ui_render_trace.h"
+#include "engines/gfx/gfx_record_format.h"
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint64_t FNV64_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV64_PRIME = 1099511628211ULL;
+constexpr uint8_t MATRIX_ORDER = 4;
+constexpr uint32_t DATA_ALIGN = 4;
+
+RecRect ToRecRect(const Rect& rect)
+{
+    return {rect.GetLeft(), rect.GetTop(), rect.GetRight(), rect.GetBottom()};
+}
+
+RecStyle ToRecStyle(const Style& style)
+{
+    RecStyle recStyle = {};
+    recStyle.bgColor = style.bgColor_.full;
+    recStyle.borderColor = style.borderColor_.full;
+    recStyle.lineColor = style.lineColor_.full;
+    recStyle.textColor = style.textColor_.full;
+    recStyle.borderRadius = style.borderRadius_;
+    recStyle.borderWidth = style.borderWidth_;
+    recStyle.lineWidth = style.lineWidth_;
+    recStyle.bgOpa = style.bgOpa_;
+    recStyle.borderOpa = style.borderOpa_;
+    recStyle.lineOpa = style.lineOpa_;
+    recStyle.lineCap = style.lineCap_;
+    recStyle.imageOpa = style.imageOpa_;
+    recStyle.textOpa = style.textOpa_;
+    return recStyle;
+}
+
+RecBuffer ToRecBuffer(const BufferInfo& info)
+{
+    RecBuffer buffer = {};
+    buffer.rect = ToRecRect(info.rect);
+    buffer.stride = info.stride;
+    buffer.width = info.width;
+    buffer.height = info.height;
+    buffer.mode = info.mode;
+    return buffer;
+}
+} // namespace
+
+bool RecordingEngine::TargetKey::operator<(const TargetKey& other) const
+{
+    if (addr != other.addr) {
+        return addr < other.addr;
+    }
+    if (stride != other.stride) {
+        return stride < other.stride;
+    }
+    if (width != other.width) {
+        return width < other.width;
+    }
+    if (height != other.height) {
+        return height < other.height;
+    }
+    if (left != other.left) {
+        return left < other.left;
+    }
+    if (top != other.top) {
+        return top < other.top;
+    }
+    return mode < other.mode;
+}
+
+RecordingEngine::RecordingEngine(BaseGfxEngine* target)
+    : target_(target), fd_(-1), error_(false), frameNum_(0), frameCount_(0), used_(0)
+{
+}
+
+RecordingEngine::~RecordingEngine()
+{
+    Stop();
+}
+
+bool RecordingEngine::Start(const char* path, uint32_t frameNum)
+{
+    if ((path == nullptr) || (target_ == nullptr)) {
+        return false;
+    }
+    Stop();
+    unlink(path);
+    fd_ = open(path, O_CREAT | O_RDWR, DEFAULT_FILE_PERMISSION);
+    if (fd_ < 0) {
+        GRAPHIC_LOGE("RecordingEngine::Start open file failed Err!\n");
+        return false;
+    }
+    error_ = false;
+    frameNum_ = frameNum;
+    frameCount_ = 0;
+    used_ = 0;
+    RecFileHeader header = {REC_FILE_MAGIC, REC_FILE_VERSION, target_->GetScreenWidth(),
+                            target_->GetScreenHeight(), 0};
+    Write(&header, sizeof(header));
+    return true;
+}
+
+void RecordingEngine::Stop()
+{
+    if (fd_ < 0) {
+        return;
+    }
+    FlushStaging();
+    if ((close(fd_) < 0) || error_) {
+        GRAPHIC_LOGE("RecordingEngine::Stop write file failed Err!\n");
+    }
+    fd_ = -1;
+    targets_.clear();
+    data_.clear();
+}
+
+void RecordingEngine::DrawArc(BufferInfo& dst,
+                              ArcInfo& arcInfo,
+                              const Rect& mask,
+                              const Style& style,
+                              OpacityType opacity,
+                              uint8_t cap)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawArc(dst, arcInfo, mask, style, opacity, cap);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecDrawArc payload = {};
+    payload.mask = ToRecRect(mask);
+    payload.style = ToRecStyle(style);
+    payload.imageData = REC_NO_DATA;
+    /* only the images with pixels in memory are recorded, the others are replayed as plain arcs */
+    const ImageInfo* imageInfo = (arcInfo.imgSrc != nullptr) ? arcInfo.imgSrc->GetImageInfo() : nullptr;
+    if ((imageInfo != nullptr) && (imageInfo->data != nullptr)) {
+        payload.imageData = GetDataId(imageInfo->data, imageInfo->dataSize);
+        payload.imageWidth = imageInfo->header.width;
+        payload.imageHeight = imageInfo->header.height;
+        payload.imageColorMode = imageInfo->header.colorMode;
+    }
+    payload.centerX = arcInfo.center.x;
+    payload.centerY = arcInfo.center.y;
+    payload.imageX = arcInfo.imgPos.x;
+    payload.imageY = arcInfo.imgPos.y;
+    payload.radius = arcInfo.radius;
+    payload.startAngle = arcInfo.startAngle;
+    payload.endAngle = arcInfo.endAngle;
+    payload.opacity = opacity;
+    payload.cap = cap;
+    WriteCall(REC_DRAW_ARC, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawLine(BufferInfo& dst,
+                               const Point& start,
+                               const Point& end,
+                               const Rect& mask,
+                               int16_t width,
+                               ColorType color,
+                               OpacityType opacity)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawLine(dst, start, end, mask, width, color, opacity);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecDrawLine payload = {ToRecRect(mask), color.full, start.x, start.y, end.x, end.y, width, opacity, 0};
+    WriteCall(REC_DRAW_LINE, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawLetter(BufferInfo& gfxDstBuffer,
+                                 const uint8_t* fontMap,
+                                 const Rect& fontRect,
+                                 const Rect& subRect,
+                                 const uint8_t fontWeight,
+                                 const ColorType& color,
+                                 const OpacityType opa)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawLetter(gfxDstBuffer, fontMap, fontRect, subRect, fontWeight, color, opa);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    // 7, 3: rows of the glyph are padded to whole bytes
+    uint32_t rowSize = (static_cast<uint32_t>(fontRect.GetWidth()) * fontWeight + 7) >> 3;
+    RecDrawLetter payload = {};
+    payload.fontRect = ToRecRect(fontRect);
+    payload.subRect = ToRecRect(subRect);
+    payload.fontMap = GetDataId(fontMap, rowSize * fontRect.GetHeight());
+    payload.color = color.full;
+    payload.fontWeight = fontWeight;
+    payload.opacity = opa;
+    WriteCall(REC_DRAW_LETTER, gfxDstBuffer, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawCubicBezier(BufferInfo& dst,
+                                      const Point& start,
+                                      const Point& control1,
+                                      const Point& control2,
+                                      const Point& end,
+                                      const Rect& mask,
+                                      int16_t width,
+                                      ColorType color,
+                                      OpacityType opacity)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawCubicBezier(dst, start, control1, control2, end, mask, width, color, opacity);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecDrawCubicBezier payload = {ToRecRect(mask),
+                                  color.full,
+                                  {start.x, start.y, control1.x, control1.y, control2.x, control2.y, end.x, end.y},
+                                  width,
+                                  opacity,
+                                  0};
+    WriteCall(REC_DRAW_CUBIC_BEZIER, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawRect(BufferInfo& dst,
+                               const Rect& rect,
+                               const Rect& dirtyRect,
+                               const Style& style,
+                               OpacityType opacity)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawRect(dst, rect, dirtyRect, style, opacity);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecDrawRect payload = {ToRecRect(rect), ToRecRect(dirtyRect), ToRecStyle(style), opacity, {}};
+    WriteCall(REC_DRAW_RECT, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawTransform(BufferInfo& dst,
+                                    const Rect& mask,
+                                    const Point& position,
+                                    ColorType color,
+                                    OpacityType opacity,
+                                    const TransformMap& transMap,
+                                    const TransformDataInfo& dataInfo)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawTransform(dst, mask, position, color, opacity, transMap, dataInfo);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecDrawTransform payload = {};
+    payload.mask = ToRecRect(mask);
+    TransformMap map = transMap;
+    payload.mapRect = ToRecRect(map.GetTransMapRect());
+    Matrix4<float> matrix = map.GetTransformMatrix();
+    for (uint8_t row = 0; row < MATRIX_ORDER; row++) {
+        for (uint8_t col = 0; col < MATRIX_ORDER; col++) {
+            payload.matrix[row * MATRIX_ORDER + col] = matrix[row][col];
+        }
+    }
+    // 7, 3: pxSize is in bits and the rows are padded to whole bytes
+    uint32_t rowSize = (static_cast<uint32_t>(dataInfo.header.width) * dataInfo.pxSize + 7) >> 3;
+    payload.data = GetDataId(dataInfo.data, rowSize * dataInfo.header.height);
+    payload.color = color.full;
+    payload.positionX = position.x;
+    payload.positionY = position.y;
+    payload.width = dataInfo.header.width;
+    payload.height = dataInfo.header.height;
+    payload.colorMode = dataInfo.header.colorMode;
+    payload.pxSize = dataInfo.pxSize;
+    payload.blurLevel = static_cast<uint8_t>(dataInfo.blurLevel);
+    payload.algorithm = static_cast<uint8_t>(dataInfo.algorithm);
+    payload.opacity = opacity;
+    WriteCall(REC_DRAW_TRANSFORM, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::Blit(BufferInfo& dst,
+                           const Point& dstPos,
+                           const BufferInfo& src,
+                           const Rect& subRect,
+                           const BlendOption& blendOption)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->Blit(dst, dstPos, src, subRect, blendOption);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecBlit payload = {};
+    payload.src = ToRecBuffer(src);
+    payload.subRect = ToRecRect(subRect);
+    payload.data = GetDataId(static_cast<const uint8_t*>(src.virAddr), src.stride * src.rect.GetHeight());
+    payload.srcColor = src.color.full;
+    payload.dstX = dstPos.x;
+    payload.dstY = dstPos.y;
+    payload.blendMode = static_cast<uint8_t>(blendOption.mode);
+    payload.opacity = blendOption.opacity;
+    WriteCall(REC_BLIT, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::Fill(BufferInfo& dst, const Rect& fillArea, const ColorType color, const OpacityType opacity)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->Fill(dst, fillArea, color, opacity);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecFill payload = {ToRecRect(fillArea), color.full, opacity, {}};
+    WriteCall(REC_FILL, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::DrawPath(BufferInfo& dst,
+                               void* param,
+                               const Paint& paint,
+                               const Rect& rect,
+                               const Rect& invalidatedArea,
+                               const Style& style)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->DrawPath(dst, param, paint, rect, invalidatedArea, style);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecPath payload = {ToRecRect(rect), ToRecRect(invalidatedArea), ToRecStyle(style)};
+    WriteCall(REC_DRAW_PATH, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::FillPath(BufferInfo& dst,
+                               void* param,
+                               const Paint& paint,
+                               const Rect& rect,
+                               const Rect& invalidatedArea,
+                               const Style& style)
+{
+    uint64_t startTime = IsRecording() ? UIRenderTrace::GetTime() : 0;
+    target_->FillPath(dst, param, paint, rect, invalidatedArea, style);
+    if (!IsRecording()) {
+        return;
+    }
+    uint32_t duration = GetDuration(startTime);
+    RecPath payload = {ToRecRect(rect), ToRecRect(invalidatedArea), ToRecStyle(style)};
+    WriteCall(REC_FILL_PATH, dst, duration, &payload, sizeof(payload));
+}
+
+void RecordingEngine::Flush(const Rect& flushRect)
+{
+    target_->Flush(flushRect);
+    if (!IsRecording()) {
+        return;
+    }
+    RecFrame frame = {ToRecRect(flushRect)};
+    WriteHeader(REC_FRAME, 0, sizeof(frame), 0);
+    Write(&frame, sizeof(frame));
+    frameCount_++;
+    if (error_ || ((frameNum_ != 0) && (frameCount_ >= frameNum_))) {
+        Stop();
+    }
+}
+
+uint16_t RecordingEngine::GetTargetId(const BufferInfo& dst)
+{
+    TargetKey key = {dst.virAddr, dst.stride, dst.width, dst.height, dst.rect.GetLeft(), dst.rect.GetTop(), dst.mode};
+    auto iter = targets_.find(key);
+    if (iter != targets_.end()) {
+        return iter->second;
+    }
+    uint16_t id = static_cast<uint16_t>(targets_.size());
+    targets_[key] = id;
+    RecBuffer buffer = ToRecBuffer(dst);
+    WriteHeader(REC_TARGET, id, sizeof(buffer), 0);
+    Write(&buffer, sizeof(buffer));
+    return id;
+}
+
+uint32_t RecordingEngine::GetDataId(const uint8_t* data, uint32_t size)
+{
+    if ((data == nullptr) || (size == 0)) {
+        return REC_NO_DATA;
+    }
+    /* the same pixels are stored once, whichever address they are drawn from */
+    uint64_t hash = FNV64_OFFSET_BASIS ^ size;
+    for (uint32_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * FNV64_PRIME;
+    }
+    auto iter = data_.find(hash);
+    if (iter != data_.end()) {
+        return iter->second;
+    }
+    uint32_t id = static_cast<uint32_t>(data_.size());
+    data_[hash] = id;
+    RecData recData = {id, size};
+    /* padded, so the records behind stay aligned for the replay */
+    uint32_t padding = ((size + DATA_ALIGN - 1) & ~(DATA_ALIGN - 1)) - size;
+    WriteHeader(REC_DATA, 0, sizeof(recData) + size + padding, 0);
+    Write(&recData, sizeof(recData));
+    Write(data, size);
+    const uint8_t zeros[DATA_ALIGN] = {0};
+    Write(zeros, padding);
+    return id;
+}
+
+uint32_t RecordingEngine::GetDuration(uint64_t startTime)
+{
+    uint64_t duration = UIRenderTrace::GetTime() - startTime;
+    return (duration > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(duration);
+}
+
+void RecordingEngine::WriteCall(uint8_t op, const BufferInfo& dst, uint32_t duration, const void* payload,
+                                uint32_t size)
+{
+    uint16_t target = GetTargetId(dst);
+    WriteHeader(op, target, size, duration);
+    Write(payload, size);
+}
+
+void RecordingEngine::WriteHeader(uint8_t op, uint16_t target, uint32_t size, uint32_t duration)
+{
+    RecHeader header = {op, 0, target, size, duration};
+    Write(&header, sizeof(header));
+}
+
+void RecordingEngine::Write(const void* data, uint32_t size)
+{
+    if (error_) {
+        return;
+    }
+    if (used_ + size > STAGING_SIZE) {
+        FlushStaging();
+    }
+    if (size > STAGING_SIZE) {
+        /* large images go to the file directly */
+        if (static_cast<uint32_t>(write(fd_, data, size)) != size) {
+            error_ = true;
+        }
+        return;
+    }
+    if (memcpy_s(staging_ + used_, STAGING_SIZE - used_, data, size) != EOK) {
+        error_ = true;
+        return;
+    }
+    used_ += size;
+}
+
+void RecordingEngine::FlushStaging()
+{
+    if ((used_ == 0) || error_) {
+        used_ = 0;
+        return;
+    }
+    if (static_cast<uint32_t>(write(fd_, staging_, used_)) != used_) {
+        error_ = true;
+    }
+    used_ = 0;
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -17,6 +17,7 @@
 
 #include <cstdlib>
 
+#include "dfx/ui_render_trace.h"
 #include "draw/clip_utils.h"
 #include "draw/draw_arc.h"
 #include "draw/draw_canvas.h"
@@ -32,6 +33,7 @@ void SoftEngine::DrawArc(BufferInfo& dst,
                          OpacityType opacity,
                          uint8_t cap)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawArc");
     DrawArc::GetInstance()->Draw(dst, arcInfo, mask, style, opacity, cap);
 }
 
@@ -43,6 +45,7 @@ void SoftEngine::DrawLine(BufferInfo& dst,
                           ColorType color,
                           OpacityType opacity)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawLine");
     DrawLine::Draw(dst, start, end, mask, width, color, opacity);
 }
 
@@ -54,6 +57,7 @@ void SoftEngine::DrawLetter(BufferInfo& gfxDstBuffer,
                             const ColorType& color,
                             const OpacityType opa)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawLetter");
     DrawUtils::GetInstance()->DrawLetter(gfxDstBuffer, fontMap, fontRect, subRect, fontWeight, color, opa);
 }
 
@@ -67,6 +71,7 @@ void SoftEngine::DrawCubicBezier(BufferInfo& dst,
                                  ColorType color,
                                  OpacityType opacity)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawCubicBezier");
     DrawCurve::DrawCubicBezier(dst, start, control1, control2, end, mask, width, color, opacity);
 }
 
@@ -76,6 +81,7 @@ void SoftEngine::DrawRect(BufferInfo& dst,
                           const Style& style,
                           OpacityType opacity)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawRect");
     DrawRect::Draw(dst, rect, dirtyRect, style, opacity);
 }
 
@@ -87,11 +93,13 @@ void SoftEngine::DrawTransform(BufferInfo& dst,
                                const TransformMap& transMap,
                                const TransformDataInfo& dataInfo)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawTransform");
     DrawUtils::GetInstance()->DrawTransform(dst, mask, position, color, opacity, transMap, dataInfo);
 }
 
 void SoftEngine::ClipCircle(const ImageInfo* info, float x, float y, float radius)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::ClipCircle");
     ClipPath path;
     path.Circle(PointF(x, y), radius);
     ClipUtils clip;
@@ -104,6 +112,7 @@ void SoftEngine::Blit(BufferInfo& dst,
                       const Rect& subRect,
                       const BlendOption& blendOption)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::Blit");
     DrawUtils::GetInstance()->BlendWithSoftWare(
         static_cast<uint8_t*>(src.virAddr), src.rect, src.stride, src.rect.GetHeight(), src.mode, src.color,
         blendOption.opacity, static_cast<uint8_t*>(dst.virAddr), dst.stride, dst.mode, subRect.GetX(), subRect.GetY());
@@ -111,6 +120,7 @@ void SoftEngine::Blit(BufferInfo& dst,
 
 void SoftEngine::Fill(BufferInfo& dst, const Rect& fillArea, const ColorType color, const OpacityType opacity)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::Fill");
     DrawUtils::GetInstance()->FillAreaWithSoftWare(dst, fillArea, color, opacity);
 }
 
@@ -121,6 +131,7 @@ void SoftEngine::DrawPath(BufferInfo& dst,
                           const Rect& invalidatedArea,
                           const Style& style)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::DrawPath");
 #if defined(ENABLE_CANVAS_EXTEND) && ENABLE_CANVAS_EXTEND
     DrawCanvas::DoRender(dst, param, paint, rect, invalidatedArea, style, true);
 #endif
@@ -133,6 +144,7 @@ void SoftEngine::FillPath(BufferInfo& dst,
                           const Rect& invalidatedArea,
                           const Style& style)
 {
+    UI_RENDER_TRACE_SCOPE("SoftEngine::FillPath");
 #if defined(ENABLE_CANVAS_EXTEND) && ENABLE_CANVAS_EXTEND
     DrawCanvas::DoRender(dst, param, paint, rect, invalidatedArea, style, false);
 #endif
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/glyph_disk_cache.h"
+
+#include "gfx_utils/file.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+#include "securec.h"
+
+namespace OHOS {
+namespace {
+constexpr uint32_t FNV_OFFSET_BASIS = 2166136261;
+constexpr uint32_t FNV_PRIME = 16777619;
+// the sfnt header and table directory, which carries the checksum of every table, fit in the head of the file
+constexpr uint32_t HASH_HEAD_SIZE = 4096;
+constexpr int32_t MAX_GLYPH_EDGE = 1024;
+constexpr uint8_t FILE_NAME_LEN = 32;
+
+uint32_t HashBytes(uint32_t hash, const uint8_t* data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+int32_t OpenFile(const char* path, int32_t flags)
+{
+#ifdef _WIN32
+    return open(path, flags | O_BINARY, DEFAULT_FILE_PERMISSION);
+#else
+    return open(path, flags, DEFAULT_FILE_PERMISSION);
+#endif
+}
+} // namespace
+
+uint32_t GlyphDiskCache::HashFontFile(const char* fontPath, int32_t faceIndex)
+{
+    int32_t fd = OpenFile(fontPath, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    int32_t fileLen = lseek(fd, 0, SEEK_END);
+    if ((fileLen <= 0) || (lseek(fd, 0, SEEK_SET) != 0)) {
+        close(fd);
+        return 0;
+    }
+    uint8_t head[HASH_HEAD_SIZE];
+    uint32_t headLen = (static_cast<uint32_t>(fileLen) < HASH_HEAD_SIZE) ? fileLen : HASH_HEAD_SIZE;
+    int32_t readLen = read(fd, head, headLen);
+    close(fd);
+    if (readLen != static_cast<int32_t>(headLen)) {
+        return 0;
+    }
+    uint32_t hash = HashBytes(FNV_OFFSET_BASIS, reinterpret_cast<const uint8_t*>(&fileLen), sizeof(fileLen));
+    hash = HashBytes(hash, reinterpret_cast<const uint8_t*>(&faceIndex), sizeof(faceIndex));
+    return HashBytes(hash, head, headLen);
+}
+
+bool GlyphDiskCache::Init(const char* dir, const GlyphRasterizer::FontFace& font)
+{
+    if ((dir == nullptr) || (font.path == nullptr)) {
+        return false;
+    }
+    fontHash_ = HashFontFile(font.path, font.faceIndex);
+    if (fontHash_ == 0) {
+        return false;
+    }
+    fontSize_ = font.fontSize;
+    char name[FILE_NAME_LEN];
+    if (snprintf_s(name, sizeof(name), sizeof(name) - 1, "%08x_%u.glyph", fontHash_, fontSize_) < 0) {
+        return false;
+    }
+    path_ = dir;
+    if (!path_.empty() && (path_.back() != '/')) {
+        path_.append("/");
+    }
+    path_.append(name);
+    return true;
+}
+
+bool GlyphDiskCache::ReadHeader(int32_t fd, CacheHeader& header) const
+{
+    if ((lseek(fd, 0, SEEK_SET) != 0) || (read(fd, &header, sizeof(header)) != sizeof(header))) {
+        return false;
+    }
+    return (header.magic == CACHE_MAGIC) && (header.version == CACHE_VERSION) && (header.fontHash == fontHash_) &&
+           (header.fontSize == fontSize_);
+}
+
+RasterizedGlyph* GlyphDiskCache::Find(RasterizedGlyph* glyphs, uint32_t num, uint32_t unicode)
+{
+    uint32_t low = 0;
+    uint32_t high = num;
+    while (low < high) {
+        uint32_t mid = low + ((high - low) >> 1);
+        if (glyphs[mid].unicode == unicode) {
+            return &glyphs[mid];
+        }
+        if (glyphs[mid].unicode < unicode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t GlyphDiskCache::Load(RasterizedGlyph* glyphs, uint32_t num) const
+{
+    if (path_.empty() || (glyphs == nullptr)) {
+        return 0;
+    }
+    int32_t fd = OpenFile(path_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    CacheHeader header;
+    if (!ReadHeader(fd, header)) {
+        close(fd);
+        return 0;
+    }
+    uint32_t loadNum = 0;
+    for (uint32_t i = 0; i < header.glyphNum; i++) {
+        CacheRecord record;
+        if (read(fd, &record, sizeof(record)) != sizeof(record)) {
+            break;
+        }
+        if ((record.cols < 0) || (record.cols > MAX_GLYPH_EDGE) || (record.rows < 0) ||
+            (record.rows > MAX_GLYPH_EDGE)) {
+            GRAPHIC_LOGE("GlyphDiskCache::Load broken record");
+            break;
+        }
+        ColorMode mode = static_cast<ColorMode>(record.mode);
+        int32_t size = record.cols * record.rows * GlyphRasterizer::GetPxSize(mode);
+        RasterizedGlyph* glyph = Find(glyphs, num, record.unicode);
+        if ((glyph == nullptr) || (glyph->state != GLYPH_PENDING)) {
+            if (lseek(fd, size, SEEK_CUR) < 0) {
+                break;
+            }
+            continue;
+        }
+        glyph->bitmap = nullptr;
+        if (size > 0) {
+            glyph->bitmap = static_cast<uint8_t*>(UIMalloc(size));
+            if ((glyph->bitmap == nullptr) || (read(fd, glyph->bitmap, size) != size)) {
+                UIFree(glyph->bitmap);
+                glyph->bitmap = nullptr;
+                break;
+            }
+        }
+        glyph->left = record.left;
+        glyph->top = record.top;
+        glyph->cols = record.cols;
+        glyph->rows = record.rows;
+        glyph->advance = record.advance;
+        glyph->mode = mode;
+        glyph->state = GLYPH_LOADED;
+        loadNum++;
+    }
+    close(fd);
+    return loadNum;
+}
+
+bool GlyphDiskCache::Append(const RasterizedGlyph* glyphs, uint32_t num) const
+{
+    if (path_.empty() || (glyphs == nullptr)) {
+        return false;
+    }
+    int32_t fd = OpenFile(path_.c_str(), O_RDWR | O_CREAT);
+    if (fd < 0) {
+        GRAPHIC_LOGE("GlyphDiskCache::Append open file failed");
+        return false;
+    }
+    CacheHeader header;
+    if (!ReadHeader(fd, header)) {
+        header = {CACHE_MAGIC, CACHE_VERSION, fontHash_, fontSize_, 0, 0};
+    }
+    bool ret = (lseek(fd, sizeof(header) + header.dataSize, SEEK_SET) >= 0);
+    for (uint32_t i = 0; ret && (i < num); i++) {
+        const RasterizedGlyph& glyph = glyphs[i];
+        if (glyph.state != GLYPH_RASTERIZED) {
+            continue;
+        }
+        CacheRecord record = {glyph.unicode, glyph.left,    glyph.top, glyph.cols, glyph.rows, glyph.advance,
+                              static_cast<uint32_t>(glyph.mode)};
+        int32_t size = glyph.cols * glyph.rows * GlyphRasterizer::GetPxSize(glyph.mode);
+        if (glyph.bitmap == nullptr) {
+            /* a glyph whose outline has no pixels, such as a space */
+            record.cols = 0;
+            record.rows = 0;
+            size = 0;
+        }
+        ret = (write(fd, &record, sizeof(record)) == sizeof(record)) &&
+              ((size == 0) || (write(fd, glyph.bitmap, size) == size));
+        if (ret) {
+            header.glyphNum++;
+            header.dataSize += sizeof(record) + size;
+        }
+    }
+    /* the records written before a failure are still valid */
+    bool headerRet = (lseek(fd, 0, SEEK_SET) == 0) && (write(fd, &header, sizeof(header)) == sizeof(header));
+    if (close(fd) < 0) {
+        return false;
+    }
+    return ret && headerRet;
+}
+} // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GLYPH_DISK_CACHE_H
+#define GLYPH_DISK_CACHE_H
+
+#include <string>
+#include "font/glyph_rasterizer.h"
+
+namespace OHOS {
+/*
+ * Keeps preloaded glyphs of one font face and size in a file, so they survive restarts.
+ * The file is named after a hash of the font file, which changes whenever the font is replaced:
+ *
+ *   Header | Record | bitmap | Record | bitmap | ...
+ *
+ * New glyphs are appended and the glyph number in the header is updated afterwards, so an interrupted append
+ * only loses the glyphs being appended.
+ */
+class GlyphDiskCache : public HeapBase {
+public:
+    GlyphDiskCache() : fontHash_(0), fontSize_(0) {}
+    ~GlyphDiskCache() {}
+
+    /* Returns false if the font file can not be read. */
+    bool Init(const char* dir, const GlyphRasterizer::FontFace& font);
+
+    /* Loads the pending glyphs found in the file, glyphs must be sorted by unicode. */
+    uint32_t Load(RasterizedGlyph* glyphs, uint32_t num) const;
+
+    /* Appends the rasterized glyphs. */
+    bool Append(const RasterizedGlyph* glyphs, uint32_t num) const;
+
+    const std::string& GetPath() const
+    {
+        return path_;
+    }
+
+    static uint32_t HashFontFile(const char* fontPath, int32_t faceIndex);
+
+private:
+    static constexpr uint32_t CACHE_MAGIC = 0x43594C47; // "GLYC"
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t fontHash;
+        uint32_t fontSize;
+        uint32_t glyphNum;
+        uint32_t dataSize; // bytes of the records, anything behind is left by an interrupted append
+    };
+
+    struct CacheRecord {
+        uint32_t unicode;
+        int32_t left;
+        int32_t top;
+        int32_t cols;
+        int32_t rows;
+        int32_t advance;
+        uint32_t mode;
+    };
+
+    bool ReadHeader(int32_t fd, CacheHeader& header) const;
+    static RasterizedGlyph* Find(RasterizedGlyph* glyphs, uint32_t num, uint32_t unicode);
+
+    std::string path_;
+    uint32_t fontHash_;
+    uint8_t fontSize_;
+};
+} // namespace OHOS
+#endif // GLYPH_DISK_CACHE_H
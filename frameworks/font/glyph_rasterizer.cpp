@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/glyph_rasterizer.h"
+
+#include <atomic>
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "gfx_utils/mem_api.h"
+#include "securec.h"
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <pthread.h>
+#endif
+
+namespace OHOS {
+struct GlyphRasterizer::RasterTask {
+    const FontFace* font;
+    RasterizedGlyph* glyphs;
+    uint32_t num;
+    std::atomic<uint32_t> next;
+};
+
+int8_t GlyphRasterizer::SetFaceSize(FT_Face face, uint8_t fontSize, bool isColor)
+{
+    if (!isColor) {
+        return (FT_Set_Char_Size(face, fontSize * FONT_PIXEL_IN_POINT, 0, 0, 0) == 0) ? RET_VALUE_OK
+                                                                                      : INVALID_RET_VALUE;
+    }
+    if (face->num_fixed_sizes == 0) {
+        return INVALID_RET_VALUE;
+    }
+    FT_Int bestMatch = 0;
+    int32_t diff = MATH_ABS(fontSize - face->available_sizes[0].width);
+    for (int32_t i = 1; i < face->num_fixed_sizes; ++i) {
+        int32_t ndiff = MATH_ABS(fontSize - face->available_sizes[i].width);
+        if (ndiff < diff) {
+            bestMatch = i;
+            diff = ndiff;
+        }
+    }
+    return (FT_Select_Size(face, bestMatch) == 0) ? RET_VALUE_OK : INVALID_RET_VALUE; // FT_Match_Size
+}
+
+void GlyphRasterizer::Rasterize(const FontFace& font, RasterizedGlyph* glyphs, uint32_t num, uint8_t threadNum)
+{
+    if ((font.path == nullptr) || (glyphs == nullptr) || (num == 0)) {
+        return;
+    }
+    RasterTask task;
+    task.font = &font;
+    task.glyphs = glyphs;
+    task.num = num;
+    task.next.store(0, std::memory_order_relaxed);
+
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+    threadNum = MATH_MIN(threadNum, MAX_THREAD_NUM);
+    pthread_t workers[MAX_THREAD_NUM];
+    uint8_t startedNum = 0;
+    /* the calling thread is one of the workers */
+    for (uint8_t i = 1; i < threadNum; i++) {
+        if (pthread_create(&workers[startedNum], nullptr, WorkerMain, &task) != 0) {
+            GRAPHIC_LOGE("GlyphRasterizer create worker failed");
+            break;
+        }
+        startedNum++;
+    }
+    RasterizeLoop(&task);
+    for (uint8_t i = 0; i < startedNum; i++) {
+        pthread_join(workers[i], nullptr);
+    }
+#else
+    RasterizeLoop(&task);
+#endif
+}
+
+void* GlyphRasterizer::WorkerMain(void* arg)
+{
+    RasterizeLoop(static_cast<RasterTask*>(arg));
+    return nullptr;
+}
+
+void GlyphRasterizer::RasterizeLoop(RasterTask* task)
+{
+    FT_Library library = nullptr;
+    if (FT_Init_FreeType(&library) != 0) {
+        return;
+    }
+    FT_Face face = nullptr;
+    const FontFace* font = task->font;
+    if ((FT_New_Face(library, font->path, font->faceIndex, &face) != 0) ||
+        (SetFaceSize(face, font->fontSize, font->isColor) != RET_VALUE_OK)) {
+        GRAPHIC_LOGE("GlyphRasterizer open font face failed");
+        FT_Done_FreeType(library);
+        return;
+    }
+    /* glyphs are claimed one by one, so the workers stay busy however the glyph sizes differ */
+    uint32_t index = task->next.fetch_add(1, std::memory_order_relaxed);
+    while (index < task->num) {
+        if (task->glyphs[index].state == GLYPH_PENDING) {
+            RasterizeGlyph(face, font->isColor, task->glyphs[index]);
+        }
+        index = task->next.fetch_add(1, std::memory_order_relaxed);
+    }
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+}
+
+void GlyphRasterizer::RasterizeGlyph(FT_Face face, bool isColor, RasterizedGlyph& glyph)
+{
+    glyph.state = GLYPH_MISSING;
+    int32_t error = FT_Load_Char(face, glyph.unicode, isColor ? FT_LOAD_COLOR : FT_LOAD_RENDER);
+    if ((error != 0) || (face->glyph->glyph_index == 0)) {
+        return;
+    }
+    FT_GlyphSlot slot = face->glyph;
+    glyph.left = slot->bitmap_left;
+    glyph.top = slot->bitmap_top;
+    glyph.cols = slot->bitmap.width;
+    glyph.rows = slot->bitmap.rows;
+    glyph.advance = static_cast<uint16_t>(slot->advance.x / FONT_PIXEL_IN_POINT);
+    glyph.mode = (slot->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA) ? ARGB8888 : A8;
+    glyph.bitmap = nullptr;
+
+    uint32_t rowSize = static_cast<uint32_t>(glyph.cols) * GetPxSize(glyph.mode);
+    uint32_t size = rowSize * glyph.rows;
+    if ((size > 0) && (slot->bitmap.buffer != nullptr)) {
+        glyph.bitmap = static_cast<uint8_t*>(UIMalloc(size));
+        if (glyph.bitmap == nullptr) {
+            return;
+        }
+        const uint8_t* src = slot->bitmap.buffer;
+        for (int32_t row = 0; row < glyph.rows; row++) {
+            if (memcpy_s(glyph.bitmap + row * rowSize, rowSize, src, rowSize) != EOK) {
+                UIFree(glyph.bitmap);
+                glyph.bitmap = nullptr;
+                return;
+            }
+            src += slot->bitmap.pitch;
+        }
+    }
+    glyph.state = GLYPH_RASTERIZED;
+}
+
+void GlyphRasterizer::FreeGlyphs(RasterizedGlyph* glyphs, uint32_t num)
+{
+    if (glyphs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (glyphs[i].bitmap != nullptr) {
+            UIFree(glyphs[i].bitmap);
+            glyphs[i].bitmap = nullptr;
+        }
+    }
+}
+} // namespace OHOS
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GLYPH_RASTERIZER_H
+#define GLYPH_RASTERIZER_H
+
+#include "ft2build.h"
+#include "freetype/freetype.h"
+#include "font/ui_font_header.h"
+#include "gfx_utils/graphic_buffer.h"
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+enum GlyphState : uint8_t {
+    GLYPH_PENDING,
+    GLYPH_LOADED,     // read from the disk cache
+    GLYPH_RASTERIZED, // rasterized by the preloading, not on disk yet
+    GLYPH_MISSING,    // not in the font
+};
+
+/* A glyph rasterized outside of the bitmap cache, bitmap holds cols * rows pixels without line padding. */
+struct RasterizedGlyph {
+    uint32_t unicode;
+    int32_t left;
+    int32_t top;
+    int32_t cols;
+    int32_t rows;
+    int32_t advance;
+    uint8_t* bitmap;
+    ColorMode mode;
+    GlyphState state;
+};
+
+/*
+ * Rasterizes glyphs on worker threads. FreeType objects must not be shared between threads, so every worker opens
+ * its own library and face of the font file, and nothing but the glyph array is touched by the workers.
+ */
+class GlyphRasterizer : public HeapBase {
+public:
+    static constexpr uint8_t MAX_THREAD_NUM = 4;
+
+    struct FontFace {
+        const char* path;
+        int32_t faceIndex;
+        uint8_t fontSize;
+        bool isColor;
+    };
+
+    /* Color fonts only have fixed sizes, the one closest to fontSize is selected. */
+    static int8_t SetFaceSize(FT_Face face, uint8_t fontSize, bool isColor);
+
+    /* Rasterizes the pending glyphs and blocks until all of them are done. */
+    static void Rasterize(const FontFace& font, RasterizedGlyph* glyphs, uint32_t num, uint8_t threadNum);
+
+    static void FreeGlyphs(RasterizedGlyph* glyphs, uint32_t num);
+
+    static uint8_t GetPxSize(ColorMode mode)
+    {
+        return (mode == ARGB8888) ? 4 : 1; // 4: bytes of a color glyph pixel
+    }
+
+private:
+    struct RasterTask;
+
+    static void* WorkerMain(void* arg);
+    static void RasterizeLoop(RasterTask* task);
+    static void RasterizeGlyph(FT_Face face, bool isColor, RasterizedGlyph& glyph);
+};
+} // namespace OHOS
+#endif // GLYPH_RASTERIZER_H
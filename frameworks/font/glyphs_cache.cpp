@@ -20,9 +20,25 @@
 #include "securec.h"
 
 namespace OHOS {
+namespace {
+constexpr uint32_t MAX_CAPACITY = 1 << 20;
+/* odd constants of multiplicative hashing, they spread the bits of the key over the word */
+constexpr uint32_t UNICODE_HASH_FACTOR = 0x9E3779B1;
+constexpr uint32_t FONT_HASH_FACTOR = 0x85EBCA77;
+constexpr uint8_t FONT_KEY_SHIFT = 8;
+constexpr uint8_t HASH_FOLD_SHIFT = 16;
+} // namespace
+
 GlyphsCache::GlyphsCache()
-    : nodeCache_(nullptr),
-      cacheStatus_(nullptr),
+    : nodes_(nullptr),
+      nodeFlags_(nullptr),
+      capacity_(DEFAULT_CAPACITY),
+      mask_(DEFAULT_CAPACITY - 1),
+      nodeNum_(0),
+      hand_(0),
+      hitNum_(0),
+      missNum_(0),
+      evictNum_(0),
       hasInit_(false)
 {
 }
@@ -34,76 +50,192 @@ int8_t GlyphsCache::CacheInit()
         return RET_VALUE_OK;
     }
 
-    cacheStatus_ = reinterpret_cast<CacheState*>(FontRamAllocator::GetInstance().DynamicAllocate(sizeof(CacheState)));
-    if (cacheStatus_ == nullptr) {
-        GRAPHIC_LOGE("GlyphsCache::CacheInit allocate cache status failed");
+    nodeFlags_ = reinterpret_cast<uint8_t*>(FontRamAllocator::GetInstance().DynamicAllocate(capacity_));
+    if (nodeFlags_ == nullptr) {
+        GRAPHIC_LOGE("GlyphsCache::CacheInit allocate node flags failed");
         return INVALID_RET_VALUE;
     }
 
-    if (memset_s(cacheStatus_, sizeof(CacheState), 0, sizeof(CacheState)) != EOK) {
-        GRAPHIC_LOGE("GlyphsCache::CacheInit init cache status failed");
+    if (memset_s(nodeFlags_, capacity_, 0, capacity_) != EOK) {
+        GRAPHIC_LOGE("GlyphsCache::CacheInit init node flags failed");
+        FreeCache();
         return INVALID_RET_VALUE;
     }
 
-    nodeCache_ = reinterpret_cast<CacheType*>(FontRamAllocator::GetInstance().DynamicAllocate(sizeof(CacheType)));
-    if (nodeCache_ == nullptr) {
+    /* the nodes are read only when their flags say they are used */
+    nodes_ = reinterpret_cast<GlyphCacheNode*>(
+        FontRamAllocator::GetInstance().DynamicAllocate(capacity_ * sizeof(GlyphCacheNode)));
+    if (nodes_ == nullptr) {
         GRAPHIC_LOGE("GlyphsCache::CacheInit allocate node cache failed");
+        FreeCache();
         return INVALID_RET_VALUE;
     }
 
-    if (memset_s(nodeCache_, sizeof(CacheType), 0, sizeof(CacheType)) != EOK) {
-        GRAPHIC_LOGE("GlyphsCache::CacheInit init node cache failed");
-        return INVALID_RET_VALUE;
-    }
-
+    mask_ = capacity_ - 1;
+    nodeNum_ = 0;
+    hand_ = 0;
     hasInit_ = true;
     return RET_VALUE_OK;
 }
 
 void GlyphsCache::ClearCacheFlag()
 {
+    /* the memory of the cache is dropped with the font ram */
+    nodes_ = nullptr;
+    nodeFlags_ = nullptr;
+    nodeNum_ = 0;
     hasInit_ = false;
 }
 
-GlyphCacheNode* GlyphsCache::GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType)
+void GlyphsCache::FreeCache()
+{
+    FontRamAllocator::GetInstance().DynamicFree(nodes_);
+    FontRamAllocator::GetInstance().DynamicFree(nodeFlags_);
+    ClearCacheFlag();
+}
+
+int8_t GlyphsCache::SetCapacity(uint32_t nodeNum)
 {
+    if (nodeNum > MAX_CAPACITY) {
+        GRAPHIC_LOGE("GlyphsCache::SetCapacity invalid node number");
+        return INVALID_RET_VALUE;
+    }
+    uint32_t capacity = MIN_CAPACITY;
+    while (capacity < nodeNum) {
+        capacity <<= 1;
+    }
+    if (capacity == capacity_) {
+        return RET_VALUE_OK;
+    }
+    capacity_ = capacity;
     if (!hasInit_) {
-        return nullptr;
+        return RET_VALUE_OK;
     }
+    FreeCache();
+    return CacheInit();
+}
+
+GlyphsCache::Stats GlyphsCache::GetStats() const
+{
+    return {hitNum_, missNum_, evictNum_, nodeNum_, capacity_};
+}
+
+uint32_t GlyphsCache::GetHome(uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const
+{
+    uint32_t hash = (unicode * UNICODE_HASH_FACTOR) ^
+                    (((static_cast<uint32_t>(fontKey) << FONT_KEY_SHIFT) | textStyle) * FONT_HASH_FACTOR);
+    hash ^= hash >> HASH_FOLD_SHIFT;
+    return hash & mask_;
+}
+
+uint32_t GlyphsCache::GetHome(const GlyphNode& node) const
+{
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    return GetHome(node.unicode, node.fontId, node.textStyle);
+#else
+    return GetHome(node.unicode, node.fontId, TEXT_STYLE_NORMAL);
+#endif
+}
 
-    GlyphCacheNode* node = nullptr;
+bool GlyphsCache::IsKey(const GlyphNode& node, uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const
+{
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    if (node.textStyle != textStyle) {
+        return false;
+    }
+#endif
+    return (node.unicode == unicode) && (node.fontId == fontKey);
+}
 
-    uint8_t font = (fontKey ^ unicode) & FONT_HASH_MASK;
-    uint8_t uc = unicode & UNICODE_HASH_MASK;
-    for (uint8_t i = 0; i < NODE_HASH_NR; i++) {
-        GlyphCacheNode* p = &((*nodeCache_)[font][uc][i]);
-        if ((p->node.unicode == unicode) && (p->node.fontId == fontKey)) {
-            if (!cacheType || p->cacheType == cacheType) {
-                node = p;
-                break;
-            }
+uint32_t GlyphsCache::Find(uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const
+{
+    for (uint32_t i = GetHome(unicode, fontKey, textStyle); (nodeFlags_[i] & NODE_USED) != 0; i = (i + 1) & mask_) {
+        if (IsKey(nodes_[i].node, unicode, fontKey, textStyle)) {
+            return i;
         }
     }
-    return node;
+    return capacity_;
 }
 
-GlyphCacheNode* GlyphsCache::GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey)
+GlyphCacheNode* GlyphsCache::GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType,
+                                              TextStyle textStyle)
 {
     if (!hasInit_) {
         return nullptr;
     }
 
-    uint8_t font = (fontKey ^ unicode) & FONT_HASH_MASK;
-    uint8_t uc = unicode & UNICODE_HASH_MASK;
-    uint8_t i = (*cacheStatus_)[font][uc];
-    GlyphCacheNode* node = &((*nodeCache_)[font][uc][i]);
+    uint32_t index = Find(unicode, fontKey, textStyle);
+    if ((index == capacity_) || ((cacheType != CACHE_TYPE_NONE) && (nodes_[index].cacheType != cacheType))) {
+        missNum_++;
+        return nullptr;
+    }
+    nodeFlags_[index] |= NODE_REFERENCED;
+    hitNum_++;
+    return &nodes_[index];
+}
 
-    i++;
-    if (i >= NODE_HASH_NR) {
-        i = 0;
+GlyphCacheNode* GlyphsCache::GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey, TextStyle textStyle)
+{
+    if (!hasInit_) {
+        return nullptr;
     }
-    (*cacheStatus_)[font][uc] = i;
 
+    uint32_t index = Find(unicode, fontKey, textStyle);
+    if (index == capacity_) {
+        /* a table filled to three quarters at most keeps the probes short */
+        if (nodeNum_ >= capacity_ - (capacity_ >> 2)) { // 2: a quarter of the capacity is kept free
+            Evict();
+        }
+        index = GetHome(unicode, fontKey, textStyle);
+        while ((nodeFlags_[index] & NODE_USED) != 0) {
+            index = (index + 1) & mask_;
+        }
+        nodeNum_++;
+    }
+    GlyphCacheNode* node = &nodes_[index];
+    if (memset_s(node, sizeof(GlyphCacheNode), 0, sizeof(GlyphCacheNode)) != EOK) {
+        GRAPHIC_LOGE("GlyphsCache::GetNodeCacheSpace init node failed");
+    }
+    node->node.unicode = unicode;
+    node->node.fontId = fontKey;
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    node->node.textStyle = textStyle;
+#endif
+    nodeFlags_[index] = NODE_USED | NODE_REFERENCED;
     return node;
 }
+
+void GlyphsCache::Evict()
+{
+    while (nodeNum_ > 0) {
+        hand_ = (hand_ + 1) & mask_;
+        uint8_t& flags = nodeFlags_[hand_];
+        if ((flags & NODE_USED) == 0) {
+            continue;
+        }
+        if ((flags & NODE_REFERENCED) != 0) {
+            flags &= ~NODE_REFERENCED;
+            continue;
+        }
+        RemoveNode(hand_);
+        evictNum_++;
+        return;
+    }
+}
+
+void GlyphsCache::RemoveNode(uint32_t index)
+{
+    /* move back the nodes after the hole which may fill it, so no probe stops at the hole */
+    uint32_t hole = index;
+    for (uint32_t i = (index + 1) & mask_; (nodeFlags_[i] & NODE_USED) != 0; i = (i + 1) & mask_) {
+        uint32_t home = GetHome(nodes_[i].node);
+        if (((i - home) & mask_) >= ((i - hole) & mask_)) {
+            nodes_[hole] = nodes_[i];
+            nodeFlags_[hole] = nodeFlags_[i];
+            hole = i;
+        }
+    }
+    nodeFlags_[hole] = 0;
+    nodeNum_--;
+}
 } // namespace OHOS
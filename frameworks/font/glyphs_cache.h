@@ -20,8 +20,22 @@
 #include "gfx_utils/heap_base.h"
 
 namespace OHOS {
+/*
+ * The metrics of the glyphs last used, in an open addressed table keyed by font key, unicode and text style. The
+ * table holds a power of two nodes and is filled to three quarters, a full table evicts the nodes in CLOCK order:
+ * a node used since the hand last passed it is kept for one more round. The capacity is set at startup and can be
+ * changed at runtime, which drops the cached nodes.
+ */
 class GlyphsCache : public HeapBase {
 public:
+    struct Stats {
+        uint32_t hitNum;
+        uint32_t missNum;
+        uint32_t evictNum;
+        uint32_t nodeNum;
+        uint32_t capacity;
+    };
+
     GlyphsCache();
 
     GlyphsCache(const GlyphsCache&) = delete;
@@ -36,29 +50,57 @@ public:
 
     int8_t CacheInit();
     void ClearCacheFlag();
-    GlyphCacheNode* GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType);
-    GlyphCacheNode* GetNodeCacheSpace(uint32_t unicode, uint16_t fontId);
+    GlyphCacheNode* GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType,
+                                     TextStyle textStyle = TEXT_STYLE_NORMAL);
+    /* Returns the node of the key to fill in, the unicode, font id and text style of the node are the key. */
+    GlyphCacheNode* GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey, TextStyle textStyle = TEXT_STYLE_NORMAL);
+
+    /* nodeNum is rounded up to a power of two. */
+    int8_t SetCapacity(uint32_t nodeNum);
+
+    uint32_t GetCapacity() const
+    {
+        return capacity_;
+    }
+
+    Stats GetStats() const;
+
+    void ResetStats()
+    {
+        hitNum_ = 0;
+        missNum_ = 0;
+        evictNum_ = 0;
+    }
 
 private:
+    /* the node number of the former fixed table */
 #if (defined(ENABLE_MIX_FONT) && (ENABLE_MIX_FONT == 1))
-    static constexpr uint8_t FONT_HASH_SHIFT = 3;
+    static constexpr uint32_t DEFAULT_CAPACITY = 8192;
 #else
-    static constexpr uint8_t FONT_HASH_SHIFT = 4;
+    static constexpr uint32_t DEFAULT_CAPACITY = 16384;
 #endif
-    static constexpr uint8_t FONT_HASH_NR = 1 << FONT_HASH_SHIFT;
-    static constexpr uint32_t FONT_HASH_MASK = FONT_HASH_NR - 1;
-    static constexpr uint8_t UNICODE_HASH_SHIFT = 6;
-    static constexpr uint8_t UNICODE_HASH_NR = 1 << UNICODE_HASH_SHIFT;
-    static constexpr uint32_t UNICODE_HASH_MASK = UNICODE_HASH_NR - 1;
-    static constexpr uint8_t NODE_HASH_SHIFT = 4;
-    static constexpr uint8_t NODE_HASH_NR = 1 << NODE_HASH_SHIFT;
-
-    using CacheType = GlyphCacheNode[FONT_HASH_NR][UNICODE_HASH_NR][NODE_HASH_NR];
-    using CacheState = uint8_t[FONT_HASH_NR][UNICODE_HASH_NR];
-
-    CacheType* nodeCache_;
-    CacheState* cacheStatus_;
+    static constexpr uint32_t MIN_CAPACITY = 64;
+    static constexpr uint8_t NODE_USED = 0x01;
+    static constexpr uint8_t NODE_REFERENCED = 0x02;
+
+    uint32_t GetHome(uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const;
+    uint32_t GetHome(const GlyphNode& node) const;
+    bool IsKey(const GlyphNode& node, uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const;
+    uint32_t Find(uint32_t unicode, uint16_t fontKey, uint8_t textStyle) const;
+    void Evict();
+    void RemoveNode(uint32_t index);
+    void FreeCache();
+
+    GlyphCacheNode* nodes_;
+    uint8_t* nodeFlags_;
+    uint32_t capacity_;
+    uint32_t mask_;
+    uint32_t nodeNum_;
+    uint32_t hand_;
+    uint32_t hitNum_;
+    uint32_t missNum_;
+    uint32_t evictNum_;
     bool hasInit_;
 };
 } // namespace OHOS
-#endif /* GLYPHS_CACHE_H */
\ No newline at end of file
+#endif /* GLYPHS_CACHE_H */
@@ -14,12 +14,17 @@
  */
 
 #include "font/glyphs_file.h"
+#include "dfx/ui_render_trace.h"
 #include "draw/draw_utils.h"
 #include "font/font_ram_allocator.h"
 #include "font/ui_font_builder.h"
 #include "gfx_utils/file.h"
 #include "gfx_utils/graphic_log.h"
 #include "securec.h"
+#if (defined __linux__ || defined __LITEOS__ || defined __APPLE__) && !defined __LITEOS_M__
+#include <sys/mman.h>
+#define GLYPHS_FILE_MMAP 1
+#endif
 
 namespace OHOS {
 GlyphsFile::GlyphsFile()
@@ -32,6 +37,8 @@ GlyphsFile::GlyphsFile()
       fontHeaderCache_(nullptr),
       indexCache_(nullptr),
       fontName_(nullptr),
+      mapAddr_(nullptr),
+      mapLen_(0),
       fp_(-1),
       isFileSet_(false),
       fontNum_(0)
@@ -39,12 +46,42 @@ GlyphsFile::GlyphsFile()
 }
 GlyphsFile::~GlyphsFile()
 {
+    UnmapFile();
     if (fontName_) {
         UIFree(fontName_);
         fontName_ = nullptr;
     }
 }
 
+void GlyphsFile::MapFile()
+{
+#ifdef GLYPHS_FILE_MMAP
+    int32_t fileLen = lseek(fp_, 0, SEEK_END);
+    if ((fileLen <= 0) || (static_cast<uint32_t>(fileLen) < bitMapSectionStart_)) {
+        return;
+    }
+    /* the mapping keeps no file offset, so the glyphs can be read from any thread */
+    void* addr = mmap(nullptr, fileLen, PROT_READ, MAP_PRIVATE, fp_, 0);
+    if (addr == MAP_FAILED) {
+        GRAPHIC_LOGE("GlyphsFile::MapFile mmap failed, read the file instead");
+        return;
+    }
+    mapAddr_ = static_cast<uint8_t*>(addr);
+    mapLen_ = fileLen;
+#endif
+}
+
+void GlyphsFile::UnmapFile()
+{
+#ifdef GLYPHS_FILE_MMAP
+    if (mapAddr_ != nullptr) {
+        munmap(mapAddr_, mapLen_);
+        mapAddr_ = nullptr;
+        mapLen_ = 0;
+    }
+#endif
+}
+
 int8_t GlyphsFile::CacheInit()
 {
     uint32_t size = 0;
@@ -87,6 +124,14 @@ int8_t GlyphsFile::GetNodeFromFile(uint32_t unicode, uint16_t fontId, GlyphNode&
     }
 
     offset = glyphInfo.glyphNodeSectionStart + (idx - 1) * sizeof(GlyphNode);
+    if (mapAddr_ != nullptr) {
+        if ((offset + sizeof(GlyphNode) > mapLen_) ||
+            (memcpy_s(&node, sizeof(GlyphNode), mapAddr_ + offset, sizeof(GlyphNode)) != EOK)) {
+            GRAPHIC_LOGE("GlyphsFile::GetNodeFromFile node out of file");
+            return INVALID_RET_VALUE;
+        }
+        return RET_VALUE_OK;
+    }
     int32_t ret = lseek(fp_, offset, SEEK_SET);
     if (ret != static_cast<int32_t>(offset)) {
         GRAPHIC_LOGE("GlyphsFile::GetNodeFromFile lseek failed");
@@ -179,6 +224,17 @@ int8_t GlyphsFile::SetFile(const char* fontName, int32_t fp, uint32_t start)
         size += fontHeaderCache_[i].glyphNum * sizeof(GlyphNode);
     }
     bitMapSectionStart_ = glyphNodeSectionStart_ + size;
+    MapFile();
+    if (mapAddr_ != nullptr) {
+        /* the index is read from the mapping, no copy in ram is needed */
+        indexCache_ = mapAddr_ + fontIndexSectionStart_;
+        isFileSet_ = true;
+        return RET_VALUE_OK;
+    }
+    if (lseek(fp_, fontIndexSectionStart_, SEEK_SET) < 0) {
+        GRAPHIC_LOGE("GlyphsFile::SetFile lseek failed");
+        return INVALID_RET_VALUE;
+    }
     ret = CacheInit();
     if (ret == RET_VALUE_OK) {
         isFileSet_ = true;
@@ -295,6 +351,7 @@ int16_t GlyphsFile::GetFontHeight(uint16_t fontId)
 
 int8_t GlyphsFile::GetBitmap(GlyphNode& node, BufferInfo& bufInfo)
 {
+    UI_RENDER_TRACE_SCOPE("LoadGlyphBitmap");
     if (bufInfo.virAddr == nullptr) {
         GRAPHIC_LOGE("GlyphsFile::GetBitmap invalid parameter");
         return INVALID_RET_VALUE;
@@ -309,20 +366,43 @@ int8_t GlyphsFile::GetBitmap(GlyphNode& node, BufferInfo& bufInfo)
     uint32_t tmpBitMapSectionStart = glyphInfo.bitMapSectionStart;
     uint32_t offset = tmpBitMapSectionStart + node.dataOff;
     uint32_t size = node.kernOff - node.dataOff;
-    int32_t ret = lseek(fp_, offset, SEEK_SET);
-    if (ret != static_cast<int32_t>(offset)) {
-        GRAPHIC_LOGE("GlyphsFile::GetBitmap lseek failed");
-        return INVALID_RET_VALUE;
-    }
+    if (mapAddr_ != nullptr) {
+        if ((offset + size > mapLen_) || (memcpy_s(bufInfo.virAddr, size, mapAddr_ + offset, size) != EOK)) {
+            GRAPHIC_LOGE("GlyphsFile::GetBitmap bitmap out of file");
+            return INVALID_RET_VALUE;
+        }
+    } else {
+        int32_t ret = lseek(fp_, offset, SEEK_SET);
+        if (ret != static_cast<int32_t>(offset)) {
+            GRAPHIC_LOGE("GlyphsFile::GetBitmap lseek failed");
+            return INVALID_RET_VALUE;
+        }
 
-    int32_t readSize = read(fp_, bufInfo.virAddr, size);
-    if (readSize != static_cast<int32_t>(size)) {
-        GRAPHIC_LOGE("GlyphsFile::GetBitmap read failed");
-        return INVALID_RET_VALUE;
+        int32_t readSize = read(fp_, bufInfo.virAddr, size);
+        if (readSize != static_cast<int32_t>(size)) {
+            GRAPHIC_LOGE("GlyphsFile::GetBitmap read failed");
+            return INVALID_RET_VALUE;
+        }
     }
     UIFontAllocator::RearrangeBitmap(bufInfo, size, false);
 
     node.dataFlag = node.fontId;
     return RET_VALUE_OK;
 }
+
+const uint8_t* GlyphsFile::GetMappedBitmap(const GlyphNode& node)
+{
+    if (mapAddr_ == nullptr) {
+        return nullptr;
+    }
+    GlyphInfo glyphInfo;
+    if (GetGlyphInfo(node.fontId, glyphInfo) != RET_VALUE_OK) {
+        return nullptr;
+    }
+    uint32_t offset = glyphInfo.bitMapSectionStart + node.dataOff;
+    if ((node.kernOff <= node.dataOff) || (offset + node.kernOff - node.dataOff > mapLen_)) {
+        return nullptr;
+    }
+    return mapAddr_ + offset;
+}
 } // namespace OHOS
@@ -48,6 +48,14 @@ public:
 
     bool IsSameFile(const char* fontName);
 
+    /* Returns the bitmap of the node in the mapped file, or nullptr if the file is not mapped. */
+    const uint8_t* GetMappedBitmap(const GlyphNode& node);
+
+    bool IsMapped() const
+    {
+        return mapAddr_ != nullptr;
+    }
+
 private:
     static constexpr uint8_t FONT_NAME_LEN_MAX = 64;
     static constexpr uint8_t RADIX_TREE_BITS = 4;
@@ -69,6 +77,8 @@ private:
     };
 
     int8_t CacheInit();
+    void MapFile();
+    void UnmapFile();
     int8_t GetGlyphInfo(uint16_t fontId, GlyphInfo& glyphInfo);
     void SetFontName(const char* fontName);
 
@@ -82,6 +92,8 @@ private:
     FontHeader* fontHeaderCache_;
     uint8_t* indexCache_;
     char* fontName_;
+    uint8_t* mapAddr_;
+    uint32_t mapLen_;
     int32_t fp_;
     bool isFileSet_;
     uint8_t fontNum_;
@@ -99,6 +99,10 @@ const GlyphNode* GlyphsManager::GetGlyphNodeFromFiles(uint32_t unicode, uint16_t
     if (cacheNode == nullptr) {
         return nullptr;
     }
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    /* the text style is part of the key of the node */
+    nodeInfo.textStyle = TEXT_STYLE_NORMAL;
+#endif
     cacheNode->node = nodeInfo;
     cacheNode->cacheType = fileType_;
 
@@ -167,4 +171,15 @@ int8_t GlyphsManager::GetBitmap(uint32_t unicode, BufferInfo& bufInfo, uint16_t
     }
     return INVALID_RET_VALUE;
 }
+
+const uint8_t* GlyphsManager::GetMappedBitmap(const GlyphNode& node)
+{
+    for (uint16_t i = 0; i < glyphsFiles_.Size(); i++) {
+        const uint8_t* bitmap = glyphsFiles_[i]->GetMappedBitmap(node);
+        if (bitmap != nullptr) {
+            return bitmap;
+        }
+    }
+    return nullptr;
+}
 } // namespace OHOS
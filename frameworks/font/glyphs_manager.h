@@ -46,6 +46,8 @@ public:
 
     int8_t GetBitmap(uint32_t unicode, BufferInfo& bufInfo, uint16_t fontId);
 
+    const uint8_t* GetMappedBitmap(const GlyphNode& node);
+
     int8_t SetFile(const char* fontName, int32_t fp, uint32_t start, uint16_t fileType);
 
 private:
@@ -15,6 +15,7 @@
 
 #include "font/ui_font.h"
 #include "common/text.h"
+#include "common/typed_text.h"
 #include "font/ui_font_cache.h"
 #include "font/font_ram_allocator.h"
 #if defined(ENABLE_VECTOR_FONT) && ENABLE_VECTOR_FONT
@@ -23,12 +24,17 @@
 #if defined(ENABLE_BITMAP_FONT) && ENABLE_BITMAP_FONT
 #include "font/ui_font_bitmap.h"
 #endif
+#include "gfx_utils/mem_api.h"
 #include "graphic_config.h"
 #if defined(ENABLE_MULTI_FONT) && ENABLE_MULTI_FONT
 #include "font/ui_multi_font_manager.h"
 #endif
 
 namespace OHOS {
+namespace {
+constexpr uint32_t MAX_PRELOAD_GLYPH_NUM = 4096;
+}
+
 bool UIFont::setFontAllocFlag_ = false;
 UIFont::UIFont() : instance_(nullptr), defaultInstance_(nullptr) {}
 
@@ -173,18 +179,38 @@ int8_t UIFont::GetCodePoints(uint16_t textId, uint32_t** codePoints, uint16_t& c
 
 uint8_t* UIFont::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize,
                            uint8_t shapingFont)
+{
+    return SearchBitmap(unicode, glyphNode, fontId, fontSize, shapingFont, false);
+}
+
+uint8_t* UIFont::PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize,
+                           uint8_t shapingFont)
+{
+    return SearchBitmap(unicode, glyphNode, fontId, fontSize, shapingFont, true);
+}
+
+uint8_t* UIFont::GetFontBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, bool pin)
+{
+    if (pin) {
+        return instance_->PinBitmap(unicode, glyphNode, fontId, fontSize);
+    }
+    return instance_->GetBitmap(unicode, glyphNode, fontId, fontSize);
+}
+
+uint8_t* UIFont::SearchBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize,
+                              uint8_t shapingFont, bool pin)
 {
     uint8_t* bitmap = nullptr;
 #if ENABLE_MULTI_FONT
     // shaping font is in search list, search shaping font first
     if (shapingFont > 1) {
-        bitmap = instance_->GetBitmap(unicode, glyphNode, shapingFont, fontSize);
+        bitmap = GetFontBitmap(unicode, glyphNode, shapingFont, fontSize, pin);
         if (bitmap != nullptr) {
             return bitmap;
         }
     }
 #endif
-    bitmap = instance_->GetBitmap(unicode, glyphNode, fontId, fontSize);
+    bitmap = GetFontBitmap(unicode, glyphNode, fontId, fontSize, pin);
     if (bitmap != nullptr) {
         return bitmap;
     }
@@ -196,7 +222,7 @@ uint8_t* UIFont::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t font
         return nullptr;
     }
     do {
-        bitmap = instance_->GetBitmap(unicode, glyphNode, searchLists[currentIndex], fontSize);
+        bitmap = GetFontBitmap(unicode, glyphNode, searchLists[currentIndex], fontSize, pin);
         if (bitmap != nullptr) {
             return bitmap;
         }
@@ -271,4 +297,73 @@ uint16_t UIFont::GetLineMaxHeight(const char* text, uint16_t lineLength, uint16_
 {
     return instance_->GetLineMaxHeight(text, lineLength, fontId, fontSize, letterIndex, sizeSpans);
 }
+
+int32_t UIFont::PreloadGlyphs(const char* const* texts, uint16_t textNum, uint16_t fontId, uint8_t fontSize,
+                              uint8_t threadNum)
+{
+    if (texts == nullptr) {
+        return INVALID_RET_VALUE;
+    }
+    uint32_t num = 0;
+    for (uint16_t i = 0; i < textNum; i++) {
+        if (texts[i] != nullptr) {
+            num += TypedText::GetUTF8CharacterSize(texts[i]);
+        }
+    }
+    num = (num > MAX_PRELOAD_GLYPH_NUM) ? MAX_PRELOAD_GLYPH_NUM : num;
+    if (num == 0) {
+        return 0;
+    }
+    uint32_t* unicodes = static_cast<uint32_t*>(UIMalloc(num * sizeof(uint32_t)));
+    if (unicodes == nullptr) {
+        return INVALID_RET_VALUE;
+    }
+    uint32_t count = 0;
+    for (uint16_t i = 0; (i < textNum) && (count < num); i++) {
+        if (texts[i] == nullptr) {
+            continue;
+        }
+        uint32_t index = 0;
+        while ((texts[i][index] != '\0') && (count < num)) {
+            uint32_t unicode = TypedText::GetUTF8Next(texts[i], index, index);
+            if ((unicode != '\r') && (unicode != '\n')) {
+                unicodes[count++] = unicode;
+            }
+        }
+    }
+    int32_t ret = instance_->PreloadGlyphs(unicodes, count, fontId, fontSize, threadNum);
+    UIFree(unicodes);
+    return ret;
+}
+
+int32_t UIFont::PreloadGlyphs(const GlyphRange* ranges, uint16_t rangeNum, uint16_t fontId, uint8_t fontSize,
+                              uint8_t threadNum)
+{
+    if (ranges == nullptr) {
+        return INVALID_RET_VALUE;
+    }
+    uint32_t num = 0;
+    for (uint16_t i = 0; (i < rangeNum) && (num < MAX_PRELOAD_GLYPH_NUM); i++) {
+        if (ranges[i].last >= ranges[i].first) {
+            uint32_t rangeLen = ranges[i].last - ranges[i].first;
+            num = (rangeLen >= MAX_PRELOAD_GLYPH_NUM - num) ? MAX_PRELOAD_GLYPH_NUM : (num + rangeLen + 1);
+        }
+    }
+    if (num == 0) {
+        return 0;
+    }
+    uint32_t* unicodes = static_cast<uint32_t*>(UIMalloc(num * sizeof(uint32_t)));
+    if (unicodes == nullptr) {
+        return INVALID_RET_VALUE;
+    }
+    uint32_t count = 0;
+    for (uint16_t i = 0; (i < rangeNum) && (count < num); i++) {
+        for (uint32_t unicode = ranges[i].first; (unicode <= ranges[i].last) && (count < num); unicode++) {
+            unicodes[count++] = unicode;
+        }
+    }
+    int32_t ret = instance_->PreloadGlyphs(unicodes, count, fontId, fontSize, threadNum);
+    UIFree(unicodes);
+    return ret;
+}
 } // namespace OHOS
@@ -14,6 +14,7 @@
  */
 
 #include "font/ui_font_adaptor.h"
+#include "common/decoded_text.h"
 #include "common/typed_text.h"
 #include "graphic_config.h"
 #include "font/ui_line_break.h"
@@ -42,6 +43,31 @@ uint32_t UIFontAdaptor::GetNextLineAndWidth(const char* txt,
 #endif
 }
 
+uint32_t UIFontAdaptor::GetNextLineAndWidth(DecodedText& text,
+                                            uint32_t begin,
+                                            uint16_t fontId,
+                                            uint8_t fontSize,
+                                            int16_t letterSpace,
+                                            int16_t& maxWidth,
+                                            int16_t& maxHeight,
+                                            uint16_t& letterIndex,
+                                            SizeSpan* sizeSpans,
+                                            bool allBreak,
+                                            uint16_t len)
+{
+#if ENABLE_ICU
+    return UILineBreakEngine::GetInstance().GetNextLineAndWidth(text, begin, fontId, fontSize, letterSpace, allBreak,
+                                                                maxWidth, maxHeight, letterIndex, sizeSpans, len);
+#else
+    if (text.GetText() == nullptr) {
+        return 0;
+    }
+    uint32_t index = TypedText::GetNextLine(text.GetText() + begin, fontId, fontSize, letterSpace, maxWidth);
+    maxWidth = TypedText::GetTextWidth(text, begin, fontId, fontSize, index, letterSpace);
+    return index;
+#endif
+}
+
 bool UIFontAdaptor::IsSameTTFId(uint16_t fontId, uint32_t unicode)
 {
 #if ENABLE_SHAPING
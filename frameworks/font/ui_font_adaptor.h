@@ -33,6 +33,19 @@ public:
                                         bool allBreak = false,
                                         uint16_t len = 0xFFFF);
 
+    /* The same for a decoded text from byte begin, the letters and their widths are not decoded again. */
+    static uint32_t GetNextLineAndWidth(DecodedText& text,
+                                        uint32_t begin,
+                                        uint16_t fontId,
+                                        uint8_t fontSize,
+                                        int16_t letterSpace,
+                                        int16_t& maxWidth,
+                                        int16_t& maxHeight,
+                                        uint16_t& letterIndex,
+                                        SizeSpan* sizeSpans,
+                                        bool allBreak = false,
+                                        uint16_t len = 0xFFFF);
+
     static bool IsSameTTFId(uint16_t fontId, uint32_t unicode);
 };
 } // namespace OHOS
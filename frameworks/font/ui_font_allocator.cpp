@@ -179,7 +179,8 @@ BufferInfo UIFontAllocator::GetCacheBuffer(uint16_t fontId,
                                            uint32_t unicode,
                                            ColorMode mode,
                                            GlyphNode& glyphNode,
-                                           bool hasMetric)
+                                           bool hasMetric,
+                                           bool pin)
 {
     BufferInfo bufInfo{Rect(), 0, nullptr, nullptr, glyphNode.cols, glyphNode.rows, mode, 0};
     bufInfo.stride = BIT_TO_BYTE(bufInfo.width * DrawUtils::GetPxSizeByColorMode(bufInfo.mode));
@@ -189,7 +190,10 @@ BufferInfo UIFontAllocator::GetCacheBuffer(uint16_t fontId,
     if (hasMetric) {
         bitmapSize += sizeof(Metric);
     }
-    bufInfo.virAddr = reinterpret_cast<void*>(UIFontCacheManager::GetInstance()->GetSpace(fontId, unicode, bitmapSize));
+    UIFontCacheManager* cacheManager = UIFontCacheManager::GetInstance();
+    uint8_t* space = pin ? cacheManager->PinSpace(fontId, unicode, bitmapSize) :
+                           cacheManager->GetSpace(fontId, unicode, bitmapSize);
+    bufInfo.virAddr = reinterpret_cast<void*>(space);
     return bufInfo;
 }
 
@@ -51,8 +51,9 @@ public:
 
     void Free(void* addr);
 
-    static BufferInfo
-        GetCacheBuffer(uint16_t fontId, uint32_t unicode, ColorMode mode, GlyphNode& glyphNode, bool hasMetric);
+    /* with pin, the buffer is found in the cache only after it is filled and unpinned */
+    static BufferInfo GetCacheBuffer(uint16_t fontId, uint32_t unicode, ColorMode mode, GlyphNode& glyphNode,
+                                     bool hasMetric, bool pin = false);
 
     static void RearrangeBitmap(BufferInfo& bufInfo, uint32_t fileSz, bool hasMetric);
 
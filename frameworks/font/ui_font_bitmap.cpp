@@ -16,6 +16,7 @@
 #include "font/ui_font_bitmap.h"
 
 #include "draw/draw_utils.h"
+#include "engines/gfx/gfx_engine_manager.h"
 #include "font/font_ram_allocator.h"
 #include "font/ui_font.h"
 #include "font/ui_font_adaptor.h"
@@ -134,7 +135,18 @@ int16_t UIFontBitmap::GetWidth(uint32_t unicode, uint16_t fontId, uint8_t fontSi
 
 uint8_t* UIFontBitmap::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize)
 {
-    return SearchInFont(unicode, glyphNode, fontId);
+    return SearchInFont(unicode, glyphNode, fontId, false);
+}
+
+uint8_t* UIFontBitmap::PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize)
+{
+    return SearchInFont(unicode, glyphNode, fontId, true);
+}
+
+void UIFontBitmap::UnpinBitmap(uint8_t* bitmap)
+{
+    /* bitmaps mapped from the font file are not in the cache, the cache ignores them */
+    UIFontCacheManager::GetInstance()->UnpinBitmap(bitmap);
 }
 
 bool UIFontBitmap::IsEmojiFont(uint16_t fontId)
@@ -238,7 +250,7 @@ int16_t UIFontBitmap::GetDynamicFontWidth(uint32_t unicode, uint16_t fontId)
     return dynamicFont_.GetFontWidth(unicode, fontId);
 }
 
-uint8_t* UIFontBitmap::SearchInFont(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId)
+uint8_t* UIFontBitmap::SearchInFont(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, bool pin)
 {
     GraphicLockGuard guard(lock_);
     if (UIFontCacheManager::GetInstance()->GetBitmapCache() == nullptr) {
@@ -252,27 +264,56 @@ uint8_t* UIFontBitmap::SearchInFont(uint32_t unicode, GlyphNode& glyphNode, uint
     if (ret != RET_VALUE_OK) {
         return nullptr;
     }
-    uint8_t* bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontId, unicode);
+    ColorMode mode = UIFont::GetInstance()->GetColorType(fontId);
+    uint8_t* bitmap = GetMappedBitmap(glyphNode, mode);
+    if (bitmap != nullptr) {
+        return bitmap;
+    }
+    if (pin) {
+        bitmap = UIFontCacheManager::GetInstance()->PinBitmap(fontId, unicode);
+    } else {
+        bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontId, unicode);
+    }
     if (bitmap != nullptr) {
         if (glyphNode.dataFlag == glyphNode.fontId && fontId == glyphNode.fontId) {
             return bitmap;
         } else {
             GRAPHIC_LOGE("DataFlag of bitmap node not equal to fontId.");
         }
+        if (pin) {
+            UIFontCacheManager::GetInstance()->UnpinBitmap(bitmap);
+        }
     }
     if (glyphNode.kernOff <= glyphNode.dataOff) {
         return nullptr;
     }
-    ColorMode mode = UIFont::GetInstance()->GetColorType(fontId);
     BufferInfo bufInfo = UIFontAllocator::GetCacheBuffer(fontId, unicode, mode, glyphNode, false);
     ret = dynamicFont_.GetBitmap(unicode, bufInfo, fontId);
     if (ret == RET_VALUE_OK) {
+        if (pin) {
+            /* the new bitmap is the first one found */
+            return UIFontCacheManager::GetInstance()->PinBitmap(fontId, unicode);
+        }
         return reinterpret_cast<uint8_t*>(bufInfo.virAddr);
     }
     PutCacheSpace(reinterpret_cast<uint8_t*>(bufInfo.virAddr));
     return nullptr;
 }
 
+uint8_t* UIFontBitmap::GetMappedBitmap(const GlyphNode& glyphNode, ColorMode mode)
+{
+    /* the rows are packed in the file, they can be drawn in place only if the engine needs no wider stride */
+    BufferInfo bufInfo{Rect(), 0, nullptr, nullptr, glyphNode.cols, glyphNode.rows, mode, 0};
+    uint32_t rowSize = BIT_TO_BYTE(bufInfo.width * DrawUtils::GetPxSizeByColorMode(mode));
+    bufInfo.stride = rowSize;
+    BaseGfxEngine::GetInstance()->AdjustLineStride(bufInfo);
+    if (bufInfo.stride != rowSize) {
+        return nullptr;
+    }
+    /* the mapping is read only, the bitmap is only drawn */
+    return const_cast<uint8_t*>(dynamicFont_.GetMappedBitmap(glyphNode));
+}
+
 int16_t UIFontBitmap::GetWidthInFontId(uint32_t unicode, uint16_t fontId)
 {
     if (!UIFontAdaptor::IsSameTTFId(fontId, unicode)) {
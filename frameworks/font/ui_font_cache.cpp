@@ -15,101 +15,241 @@
 
 #include "font/ui_font_cache.h"
 #include <cstddef>
+#include "gfx_utils/graphic_log.h"
 #if defined(ENABLE_VECTOR_FONT) && ENABLE_VECTOR_FONT
 #include "gfx_utils/style.h"
 
 #endif
 namespace OHOS {
+namespace {
+constexpr uint32_t SHARD_HASH_FACTOR = 0x9E3779B1;
+constexpr uint8_t FONT_KEY_SHIFT = 16;
+constexpr uint8_t SHARD_HASH_SHIFT = 24;
+} // namespace
+
 UIFontCache::UIFontCache(uint8_t* ram, uint32_t size)
 {
     if (ram == nullptr) {
         return;
     }
-    allocator_.SetRamAddr(ram, size);
-    allocator_.SetMinChunkSize(FONT_CACHE_MIN_SIZE + sizeof(Bitmap));
-
+    uint32_t shardNum = size / FONT_CACHE_SHARD_MIN_SIZE;
+    if (shardNum > FONT_CACHE_SHARD_NR) {
+        shardNum = FONT_CACHE_SHARD_NR;
+    } else if (shardNum == 0) {
+        shardNum = 1;
+    }
+    uint32_t shardSize = size / shardNum;
     uint32_t hashTableSize = sizeof(ListHead) * FONT_CACHE_HASH_NR;
-    hashTable_ = reinterpret_cast<ListHead*>(allocator_.Allocate(hashTableSize));
-    for (uint8_t i = 0; i < FONT_CACHE_HASH_NR; i++) {
-        ListInit(hashTable_ + i);
+    for (uint8_t i = 0; i < shardNum; i++) {
+        Shard& shard = shards_[i];
+        shard.allocator.SetRamAddr(ram + i * shardSize, shardSize);
+        shard.allocator.SetMinChunkSize(FONT_CACHE_MIN_SIZE + sizeof(Bitmap));
+        shard.hashTable = reinterpret_cast<ListHead*>(shard.allocator.Allocate(hashTableSize));
+        if (shard.hashTable == nullptr) {
+            GRAPHIC_LOGE("UIFontCache::UIFontCache allocate hash table failed");
+            return;
+        }
+        for (uint8_t j = 0; j < FONT_CACHE_HASH_NR; j++) {
+            ListInit(shard.hashTable + j);
+        }
+        ListInit(&shard.lruList);
     }
-
-    ListInit(&lruList_);
+    ram_ = ram;
+    size_ = size;
+    shardNum_ = static_cast<uint8_t>(shardNum);
 }
 
 UIFontCache::~UIFontCache() {}
 
-void UIFontCache::UpdateLru(Bitmap* bitmap)
+UIFontCache::Shard& UIFontCache::GetShard(uint16_t fontKey, uint32_t unicode)
+{
+    uint32_t hash = (unicode ^ (static_cast<uint32_t>(fontKey) << FONT_KEY_SHIFT)) * SHARD_HASH_FACTOR;
+    return shards_[(hash >> SHARD_HASH_SHIFT) % shardNum_];
+}
+
+void UIFontCache::UpdateLru(Shard& shard, Bitmap* bitmap)
 {
     ListDel(&bitmap->lruHead);
     ListInit(&bitmap->lruHead);
-    ListAdd(&bitmap->lruHead, &lruList_);
+    ListAdd(&bitmap->lruHead, &shard.lruList);
 }
 
-uint8_t* UIFontCache::GetSpace(uint16_t fontId, uint32_t unicode, uint32_t size, TextStyle textStyle)
+UIFontCache::Bitmap* UIFontCache::AllocateBitmap(Shard& shard, uint16_t fontKey, uint32_t unicode, uint32_t size,
+                                                 TextStyle textStyle)
 {
     Bitmap* bitmap = nullptr;
 
     uint32_t allocSize = sizeof(Bitmap) + size;
     while (bitmap == nullptr) {
-        bitmap = reinterpret_cast<Bitmap*>(allocator_.Allocate(allocSize));
+        bitmap = reinterpret_cast<Bitmap*>(shard.allocator.Allocate(allocSize));
         if (bitmap == nullptr) {
-            // nothing to free, return null
-            if ((lruList_.prev == &lruList_) && (lruList_.next == &lruList_)) {
+            /* free the least recently used bitmap which is not pinned, return null if there is none */
+            ListHead* node = shard.lruList.prev;
+            Bitmap* toFree = nullptr;
+            for (; node != &shard.lruList; node = node->prev) {
+                toFree = reinterpret_cast<struct Bitmap*>(reinterpret_cast<uint8_t*>(node) -
+                                                          offsetof(struct Bitmap, lruHead));
+                if (toFree->pinNum == 0) {
+                    break;
+                }
+            }
+            if (node == &shard.lruList) {
                 return nullptr;
             }
-            Bitmap* toFree = reinterpret_cast<struct Bitmap *>(reinterpret_cast<uint8_t *>(lruList_.prev) -
-                offsetof(struct Bitmap, lruHead));
             ListDel(&toFree->hashHead);
             ListDel(&toFree->lruHead);
-            allocator_.Free(toFree);
+            shard.allocator.Free(toFree);
         }
     }
 
     ListInit(&bitmap->hashHead);
     ListInit(&bitmap->lruHead);
-    ListAdd(&bitmap->hashHead, hashTable_ + unicode % FONT_CACHE_HASH_NR);
-    ListAdd(&bitmap->lruHead, &lruList_);
-
-    bitmap->fontId = fontId;
+    bitmap->fontId = fontKey;
     bitmap->unicode = unicode;
+    bitmap->pinNum = 0;
+    bitmap->released = 0;
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     bitmap->textStyle = textStyle;
 #endif
+    return bitmap;
+}
+
+uint8_t* UIFontCache::GetSpace(uint16_t fontId, uint32_t unicode, uint32_t size, TextStyle textStyle)
+{
+    if (shardNum_ == 0) {
+        return nullptr;
+    }
+    Shard& shard = GetShard(fontId, unicode);
+    GraphicLockGuard guard(shard.lock);
+    Bitmap* bitmap = AllocateBitmap(shard, fontId, unicode, size, textStyle);
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    ListAdd(&bitmap->hashHead, shard.hashTable + unicode % FONT_CACHE_HASH_NR);
+    ListAdd(&bitmap->lruHead, &shard.lruList);
+    return reinterpret_cast<uint8_t*>(bitmap->data);
+}
 
+uint8_t* UIFontCache::PinSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle)
+{
+    if (shardNum_ == 0) {
+        return nullptr;
+    }
+    Shard& shard = GetShard(fontKey, unicode);
+    GraphicLockGuard guard(shard.lock);
+    /* kept out of the lists until it is unpinned, so it is neither found nor evicted while it is filled */
+    Bitmap* bitmap = AllocateBitmap(shard, fontKey, unicode, size, textStyle);
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    bitmap->pinNum = 1;
     return reinterpret_cast<uint8_t*>(bitmap->data);
 }
 
 void UIFontCache::PutSpace(uint8_t* addr)
 {
-    if (addr == nullptr) {
+    if ((addr == nullptr) || (shardNum_ == 0)) {
         return;
     }
-    Bitmap* bitmap = reinterpret_cast<Bitmap*>(addr - sizeof(Bitmap));
+    Bitmap* bitmap = reinterpret_cast<Bitmap*>(addr - offsetof(struct Bitmap, data));
+    Shard& shard = GetShard(bitmap->fontId, bitmap->unicode);
+    GraphicLockGuard guard(shard.lock);
 
     ListDel(&bitmap->hashHead);
+    ListInit(&bitmap->hashHead);
+    if (bitmap->pinNum > 0) {
+        /* still drawn by other threads, the last UnpinBitmap frees it */
+        bitmap->released = 1;
+        return;
+    }
     ListDel(&bitmap->lruHead);
 
-    allocator_.Free(bitmap);
+    shard.allocator.Free(bitmap);
 }
 
-uint8_t* UIFontCache::GetBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
+UIFontCache::Bitmap* UIFontCache::FindBitmap(Shard& shard, uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
 {
-    Bitmap* bitmap = nullptr;
-    ListHead* head = hashTable_ + unicode % FONT_CACHE_HASH_NR;
+    ListHead* head = shard.hashTable + unicode % FONT_CACHE_HASH_NR;
     for (ListHead* node = head->next; node != head; node = node->next) {
-        bitmap = reinterpret_cast<struct Bitmap*>(reinterpret_cast<uint8_t*>(node) -
-                                                  offsetof(struct Bitmap, hashHead));
+        Bitmap* bitmap = reinterpret_cast<struct Bitmap*>(reinterpret_cast<uint8_t*>(node) -
+                                                          offsetof(struct Bitmap, hashHead));
         if ((bitmap->fontId == fontKey) &&
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
             (bitmap->textStyle == textStyle) &&
 #endif
             (bitmap->unicode == unicode)) {
-            UpdateLru(bitmap);
-            return reinterpret_cast<uint8_t*>(bitmap->data);
+            return bitmap;
         }
     }
-
     return nullptr;
 }
+
+uint8_t* UIFontCache::GetBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
+{
+    if (shardNum_ == 0) {
+        return nullptr;
+    }
+    Shard& shard = GetShard(fontKey, unicode);
+    GraphicLockGuard guard(shard.lock);
+    Bitmap* bitmap = FindBitmap(shard, fontKey, unicode, textStyle);
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    UpdateLru(shard, bitmap);
+    return reinterpret_cast<uint8_t*>(bitmap->data);
+}
+
+uint8_t* UIFontCache::PinBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
+{
+    if (shardNum_ == 0) {
+        return nullptr;
+    }
+    Shard& shard = GetShard(fontKey, unicode);
+    GraphicLockGuard guard(shard.lock);
+    Bitmap* bitmap = FindBitmap(shard, fontKey, unicode, textStyle);
+    if (bitmap == nullptr) {
+        return nullptr;
+    }
+    bitmap->pinNum++;
+    UpdateLru(shard, bitmap);
+    return reinterpret_cast<uint8_t*>(bitmap->data);
+}
+
+void UIFontCache::UnpinBitmap(uint8_t* addr)
+{
+    if ((addr == nullptr) || (shardNum_ == 0) || !IsInCache(addr)) {
+        return;
+    }
+    Bitmap* bitmap = reinterpret_cast<Bitmap*>(addr - offsetof(struct Bitmap, data));
+    Shard& shard = GetShard(bitmap->fontId, bitmap->unicode);
+    GraphicLockGuard guard(shard.lock);
+    if (bitmap->pinNum == 0) {
+        GRAPHIC_LOGE("UIFontCache::UnpinBitmap bitmap not pinned");
+        return;
+    }
+    bitmap->pinNum--;
+    if (bitmap->released != 0) {
+        if (bitmap->pinNum == 0) {
+            ListDel(&bitmap->lruHead);
+            shard.allocator.Free(bitmap);
+        }
+        return;
+    }
+    if (!IsListEmpty(&bitmap->hashHead)) {
+        return;
+    }
+
+    /* a space from PinSpace is filled now, the same bitmap may have been added by another thread meanwhile */
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    TextStyle textStyle = bitmap->textStyle;
+#else
+    TextStyle textStyle = TEXT_STYLE_NORMAL;
+#endif
+    if (FindBitmap(shard, bitmap->fontId, bitmap->unicode, textStyle) != nullptr) {
+        shard.allocator.Free(bitmap);
+        return;
+    }
+    ListAdd(&bitmap->hashHead, shard.hashTable + bitmap->unicode % FONT_CACHE_HASH_NR);
+    ListAdd(&bitmap->lruHead, &shard.lruList);
+}
 } // namespace OHOS
@@ -18,10 +18,12 @@
  * Each bitmap is contained in a chunk block which can be searched quickly in a hash-table.
  * All the struct and memory block are force-aligned to ALIGNMENT_BYTES.
  * To make the most frequently used memroy hot, chunk blocks are managed with an easy lru algorithm.
- * Memory maps of font cache is shown below:
+ * The cache memory is split into shards, a bitmap is kept in the shard of its key. Every shard has its own lock,
+ * allocator, hash-table and lru list, so threads working on different shards do not wait for each other.
+ * Memory maps of a shard is shown below:
  *
- *  aligned bitmapCache    ─────────►┌────────────────────┐
- *  (FONT_BITMAP_CACHE_SIZE)         │    HashTable       │
+ *  aligned shard memory ───────────►┌────────────────────┐
+ *  (cache size / shard number)      │    HashTable       │
  *                                   │    (ListHead*32)   │
  *  UIFontAllocator::free_ ──────────┼────────────────────┼───────────► ┌──────────────┐
  *                                   │    chunk block     │             │ struct Chunk │
@@ -33,10 +35,16 @@
  *                                   │    last_chunk      │      └────► └──────────────┘
  *                                   │    (Head only)     │
  *                                   └────────────────────┘
+ *
+ * A bitmap returned by GetBitmap or GetSpace stays valid until a bitmap is added to its shard. Threads drawing while
+ * others add bitmaps pin the bitmaps they use: PinBitmap and PinSpace return bitmaps which are not evicted until
+ * UnpinBitmap. The space from PinSpace is found by GetBitmap only after it is filled and unpinned. PutSpace on a pinned
+ * bitmap hides it at once and frees it on its last UnpinBitmap. UnpinBitmap ignores addresses out of the cache memory.
  */
 #ifndef UI_FONT_CACHE_H
 #define UI_FONT_CACHE_H
 
+#include "graphic_locker.h"
 #include "ui_font_allocator.h"
 #include "font/ui_font_header.h"
 
@@ -44,7 +52,10 @@ namespace OHOS {
 class UIFontCache {
 public:
     static constexpr uint8_t FONT_CACHE_HASH_NR = 32;
+    static constexpr uint8_t FONT_CACHE_SHARD_NR = 4;
     static constexpr uint32_t FONT_CACHE_MIN_SIZE = 20 * 20;
+    /* a smaller shard would not hold the largest color glyphs */
+    static constexpr uint32_t FONT_CACHE_SHARD_MIN_SIZE = 0x20000;
     struct UI_STRUCT_ALIGN ListHead {
         ListHead* prev;
         ListHead* next;
@@ -54,8 +65,8 @@ public:
         ListHead lruHead;
         uint32_t fontId; // bitmap font: fontId vector font: fontKey ttfId + fontsize
         uint32_t unicode;
-        uint32_t reserve1;
-        uint32_t reserve2;
+        uint32_t pinNum;
+        uint32_t released;
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
         TextStyle textStyle;
 #endif
@@ -70,8 +81,31 @@ public:
     void PutSpace(uint8_t* addr);
     uint8_t* GetBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle = TEXT_STYLE_NORMAL);
 
+    uint8_t* PinSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    uint8_t* PinBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    void UnpinBitmap(uint8_t* addr);
+
+    uint8_t GetShardNum() const
+    {
+        return shardNum_;
+    }
+
 private:
-    void UpdateLru(Bitmap* bitmap);
+    struct Shard {
+        UIFontAllocator allocator;
+        ListHead* hashTable = nullptr;
+        ListHead lruList = {};
+        GraphicMutex lock;
+    };
+
+    Shard& GetShard(uint16_t fontKey, uint32_t unicode);
+    bool IsInCache(const uint8_t* addr) const
+    {
+        return (addr >= ram_) && (addr < ram_ + size_);
+    }
+    Bitmap* FindBitmap(Shard& shard, uint16_t fontKey, uint32_t unicode, TextStyle textStyle);
+    Bitmap* AllocateBitmap(Shard& shard, uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle);
+    void UpdateLru(Shard& shard, Bitmap* bitmap);
     void ListInit(ListHead* head)
     {
         head->prev = head;
@@ -89,10 +123,15 @@ private:
         node->next->prev = node->prev;
         node->prev->next = node->next;
     }
+    bool IsListEmpty(const ListHead* head) const
+    {
+        return head->next == head;
+    }
 
-    UIFontAllocator allocator_;
-    ListHead* hashTable_ = nullptr;
-    ListHead lruList_ = {};
+    Shard shards_[FONT_CACHE_SHARD_NR];
+    uint8_t* ram_ = nullptr;
+    uint32_t size_ = 0;
+    uint8_t shardNum_ = 0;
 };
 } // namespace OHOS
 #endif /* UI_FONT_CACHE_H */
@@ -45,14 +45,25 @@ void UIFontCacheManager::ClearCacheFlag()
     return glyphsCache_.ClearCacheFlag();
 }
 
-GlyphCacheNode* UIFontCacheManager::GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType)
+GlyphCacheNode* UIFontCacheManager::GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType,
+                                                     TextStyle textStyle)
 {
-    return glyphsCache_.GetNodeFromCache(unicode, fontKey, cacheType);
+    return glyphsCache_.GetNodeFromCache(unicode, fontKey, cacheType, textStyle);
 }
 
-GlyphCacheNode* UIFontCacheManager::GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey)
+GlyphCacheNode* UIFontCacheManager::GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey, TextStyle textStyle)
 {
-    return glyphsCache_.GetNodeCacheSpace(unicode, fontKey);
+    return glyphsCache_.GetNodeCacheSpace(unicode, fontKey, textStyle);
+}
+
+int8_t UIFontCacheManager::SetGlyphsCacheCapacity(uint32_t glyphNum)
+{
+    return glyphsCache_.SetCapacity(glyphNum);
+}
+
+GlyphsCache::Stats UIFontCacheManager::GetGlyphsCacheStats() const
+{
+    return glyphsCache_.GetStats();
 }
 
 void UIFontCacheManager::SetBitmapCacheSize(uint32_t bitmapCacheSize)
@@ -86,10 +97,10 @@ void UIFontCacheManager::BitmapCacheClear()
     bitmapCache_ = nullptr;
 }
 
-uint8_t* UIFontCacheManager::GetSpace(uint16_t fontKey, uint32_t unicode, uint32_t size)
+uint8_t* UIFontCacheManager::GetSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle)
 {
     if (bitmapCache_ != nullptr) {
-        return bitmapCache_->GetSpace(fontKey, unicode, size);
+        return bitmapCache_->GetSpace(fontKey, unicode, size, textStyle);
     }
     GRAPHIC_LOGE("UIFontCacheManager::GetSpace invalid bitmapCache");
     return nullptr;
@@ -99,16 +110,44 @@ void UIFontCacheManager::PutSpace(uint8_t* addr)
 {
     if (bitmapCache_ != nullptr) {
         bitmapCache_->PutSpace(addr);
+        return;
     }
     GRAPHIC_LOGE("UIFontCacheManager::PutSpace invalid bitmapCache");
 }
 
-uint8_t* UIFontCacheManager::GetBitmap(uint16_t fontKey, uint32_t unicode)
+uint8_t* UIFontCacheManager::GetBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
 {
     if (bitmapCache_ != nullptr) {
-        return bitmapCache_->GetBitmap(fontKey, unicode);
+        return bitmapCache_->GetBitmap(fontKey, unicode, textStyle);
     }
     GRAPHIC_LOGE("UIFontCacheManager::GetBitmap invalid bitmapCache");
     return nullptr;
 }
+
+uint8_t* UIFontCacheManager::PinSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle)
+{
+    if (bitmapCache_ != nullptr) {
+        return bitmapCache_->PinSpace(fontKey, unicode, size, textStyle);
+    }
+    GRAPHIC_LOGE("UIFontCacheManager::PinSpace invalid bitmapCache");
+    return nullptr;
+}
+
+uint8_t* UIFontCacheManager::PinBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle)
+{
+    if (bitmapCache_ != nullptr) {
+        return bitmapCache_->PinBitmap(fontKey, unicode, textStyle);
+    }
+    GRAPHIC_LOGE("UIFontCacheManager::PinBitmap invalid bitmapCache");
+    return nullptr;
+}
+
+void UIFontCacheManager::UnpinBitmap(uint8_t* addr)
+{
+    if (bitmapCache_ != nullptr) {
+        bitmapCache_->UnpinBitmap(addr);
+        return;
+    }
+    GRAPHIC_LOGE("UIFontCacheManager::UnpinBitmap invalid bitmapCache");
+}
 } // namespace OHOS
@@ -27,14 +27,20 @@ public:
     static UIFontCacheManager* GetInstance();
     int8_t GlyphsCacheInit();
     void ClearCacheFlag();
-    GlyphCacheNode* GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType);
-    GlyphCacheNode* GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey);
+    GlyphCacheNode* GetNodeFromCache(uint32_t unicode, uint16_t fontKey, uint16_t cacheType,
+                                     TextStyle textStyle = TEXT_STYLE_NORMAL);
+    GlyphCacheNode* GetNodeCacheSpace(uint32_t unicode, uint16_t fontKey, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    int8_t SetGlyphsCacheCapacity(uint32_t glyphNum);
+    GlyphsCache::Stats GetGlyphsCacheStats() const;
     void SetBitmapCacheSize(uint32_t bitmapCacheSize);
     void BitmapCacheInit();
     void BitmapCacheClear();
-    uint8_t* GetSpace(uint16_t fontKey, uint32_t unicode, uint32_t size);
+    uint8_t* GetSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle = TEXT_STYLE_NORMAL);
     void PutSpace(uint8_t* addr);
-    uint8_t* GetBitmap(uint16_t fontKey, uint32_t unicode);
+    uint8_t* GetBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    uint8_t* PinSpace(uint16_t fontKey, uint32_t unicode, uint32_t size, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    uint8_t* PinBitmap(uint16_t fontKey, uint32_t unicode, TextStyle textStyle = TEXT_STYLE_NORMAL);
+    void UnpinBitmap(uint8_t* addr);
 
     UIFontCache* GetBitmapCache()
     {
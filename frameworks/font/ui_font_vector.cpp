@@ -15,6 +15,7 @@
 
 #include "font/ui_font_vector.h"
 
+#include <algorithm>
 #include <freetype/ftbitmap.h>
 #include <freetype/ftoutln.h>
 #include <freetype/internal/ftobjs.h>
@@ -22,8 +23,10 @@
 #include <freetype/tttags.h>
 
 #include "common/typed_text.h"
+#include "dfx/ui_render_trace.h"
 #include "draw/draw_utils.h"
 #include "font/font_ram_allocator.h"
+#include "font/glyph_disk_cache.h"
 #include "gfx_utils/file.h"
 #include "gfx_utils/graphic_log.h"
 #include "graphic_config.h"
@@ -73,23 +76,6 @@ bool UIFontVector::IsColorEmojiFont(FT_Face& face)
     return false;
 }
 
-int8_t SetupColorFont(FT_Face face, uint8_t fontSize)
-{
-    if (face->num_fixed_sizes == 0) {
-        return INVALID_RET_VALUE;
-    }
-    FT_Int bestMatch = 0;
-    int32_t diff = MATH_ABS(fontSize - face->available_sizes[0].width);
-    for (int32_t i = 1; i < face->num_fixed_sizes; ++i) {
-        int32_t ndiff = MATH_ABS(fontSize - face->available_sizes[i].width);
-        if (ndiff < diff) {
-            bestMatch = i;
-            diff = ndiff;
-        }
-    }
-    return FT_Select_Size(face, bestMatch); // FT_Match_Size
-}
-
 uint8_t UIFontVector::RegisterFontInfo(const char* ttfName, uint8_t shaping)
 {
     if ((ttfName == nullptr) || !freeTypeInited_) {
@@ -486,14 +472,8 @@ int8_t UIFontVector::GetFaceInfo(uint16_t fontId, uint8_t fontSize, FaceInfo& fa
     }
 
     // Set the size
-    int8_t ret;
-    if (IsEmojiFont(fontId)) {
-        ret = SetupColorFont(ftFaces_[fontId], fontSize);
-    } else {
-        ret = FT_Set_Char_Size(faceInfo.face, fontSize * FONT_PIXEL_IN_POINT, 0, 0, 0);
-    }
-
-    if (ret != 0) {
+    int8_t ret = GlyphRasterizer::SetFaceSize(faceInfo.face, fontSize, IsEmojiFont(fontId));
+    if (ret != RET_VALUE_OK) {
         return INVALID_RET_VALUE;
     }
     fontSize_[fontId] = fontSize;
@@ -618,9 +598,9 @@ int8_t UIFontVector::GetFontHeader(FontHeader& fontHeader, uint16_t fontId, uint
     return RET_VALUE_OK;
 }
 
-void UIFontVector::SaveGlyphNode(uint32_t unicode, uint16_t fontKey, Metric *metric)
+void UIFontVector::SaveGlyphNode(uint32_t unicode, uint16_t fontKey, const Metric* metric, TextStyle textStyle)
 {
-    GlyphCacheNode* node = UIFontCacheManager::GetInstance()->GetNodeCacheSpace(unicode, fontKey);
+    GlyphCacheNode* node = UIFontCacheManager::GetInstance()->GetNodeCacheSpace(unicode, fontKey, textStyle);
     if (node == nullptr) {
         return;
     }
@@ -637,8 +617,13 @@ int8_t UIFontVector::GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16
 {
     // get glyph from glyph cache
     uint16_t fontKey = GetKey(fontId, fontSize);
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+    GlyphCacheNode* cacheNode = UIFontCacheManager::GetInstance()->GetNodeFromCache(
+        unicode, fontKey, GlyphCacheType::CACHE_TYPE_NONE, glyphNode.textStyle);
+#else
     GlyphCacheNode* cacheNode =
         UIFontCacheManager::GetInstance()->GetNodeFromCache(unicode, fontKey, GlyphCacheType::CACHE_TYPE_NONE);
+#endif
     if (cacheNode != nullptr) {
         glyphNode = cacheNode->node;
         return RET_VALUE_OK;
@@ -658,7 +643,11 @@ int8_t UIFontVector::GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16
         glyphNode.advance = f->advance;
         glyphNode.fontId = fontId;
 
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+        SaveGlyphNode(unicode, fontKey, f, glyphNode.textStyle);
+#else
         SaveGlyphNode(unicode, fontKey, f);
+#endif
         return RET_VALUE_OK;
     }
 
@@ -681,12 +670,39 @@ int8_t UIFontVector::GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16
 
 uint8_t* UIFontVector::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize)
 {
-    uint16_t fontKey = GetKey(fontId, fontSize);
+    return SearchBitmap(unicode, glyphNode, fontId, fontSize, false);
+}
+
+uint8_t* UIFontVector::PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize)
+{
+    return SearchBitmap(unicode, glyphNode, fontId, fontSize, true);
+}
+
+void UIFontVector::UnpinBitmap(uint8_t* bitmap)
+{
+    if (bitmap == nullptr) {
+        return;
+    }
+    UIFontCacheManager::GetInstance()->UnpinBitmap(bitmap - sizeof(Metric));
+}
+
+uint8_t* UIFontVector::GetCacheBitmap(uint16_t fontKey, uint32_t unicode, const GlyphNode& glyphNode, bool pin)
+{
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
-    uint8_t* bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontKey, unicode, glyphNode.textStyle);
+    TextStyle textStyle = glyphNode.textStyle;
 #else
-    uint8_t* bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontKey, unicode);
+    TextStyle textStyle = TEXT_STYLE_NORMAL;
 #endif
+    if (pin) {
+        return UIFontCacheManager::GetInstance()->PinBitmap(fontKey, unicode, textStyle);
+    }
+    return UIFontCacheManager::GetInstance()->GetBitmap(fontKey, unicode, textStyle);
+}
+
+uint8_t* UIFontVector::SearchBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, bool pin)
+{
+    uint16_t fontKey = GetKey(fontId, fontSize);
+    uint8_t* bitmap = GetCacheBitmap(fontKey, unicode, glyphNode, pin);
     if (bitmap != nullptr) {
         Metric* f = reinterpret_cast<Metric*>(bitmap);
         glyphNode.left = f->left;
@@ -695,7 +711,11 @@ uint8_t* UIFontVector::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_
         glyphNode.rows = f->rows;
         glyphNode.advance = f->advance;
         glyphNode.fontId = fontId;
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+        SaveGlyphNode(unicode, fontKey, f, glyphNode.textStyle);
+#else
         SaveGlyphNode(unicode, fontKey, f);
+#endif
         return bitmap + sizeof(Metric);
     }
 
@@ -713,11 +733,7 @@ uint8_t* UIFontVector::GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_
         return nullptr;
     }
 
-#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
-    bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontKey, unicode, glyphNode.textStyle);
-#else
-    bitmap = UIFontCacheManager::GetInstance()->GetBitmap(fontKey, unicode);
-#endif
+    bitmap = GetCacheBitmap(fontKey, unicode, glyphNode, pin);
     if (bitmap != nullptr) {
         return bitmap + sizeof(Metric);
     } else {
@@ -778,6 +794,7 @@ void UIFontVector::SetBold(uint16_t fontId)
 
 int8_t UIFontVector::LoadGlyphIntoFace(uint16_t& fontId, uint8_t fontSize, uint32_t unicode, GlyphNode& glyphNode)
 {
+    UI_RENDER_TRACE_SCOPE("RasterizeGlyph");
     int32_t error;
     if (IsGlyphFont(unicode) != 0) {
         if (fontId >= FONT_ID_MAX || fontId != GetFontId(unicode)) {
@@ -817,6 +834,7 @@ int8_t UIFontVector::LoadGlyphIntoFace(uint16_t& fontId, uint8_t fontSize, uint3
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
 int8_t UIFontVector::LoadGlyphIntoFace(uint16_t& fontId, uint32_t unicode, FT_Face face, TextStyle textStyle)
 {
+    UI_RENDER_TRACE_SCOPE("RasterizeGlyph");
     int32_t error;
     if (IsGlyphFont(unicode) != 0) {
         if (fontId != GetFontId(unicode)) {
@@ -867,59 +885,55 @@ void UIFontVector::SetFace(FaceInfo& faceInfo, uint32_t unicode)
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     SetFace(faceInfo, unicode, TEXT_STYLE_NORMAL);
 #else
-    Metric* f = reinterpret_cast<Metric*>(UIMalloc(sizeof(Metric)));
-    if (f == nullptr) {
-        return;
+    Metric f;
+    f.advance = static_cast<uint16_t>(faceInfo.face->glyph->advance.x / FONT_PIXEL_IN_POINT);
+    f.left = faceInfo.face->glyph->bitmap_left;
+    f.top = faceInfo.face->glyph->bitmap_top;
+    f.cols = faceInfo.face->glyph->bitmap.width;
+    f.rows = faceInfo.face->glyph->bitmap.rows;
+
+    ColorMode mode = (faceInfo.face->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA) ? ARGB8888 : A8;
+    if (PutBitmapCache(faceInfo.key, unicode, f, faceInfo.face->glyph->bitmap.buffer, mode)) {
+        ClearFontGlyph(faceInfo.face);
     }
-    f->advance = static_cast<uint16_t>(faceInfo.face->glyph->advance.x / FONT_PIXEL_IN_POINT);
-    f->left = faceInfo.face->glyph->bitmap_left;
-    f->top = faceInfo.face->glyph->bitmap_top;
-    f->cols = faceInfo.face->glyph->bitmap.width;
-    f->rows = faceInfo.face->glyph->bitmap.rows;
+#endif
+}
 
+bool UIFontVector::PutBitmapCache(uint16_t fontKey,
+                                  uint32_t unicode,
+                                  const Metric& metric,
+                                  const uint8_t* buffer,
+                                  ColorMode mode)
+{
     // cache glyph
-    SaveGlyphNode(unicode, faceInfo.key, f);
-
-    int16_t pixSize;
-    ColorMode mode;
-    if (faceInfo.face->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA) {
-        pixSize = 0x04; // 4 Byte
-        mode = ARGB8888;
-    } else {
-        pixSize = 1;
-        mode = A8;
-    }
+    SaveGlyphNode(unicode, fontKey, &metric);
 
     GlyphNode glyphNode;
-    glyphNode.left = f->left;
-    glyphNode.top = f->top;
-    glyphNode.cols = f->cols;
-    glyphNode.rows = f->rows;
-    glyphNode.advance = f->advance;
+    glyphNode.left = metric.left;
+    glyphNode.top = metric.top;
+    glyphNode.cols = metric.cols;
+    glyphNode.rows = metric.rows;
+    glyphNode.advance = metric.advance;
     glyphNode.unicode = unicode;
-    glyphNode.fontId = faceInfo.key;
-    BufferInfo bufInfo = UIFontAllocator::GetCacheBuffer(faceInfo.key, unicode, mode, glyphNode, true);
+    glyphNode.fontId = fontKey;
+    /* pinned while it is filled, so threads looking the glyph up meanwhile do not find it half filled */
+    BufferInfo bufInfo = UIFontAllocator::GetCacheBuffer(fontKey, unicode, mode, glyphNode, true, true);
+    if (bufInfo.virAddr == nullptr) {
+        return false;
+    }
+    UIFontCacheManager* cacheManager = UIFontCacheManager::GetInstance();
+    uint8_t* space = reinterpret_cast<uint8_t*>(bufInfo.virAddr);
     uint32_t bitmapSize = bufInfo.stride * bufInfo.height;
-    uint32_t rawSize = glyphNode.cols * glyphNode.rows * pixSize;
-
-    if (bufInfo.virAddr != nullptr) {
-        if (memcpy_s(bufInfo.virAddr, sizeof(Metric), f, sizeof(Metric)) != EOK) {
-            UIFontCacheManager::GetInstance()->PutSpace(reinterpret_cast<uint8_t*>(bufInfo.virAddr));
-            UIFree(f);
-            return;
-        }
-        if ((faceInfo.face->glyph->bitmap.buffer != nullptr) &&
-            (memcpy_s(reinterpret_cast<uint8_t*>(bufInfo.virAddr) + sizeof(Metric), bitmapSize,
-                      faceInfo.face->glyph->bitmap.buffer, rawSize) != EOK)) {
-            UIFontCacheManager::GetInstance()->PutSpace(reinterpret_cast<uint8_t*>(bufInfo.virAddr));
-            UIFree(f);
-            return;
-        }
-        UIFontAllocator::RearrangeBitmap(bufInfo, rawSize, true);
-        ClearFontGlyph(faceInfo.face);
+    uint32_t rawSize = glyphNode.cols * glyphNode.rows * GlyphRasterizer::GetPxSize(mode);
+    if ((memcpy_s(space, sizeof(Metric), &metric, sizeof(Metric)) != EOK) ||
+        ((buffer != nullptr) && (memcpy_s(space + sizeof(Metric), bitmapSize, buffer, rawSize) != EOK))) {
+        cacheManager->PutSpace(space);
+        cacheManager->UnpinBitmap(space);
+        return false;
     }
-    UIFree(f);
-#endif
+    UIFontAllocator::RearrangeBitmap(bufInfo, rawSize, true);
+    cacheManager->UnpinBitmap(space);
+    return true;
 }
 
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
@@ -933,7 +947,7 @@ void UIFontVector::SetFace(FaceInfo& faceInfo, uint32_t unicode, TextStyle textS
     f.rows = faceInfo.face->glyph->bitmap.rows;
 
     // cache glyph
-    SaveGlyphNode(unicode, faceInfo.key, &f);
+    SaveGlyphNode(unicode, faceInfo.key, &f, textStyle);
 
     int16_t pixSize = 1;
     if (faceInfo.face->glyph->bitmap.pixel_mode == FT_PIXEL_MODE_BGRA) {
@@ -941,17 +955,16 @@ void UIFontVector::SetFace(FaceInfo& faceInfo, uint32_t unicode, TextStyle textS
     }
     uint32_t bitmapSize = faceInfo.face->glyph->bitmap.width * faceInfo.face->glyph->bitmap.rows * pixSize;
     // cache bitmap
-    uint8_t* bitmap =
-        UIFontCacheManager::GetInstance()->GetSpace(faceInfo.key, unicode, bitmapSize + sizeof(Metric), textStyle);
+    UIFontCacheManager* cacheManager = UIFontCacheManager::GetInstance();
+    uint8_t* bitmap = cacheManager->PinSpace(faceInfo.key, unicode, bitmapSize + sizeof(Metric), textStyle);
     if (bitmap != nullptr) {
-        if (memcpy_s(bitmap, sizeof(Metric), &f, sizeof(Metric)) != EOK) {
-            UIFontCacheManager::GetInstance()->PutSpace(bitmap);
-            return;
-        }
-        if (memcpy_s(bitmap + sizeof(Metric), bitmapSize, faceInfo.face->glyph->bitmap.buffer, bitmapSize) != EOK) {
-            UIFontCacheManager::GetInstance()->PutSpace(bitmap);
+        if ((memcpy_s(bitmap, sizeof(Metric), &f, sizeof(Metric)) != EOK) ||
+            (memcpy_s(bitmap + sizeof(Metric), bitmapSize, faceInfo.face->glyph->bitmap.buffer, bitmapSize) != EOK)) {
+            cacheManager->PutSpace(bitmap);
+            cacheManager->UnpinBitmap(bitmap);
             return;
         }
+        cacheManager->UnpinBitmap(bitmap);
         ClearFontGlyph(faceInfo.face);
     }
 }
@@ -970,6 +983,116 @@ void UIFontVector::ClearFontGlyph(FT_Face face)
     }
 }
 
+int8_t UIFontVector::SetGlyphCacheDir(const char* dir)
+{
+    if (dir == nullptr) {
+        glyphCacheDir_.clear();
+    } else {
+        glyphCacheDir_ = dir;
+    }
+    return RET_VALUE_OK;
+}
+
+bool UIFontVector::GetFontFace(uint16_t fontId,
+                               uint8_t fontSize,
+                               std::string& path,
+                               GlyphRasterizer::FontFace& font)
+{
+    const UITextLanguageFontParam& fontInfo = fontInfo_[fontId];
+    path = ttfDir_;
+    if (fontInfo.ttcIndex < FONT_TTC_MAX) {
+        if (ttcInfos_[fontInfo.ttcIndex].ttcName == nullptr) {
+            return false;
+        }
+        path.append(ttcInfos_[fontInfo.ttcIndex].ttcName);
+        font.faceIndex = fontInfo.ttfIndex;
+    } else {
+        path.append(fontInfo.ttfName);
+        font.faceIndex = 0;
+    }
+    font.path = path.c_str();
+    font.fontSize = fontSize;
+    font.isColor = IsEmojiFont(fontId);
+    return true;
+}
+
+int32_t UIFontVector::PreloadGlyphs(const uint32_t* unicodes,
+                                    uint32_t num,
+                                    uint16_t fontId,
+                                    uint8_t fontSize,
+                                    uint8_t threadNum)
+{
+    FaceInfo faceInfo;
+    if ((unicodes == nullptr) || (GetFaceInfo(fontId, fontSize, faceInfo) != RET_VALUE_OK) ||
+        (faceInfo.face == nullptr)) {
+        return INVALID_RET_VALUE;
+    }
+    // shaped text is drawn by glyph index instead of code point
+    if (fontInfo_[fontId].shaping != 0) {
+        return INVALID_RET_VALUE;
+    }
+    if (num == 0) {
+        return 0;
+    }
+    std::string fontPath;
+    GlyphRasterizer::FontFace font;
+    if (!GetFontFace(fontId, fontSize, fontPath, font)) {
+        return INVALID_RET_VALUE;
+    }
+
+    RasterizedGlyph* glyphs = static_cast<RasterizedGlyph*>(UIMalloc(num * sizeof(RasterizedGlyph)));
+    if (glyphs == nullptr) {
+        return INVALID_RET_VALUE;
+    }
+    uint32_t pendingNum = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if (UIFontCacheManager::GetInstance()->GetBitmap(faceInfo.key, unicodes[i]) == nullptr) {
+            glyphs[pendingNum++] = {unicodes[i], 0, 0, 0, 0, 0, nullptr, A8, GLYPH_PENDING};
+        }
+    }
+    auto compare = [](const RasterizedGlyph& a, const RasterizedGlyph& b) { return a.unicode < b.unicode; };
+    auto equal = [](const RasterizedGlyph& a, const RasterizedGlyph& b) { return a.unicode == b.unicode; };
+    std::sort(glyphs, glyphs + pendingNum, compare);
+    pendingNum = static_cast<uint32_t>(std::unique(glyphs, glyphs + pendingNum, equal) - glyphs);
+
+    if (pendingNum > 0) {
+        GlyphDiskCache diskCache;
+        bool diskCacheValid = !glyphCacheDir_.empty() && diskCache.Init(glyphCacheDir_.c_str(), font);
+        uint32_t loadNum = diskCacheValid ? diskCache.Load(glyphs, pendingNum) : 0;
+        if (loadNum < pendingNum) {
+            GlyphRasterizer::Rasterize(font, glyphs, pendingNum, threadNum);
+            if (diskCacheValid) {
+                diskCache.Append(glyphs, pendingNum);
+            }
+        }
+        // the glyph node cache is not thread safe, so the glyphs are only cached after the workers are done
+        for (uint32_t i = 0; i < pendingNum; i++) {
+            const RasterizedGlyph& glyph = glyphs[i];
+            if ((glyph.state != GLYPH_LOADED) && (glyph.state != GLYPH_RASTERIZED)) {
+                continue;
+            }
+            Metric f;
+            f.left = glyph.left;
+            f.top = glyph.top;
+            f.cols = glyph.cols;
+            f.rows = glyph.rows;
+            f.advance = glyph.advance;
+            PutBitmapCache(faceInfo.key, glyph.unicode, f, glyph.bitmap, glyph.mode);
+        }
+        GlyphRasterizer::FreeGlyphs(glyphs, pendingNum);
+    }
+    UIFree(glyphs);
+
+    // glyphs preloaded early in a large batch may have been evicted by the later ones
+    int32_t cachedNum = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if (UIFontCacheManager::GetInstance()->GetBitmap(faceInfo.key, unicodes[i]) != nullptr) {
+            cachedNum++;
+        }
+    }
+    return cachedNum;
+}
+
 inline uint16_t UIFontVector::GetKey(uint16_t fontId, uint8_t size)
 {
     return ((static_cast<uint16_t>(fontId)) << 8) + size; // fontId store at the (8+1)th bit
@@ -14,6 +14,7 @@
  */
 
 #if ENABLE_ICU
+#include "common/decoded_text.h"
 #include "common/typed_text.h"
 #include "draw/draw_utils.h"
 #include "font/ui_font.h"
@@ -171,6 +172,81 @@ uint32_t UILineBreakEngine::GetNextLineAndWidth(const char* text,
     return preIndex;
 }
 
+uint32_t UILineBreakEngine::GetNextLineAndWidth(DecodedText& text,
+                                                uint32_t begin,
+                                                uint16_t fontId,
+                                                uint8_t fontSize,
+                                                int16_t space,
+                                                bool allBreak,
+                                                int16_t& maxWidth,
+                                                int16_t& maxHeight,
+                                                uint16_t& letterIndex,
+                                                SizeSpan* sizeSpans,
+                                                uint16_t len)
+{
+    const char* str = text.GetText();
+    if (str == nullptr) {
+        return 0;
+    }
+    const uint16_t* widths = text.GetWidths(fontId, fontSize);
+    if (widths == nullptr) {
+        return GetNextLineAndWidth(str + begin, fontId, fontSize, space, allBreak, maxWidth, maxHeight, letterIndex,
+                                   sizeSpans, len);
+    }
+    const uint32_t* codePoints = text.GetCodePoints();
+    uint32_t end = MATH_MIN(begin + len, text.GetByteNum());
+    int16_t fontHeight = UIFont::GetInstance()->GetHeight(fontId, fontSize);
+    bool isAllCanBreak = allBreak;
+    uint32_t preIndex = 0;
+    int16_t lastWidth = 0;
+    int16_t lastIndex = 0;
+    int16_t curWidth = 0;
+    int32_t state = LINE_BREAK_STATE_START;
+    int16_t width = 0;
+    int16_t height = 0;
+    for (uint16_t i = text.GetLetterIndex(begin); (i < text.GetLetterNum()) && (text.GetByteOffset(i) < end); i++) {
+        uint32_t unicode = codePoints[i];
+        uint32_t byteIdx = text.GetByteOffset(i + 1) - begin;
+        if (unicode == 0) {
+            preIndex = byteIdx;
+            continue;
+        }
+        if (isAllCanBreak || IsBreakPos(unicode, fontId, fontSize, state)) {
+            state = LINE_BREAK_STATE_START;
+            // Accumulates the status value from the current character.
+            IsBreakPos(unicode, fontId, fontSize, state);
+            lastIndex = preIndex;
+            lastWidth = curWidth;
+        }
+        if ((sizeSpans != nullptr) && sizeSpans[letterIndex].isSizeSpan) {
+            width = GetLetterWidth(unicode, letterIndex, height, fontId, fontSize, sizeSpans);
+        } else {
+            width = widths[i];
+            height = fontHeight;
+        }
+        letterIndex++;
+        if (height > maxHeight) {
+            maxHeight = height;
+        }
+        int16_t nextWidth = (curWidth > 0 && width > 0) ? (curWidth + space + width) : (curWidth + width);
+        if (nextWidth > maxWidth) {
+            letterIndex--;
+            if (lastIndex == 0) {
+                break;
+            }
+            maxWidth = lastWidth;
+            return lastIndex;
+        }
+        curWidth = nextWidth;
+        preIndex = byteIdx;
+        if ((str[begin + byteIdx - 1] == '\r') || (str[begin + byteIdx - 1] == '\n')) {
+            break;
+        }
+    }
+    maxWidth = curWidth;
+    return preIndex;
+}
+
 int16_t UILineBreakEngine::GetLetterWidth(uint32_t unicode, uint16_t& letterIndex, int16_t& height,
                                           uint16_t fontId, uint8_t fontSize, SizeSpan* sizeSpans)
 {
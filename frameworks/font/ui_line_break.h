@@ -28,6 +28,7 @@
 #include "gfx_utils/mem_api.h"
 
 namespace OHOS {
+class DecodedText;
 class UILineBreakProxy;
 /**
  * @brief Using ICU as the core of lineBreakEngine.
@@ -120,6 +121,18 @@ public:
                                  uint16_t& letterIndex,
                                  SizeSpan* sizeSpans,
                                  uint16_t len = 0xFFFF);
+    /* The same for a decoded text from byte begin. */
+    uint32_t GetNextLineAndWidth(DecodedText& text,
+                                 uint32_t begin,
+                                 uint16_t fontId,
+                                 uint8_t fontSize,
+                                 int16_t space,
+                                 bool allBreak,
+                                 int16_t& maxWidth,
+                                 int16_t& maxHeight,
+                                 uint16_t& letterIndex,
+                                 SizeSpan* sizeSpans,
+                                 uint16_t len = 0xFFFF);
     bool IsBreakPos(uint32_t unicode, uint16_t fontId, uint8_t fontSize, int32_t& state);
 
 private:
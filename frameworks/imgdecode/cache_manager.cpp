@@ -14,6 +14,7 @@
  */
 
 #include "imgdecode/cache_manager.h"
+#include "dfx/ui_render_trace.h"
 #include "gfx_utils/graphic_log.h"
 #include "hal_tick.h"
 #include "securec.h"
@@ -43,6 +44,7 @@ void CacheEntry::Clear()
     }
 
     dsc_.decoder = nullptr;
+    ClearMipmap();
     ClearSrc();
     dsc_.imgInfo.data = nullptr;
     dsc_.fd = -1;
@@ -58,6 +60,14 @@ void CacheEntry::ClearSrc()
     dsc_.path = nullptr;
 }
 
+void CacheEntry::ClearMipmap()
+{
+    if (mipmap_ != nullptr) {
+        delete mipmap_;
+        mipmap_ = nullptr;
+    }
+}
+
 RetCode CacheEntry::SetSrc(const char* path)
 {
     ClearSrc();
@@ -131,10 +141,12 @@ RetCode CacheManager::Open(const char* path, const Style& style, CacheEntry& ent
         return RetCode::OK;
     }
 
+    UI_RENDER_TRACE_SCOPE("DecodeImage");
     SelectEntryToReplace(indexHitted);
     if ((entryArr_[indexHitted].dsc_.path != nullptr) && (entryArr_[indexHitted].dsc_.decoder != nullptr)) {
         entryArr_[indexHitted].dsc_.decoder->Close(entryArr_[indexHitted].dsc_);
     }
+    entryArr_[indexHitted].ClearMipmap();
 
     uint32_t startTime = HALTick::GetInstance().GetTime();
     entryArr_[indexHitted].life_ = 0;
@@ -189,6 +201,24 @@ bool CacheManager::GetImageHeader(const char* path, ImageHeader& header)
     return true;
 }
 
+const ImageMipmap* CacheManager::GetMipmap(const char* path)
+{
+    if (path == nullptr) {
+        return nullptr;
+    }
+    for (uint16_t index = 0; index < GetSize(); index++) {
+        CacheEntry& entry = entryArr_[index];
+        if ((entry.dsc_.srcType != IMG_SRC_FILE) || (entry.dsc_.path == nullptr) || strcmp(entry.dsc_.path, path)) {
+            continue;
+        }
+        if ((entry.mipmap_ == nullptr) && entry.InCache()) {
+            entry.mipmap_ = ImageMipmap::Create(entry.dsc_.imgInfo);
+        }
+        return entry.mipmap_;
+    }
+    return nullptr;
+}
+
 RetCode CacheManager::Reset()
 {
     if (entryArr_ == nullptr) {
@@ -17,11 +17,12 @@
 #define GRAPHIC_LITE_CACHE_MANAGER_H
 
 #include "file_img_decoder.h"
+#include "image_mipmap.h"
 
 namespace OHOS {
 class CacheEntry : public HeapBase {
 public:
-    CacheEntry() : dsc_{0}, life_(0) {}
+    CacheEntry() : dsc_{0}, life_(0), mipmap_(nullptr) {}
 
     ~CacheEntry() {}
 
@@ -56,10 +57,12 @@ private:
 
     void Clear();
     void ClearSrc();
+    void ClearMipmap();
     RetCode SetSrc(const char* path);
 
     FileImgDecoder::ImgResDsc dsc_;
     int32_t life_;
+    ImageMipmap* mipmap_;
 };
 
 class CacheManager : public HeapBase {
@@ -83,6 +86,9 @@ public:
 
     bool GetImageHeader(const char* path, ImageHeader& header);
 
+    /* Creates the mip levels of an opened image on first use, only images which are read to cache have them. */
+    const ImageMipmap* GetMipmap(const char* path);
+
 private:
     CacheManager() : size_(0), entryArr_(nullptr){}
 
@@ -17,8 +17,14 @@
 #include "gfx_utils/mem_api.h"
 #include "imgdecode/file_img_decoder.h"
 #include "imgdecode/image_load.h"
+#include "securec.h"
 
 namespace OHOS {
+namespace {
+/* 2: the offsets of the row and of the next row */
+constexpr uint8_t ROW_RANGE_NUM = 2;
+} // namespace
+
 FileImgDecoder& FileImgDecoder::GetInstance()
 {
     static FileImgDecoder instance;
@@ -53,6 +59,11 @@ RetCode FileImgDecoder::Close(ImgResDsc& dsc)
         ImageCacheFree(dsc.imgInfo);
         dsc.imgInfo.data = nullptr;
     }
+    if (dsc.rleData != nullptr) {
+        UIFree(dsc.rleData);
+        dsc.rleData = nullptr;
+        dsc.rleSize = 0;
+    }
     if (dsc.fd && (dsc.fd != -1)) {
         close(dsc.fd);
         dsc.fd = -1;
@@ -90,13 +101,47 @@ RetCode FileImgDecoder::GetHeader(ImgResDsc& dsc)
 RetCode FileImgDecoder::ReadLine(ImgResDsc& dsc, const Point& start, int16_t len, uint8_t* buf)
 {
     if (IsImgValidMode(dsc.imgInfo.header.colorMode)) {
+        if (dsc.imgInfo.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+            return ReadLineRle(dsc, start, len, buf);
+        }
         return ReadLineTrueColor(dsc, start, len, buf);
     }
     return RetCode::FAIL;
 }
 
+void FileImgDecoder::ReadRleToCache(ImgResDsc& dsc)
+{
+    struct stat info;
+    if ((dsc.rleData != nullptr) || (dsc.fd < 0) || (fstat(dsc.fd, &info) != 0)) {
+        return;
+    }
+    uint32_t offsetsSize = (dsc.imgInfo.header.height + 1) * sizeof(uint32_t);
+    if (info.st_size < static_cast<off_t>(sizeof(ImageHeader) + offsetsSize)) {
+        return;
+    }
+    uint32_t size = info.st_size - sizeof(ImageHeader);
+    /* if there is no memory for it, the rows are read from the file when drawn */
+    uint8_t* data = static_cast<uint8_t*>(UIMalloc(size));
+    if (data == nullptr) {
+        return;
+    }
+    if ((lseek(dsc.fd, sizeof(ImageHeader), SEEK_SET) < 0) ||
+        (read(dsc.fd, data, size) != static_cast<int32_t>(size))) {
+        UIFree(data);
+        return;
+    }
+    dsc.rleData = data;
+    dsc.rleSize = size;
+    close(dsc.fd);
+    dsc.fd = -1;
+}
+
 RetCode FileImgDecoder::ReadToCache(ImgResDsc& dsc)
 {
+    if (dsc.imgInfo.header.compressMode == COMPRESS_MODE_ROW_RLE_ALG) {
+        ReadRleToCache(dsc);
+        return RetCode::OK;
+    }
     struct stat info;
     if (!dsc.inCache_) {
         lseek(dsc.fd, 0, SEEK_SET);
@@ -162,4 +207,49 @@ RetCode FileImgDecoder::ReadLineTrueColor(ImgResDsc& dsc, const Point& start, in
 
     return RetCode::OK;
 }
+
+RetCode FileImgDecoder::ReadLineRle(ImgResDsc& dsc, const Point& start, int16_t len, uint8_t* buf)
+{
+    const ImageHeader& header = dsc.imgInfo.header;
+    if ((start.y < 0) || (start.y >= header.height) || (start.x < 0) || (start.x + len > header.width)) {
+        return RetCode::FAIL;
+    }
+    uint8_t pxBytes = DrawUtils::GetPxSizeByColorMode(header.colorMode) >> BYTE_TO_BIT_SHIFT;
+    uint32_t offsetsSize = (header.height + 1) * sizeof(uint32_t);
+    uint32_t rowRange[ROW_RANGE_NUM];
+    if (dsc.rleData != nullptr) {
+        if (memcpy_s(rowRange, sizeof(rowRange), dsc.rleData + start.y * sizeof(uint32_t), sizeof(rowRange)) != EOK) {
+            return RetCode::FAIL;
+        }
+        if ((rowRange[1] < rowRange[0]) || (rowRange[1] > dsc.rleSize - offsetsSize)) {
+            return RetCode::FAIL;
+        }
+        const uint8_t* row = dsc.rleData + offsetsSize + rowRange[0];
+        return ImageLoad::DecodeRleRow(row, rowRange[1] - rowRange[0], pxBytes, start.x, len, buf) ? RetCode::OK
+                                                                                                   : RetCode::FAIL;
+    }
+
+    if ((lseek(dsc.fd, sizeof(ImageHeader) + start.y * sizeof(uint32_t), SEEK_SET) < 0) ||
+        (read(dsc.fd, rowRange, sizeof(rowRange)) != static_cast<int32_t>(sizeof(rowRange)))) {
+        return RetCode::FAIL;
+    }
+    /* a row of literal packets only is the largest: one more byte for every 128 pixels */
+    uint32_t maxRowSize = header.width * (pxBytes + 1);
+    if ((rowRange[1] < rowRange[0]) || (rowRange[1] - rowRange[0] > maxRowSize)) {
+        return RetCode::FAIL;
+    }
+    uint32_t rowSize = rowRange[1] - rowRange[0];
+    uint8_t* row = static_cast<uint8_t*>(UIMalloc(rowSize));
+    if (row == nullptr) {
+        return RetCode::FAIL;
+    }
+    RetCode ret = RetCode::FAIL;
+    if ((lseek(dsc.fd, sizeof(ImageHeader) + offsetsSize + rowRange[0], SEEK_SET) >= 0) &&
+        (read(dsc.fd, row, rowSize) == static_cast<int32_t>(rowSize)) &&
+        ImageLoad::DecodeRleRow(row, rowSize, pxBytes, start.x, len, buf)) {
+        ret = RetCode::OK;
+    }
+    UIFree(row);
+    return ret;
+}
 } // namespace OHOS
@@ -43,6 +43,8 @@ public:
         int32_t fd;
         ImageSrcType srcType;
         bool inCache_;
+        uint8_t* rleData; // the rows of COMPRESS_MODE_ROW_RLE_ALG stay compressed here, imgInfo.data is not used
+        uint32_t rleSize;
     };
 
     RetCode Open(ImgResDsc& dsc);
@@ -68,6 +70,8 @@ private:
         }
     }
     RetCode ReadLineTrueColor(ImgResDsc& dsc, const Point& start, int16_t len, uint8_t* buf);
+    RetCode ReadLineRle(ImgResDsc& dsc, const Point& start, int16_t len, uint8_t* buf);
+    void ReadRleToCache(ImgResDsc& dsc);
 
     FileImgDecoder(const FileImgDecoder&) = delete;
     FileImgDecoder& operator=(const FileImgDecoder&) = delete;
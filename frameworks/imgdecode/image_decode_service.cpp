@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/image_decode_service.h"
+
+#include "common/image.h"
+#include "common/image_decode_ability.h"
+#include "components/ui_tree_manager.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/graphic_math.h"
+#include "gfx_utils/mem_api.h"
+#include "securec.h"
+
+namespace OHOS {
+ImageDecodeService* ImageDecodeService::GetInstance()
+{
+    static ImageDecodeService instance;
+    return &instance;
+}
+
+ImageDecodeService::ImageDecodeService()
+    : workerNum_(DEFAULT_WORKER_NUM), startedNum_(0), quit_(false)
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_init(&lock_, nullptr);
+    pthread_cond_init(&cond_, nullptr);
+#endif
+}
+
+ImageDecodeService::~ImageDecodeService()
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_lock(&lock_);
+    quit_ = true;
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&lock_);
+    for (uint8_t i = 0; i < startedNum_; i++) {
+        pthread_join(workers_[i], nullptr);
+    }
+    startedNum_ = 0;
+#endif
+    CancelRequests(nullptr);
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&lock_);
+#endif
+}
+
+void ImageDecodeService::SetWorkerNum(uint8_t workerNum)
+{
+    if ((startedNum_ == 0) && (workerNum > 0)) {
+        workerNum_ = MATH_MIN(workerNum, MAX_WORKER_NUM);
+    }
+}
+
+void ImageDecodeService::FreeRequest(DecodeRequest* request)
+{
+    if (request == nullptr) {
+        return;
+    }
+#if ENABLE_JPEG_AND_PNG
+    Image::FreeDecodedImageInfo(request->imgInfo);
+#endif
+    request->imgInfo = nullptr;
+    UIFree(reinterpret_cast<void*>(request->src));
+    request->src = nullptr;
+    delete request;
+}
+
+bool ImageDecodeService::Decode(const char* src,
+                                ImageDecodeListener* listener,
+                                UIView* owner,
+                                const Image::DecodeSize& size)
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    if ((src == nullptr) || (listener == nullptr)) {
+        return false;
+    }
+    uint32_t ability = ImageDecodeAbility::GetInstance().GetImageDecodeAbility();
+    Image::ImageType type = Image::CheckImgType(src);
+    bool supported = ((type == Image::IMG_PNG) && ((ability & IMG_SUPPORT_PNG) == IMG_SUPPORT_PNG)) ||
+                     ((type == Image::IMG_JPEG) && ((ability & IMG_SUPPORT_JPEG) == IMG_SUPPORT_JPEG));
+    if (!supported || !StartWorkers()) {
+        return false;
+    }
+
+    DecodeRequest* request = new DecodeRequest();
+    if (request == nullptr) {
+        return false;
+    }
+    size_t strLen = strlen(src) + 1;
+    request->src = static_cast<char*>(UIMalloc(static_cast<uint32_t>(strLen)));
+    if ((request->src == nullptr) || (strcpy_s(request->src, strLen, src) != EOK)) {
+        FreeRequest(request);
+        return false;
+    }
+    request->listener = listener;
+    request->owner = owner;
+    request->imgInfo = nullptr;
+    request->size = size;
+    request->decodeShift = 0;
+    request->decoded = false;
+    request->detached = false;
+
+    pthread_mutex_lock(&lock_);
+    pendingList_.PushBack(request);
+    pthread_cond_signal(&cond_);
+    pthread_mutex_unlock(&lock_);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool ImageDecodeService::IsDescendant(const UIView* view, const UIView* ancestor)
+{
+    while (view != nullptr) {
+        if (view == ancestor) {
+            return true;
+        }
+        view = view->GetParent();
+    }
+    return false;
+}
+
+void ImageDecodeService::CancelInList(List<DecodeRequest*>& list, const ImageDecodeListener* listener)
+{
+    ListNode<DecodeRequest*>* node = list.Begin();
+    while (node != list.End()) {
+        DecodeRequest* request = node->data_;
+        if ((listener != nullptr) && (request->listener != listener)) {
+            node = node->next_;
+            continue;
+        }
+        if (&list == &decodingList_) {
+            /* the worker owns the request now, it drops the result once decoding is done */
+            request->listener = nullptr;
+            request->owner = nullptr;
+            node = node->next_;
+        } else {
+            FreeRequest(request);
+            node = list.Remove(node);
+        }
+    }
+}
+
+void ImageDecodeService::CancelRequests(const ImageDecodeListener* listener)
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_lock(&lock_);
+#endif
+    CancelInList(pendingList_, listener);
+    CancelInList(decodingList_, listener);
+    CancelInList(doneList_, listener);
+    CancelInList(detachedList_, listener);
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_unlock(&lock_);
+#endif
+}
+
+void ImageDecodeService::Cancel(const ImageDecodeListener* listener)
+{
+    if (listener != nullptr) {
+        CancelRequests(listener);
+    }
+}
+
+bool ImageDecodeService::IsPending(const ImageDecodeListener* listener)
+{
+    if (listener == nullptr) {
+        return false;
+    }
+    bool pending = false;
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_lock(&lock_);
+#endif
+    List<DecodeRequest*>* lists[] = {&pendingList_, &decodingList_, &doneList_, &detachedList_};
+    for (List<DecodeRequest*>* list : lists) {
+        for (ListNode<DecodeRequest*>* node = list->Begin(); node != list->End(); node = node->next_) {
+            if (node->data_->listener == listener) {
+                pending = true;
+                break;
+            }
+        }
+    }
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_unlock(&lock_);
+#endif
+    return pending;
+}
+
+void ImageDecodeService::MoveRequests(List<DecodeRequest*>& from,
+                                      List<DecodeRequest*>& to,
+                                      const UIView* view,
+                                      bool detached)
+{
+    ListNode<DecodeRequest*>* node = from.Begin();
+    while (node != from.End()) {
+        DecodeRequest* request = node->data_;
+        if ((request->listener == nullptr) || !IsDescendant(request->owner, view)) {
+            node = node->next_;
+            continue;
+        }
+        request->detached = detached;
+        to.PushBack(request);
+        node = from.Remove(node);
+    }
+}
+
+void ImageDecodeService::DetachRequests(const UIView* view)
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_lock(&lock_);
+    MoveRequests(pendingList_, detachedList_, view, true);
+    MoveRequests(doneList_, detachedList_, view, true);
+    /* the ones being decoded are held back by the worker once they are done */
+    for (ListNode<DecodeRequest*>* node = decodingList_.Begin(); node != decodingList_.End(); node = node->next_) {
+        DecodeRequest* request = node->data_;
+        if ((request->listener != nullptr) && IsDescendant(request->owner, view)) {
+            request->detached = true;
+        }
+    }
+    pthread_mutex_unlock(&lock_);
+#endif
+}
+
+void ImageDecodeService::AttachRequests(const UIView* view)
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    pthread_mutex_lock(&lock_);
+    for (ListNode<DecodeRequest*>* node = decodingList_.Begin(); node != decodingList_.End(); node = node->next_) {
+        DecodeRequest* request = node->data_;
+        if ((request->listener != nullptr) && IsDescendant(request->owner, view)) {
+            request->detached = false;
+        }
+    }
+    if (detachedList_.Size() == 0) {
+        pthread_mutex_unlock(&lock_);
+        return;
+    }
+    List<DecodeRequest*> attachedList;
+    MoveRequests(detachedList_, attachedList, view, false);
+    while (attachedList.Size() > 0) {
+        DecodeRequest* request = attachedList.Begin()->data_;
+        attachedList.Remove(attachedList.Begin());
+        if (request->decoded) {
+            doneList_.PushBack(request);
+        } else {
+            pendingList_.PushBack(request);
+            pthread_cond_signal(&cond_);
+        }
+    }
+    pthread_mutex_unlock(&lock_);
+#endif
+}
+
+void ImageDecodeService::OnViewLifeEvent()
+{
+    UIView* view = nullptr;
+    UITreeManager::ViewLifeEvent event;
+    UITreeManager::GetInstance().GetLastEvent(view, event);
+    if (view == nullptr) {
+        return;
+    }
+    /* views detached from the tree are not displayed, their decoding waits until they are added again */
+    if (event == UITreeManager::REMOVE) {
+        GetInstance()->DetachRequests(view);
+    } else if (event == UITreeManager::ADD) {
+        GetInstance()->AttachRequests(view);
+    }
+}
+
+void ImageDecodeService::Callback()
+{
+#if ENABLE_ASYNC_IMAGE_DECODE
+    List<DecodeRequest*> doneList;
+    pthread_mutex_lock(&lock_);
+    while (doneList_.Size() > 0) {
+        doneList.PushBack(doneList_.Begin()->data_);
+        doneList_.Remove(doneList_.Begin());
+    }
+    pthread_mutex_unlock(&lock_);
+
+    while (doneList.Size() > 0) {
+        DecodeRequest* request = doneList.Begin()->data_;
+        doneList.Remove(doneList.Begin());
+        if (request->listener != nullptr) {
+            request->listener->OnDecodeFinished(request->src, request->imgInfo, request->decodeShift);
+            request->imgInfo = nullptr;
+        }
+        FreeRequest(request);
+    }
+#endif
+}
+
+#if ENABLE_ASYNC_IMAGE_DECODE
+bool ImageDecodeService::StartWorkers()
+{
+    if (startedNum_ > 0) {
+        return true;
+    }
+    for (uint8_t i = 0; i < workerNum_; i++) {
+        if (pthread_create(&workers_[startedNum_], nullptr, WorkerMain, this) != 0) {
+            GRAPHIC_LOGE("ImageDecodeService create worker failed");
+            break;
+        }
+        startedNum_++;
+    }
+    if (startedNum_ == 0) {
+        return false;
+    }
+    UITreeManager::GetInstance().RegistViewLifeEvent(OnViewLifeEvent);
+    Task::Init();
+    return true;
+}
+
+void* ImageDecodeService::WorkerMain(void* arg)
+{
+    static_cast<ImageDecodeService*>(arg)->DecodeLoop();
+    return nullptr;
+}
+
+void ImageDecodeService::DecodeLoop()
+{
+    pthread_mutex_lock(&lock_);
+    while (!quit_) {
+        if (pendingList_.Size() == 0) {
+            pthread_cond_wait(&cond_, &lock_);
+            continue;
+        }
+        DecodeRequest* request = pendingList_.Begin()->data_;
+        pendingList_.Remove(pendingList_.Begin());
+        decodingList_.PushBack(request);
+        pthread_mutex_unlock(&lock_);
+
+        ImageInfo* imgInfo = nullptr;
+        uint8_t shift = 0;
+        if (Image::CheckImgType(request->src) == Image::IMG_PNG) {
+            imgInfo = Image::DecodePNG(request->src, request->size, shift);
+        } else {
+            imgInfo = Image::DecodeJPEG(request->src, request->size, shift);
+        }
+
+        pthread_mutex_lock(&lock_);
+        ListNode<DecodeRequest*>* node = decodingList_.Begin();
+        while (node != decodingList_.End()) {
+            if (node->data_ == request) {
+                decodingList_.Remove(node);
+                break;
+            }
+            node = node->next_;
+        }
+        request->imgInfo = imgInfo;
+        request->decodeShift = shift;
+        request->decoded = true;
+        if (request->listener == nullptr) {
+            FreeRequest(request);
+        } else if (request->detached) {
+            detachedList_.PushBack(request);
+        } else {
+            doneList_.PushBack(request);
+        }
+    }
+    pthread_mutex_unlock(&lock_);
+}
+#endif
+} // namespace OHOS
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_IMAGE_DECODE_SERVICE_H
+#define GRAPHIC_LITE_IMAGE_DECODE_SERVICE_H
+
+#include "common/image.h"
+#include "common/task.h"
+#include "components/ui_view.h"
+#include "gfx_utils/image_info.h"
+#include "gfx_utils/list.h"
+#include "graphic_config.h"
+#if defined __linux__ || defined __LITEOS__ || defined __APPLE__
+#include <pthread.h>
+#endif
+
+#if ENABLE_JPEG_AND_PNG && (defined __linux__ || defined __LITEOS__ || defined __APPLE__)
+#define ENABLE_ASYNC_IMAGE_DECODE 1
+#else
+#define ENABLE_ASYNC_IMAGE_DECODE 0
+#endif
+
+namespace OHOS {
+class ImageDecodeListener : public HeapBase {
+public:
+    virtual ~ImageDecodeListener() {}
+
+    /*
+     * Called on the UI thread when a request has been decoded. The listener takes over imgInfo, which is
+     * nullptr if decoding failed, and has been decoded at 1/(2^decodeShift) of the original size.
+     */
+    virtual void OnDecodeFinished(const char* src, ImageInfo* imgInfo, uint8_t decodeShift) = 0;
+};
+
+/*
+ * Decodes PNG and JPEG files on a pool of worker threads. Finished requests are handed back to their listeners
+ * from the task handler, so listeners are only ever called on the UI thread. The requests of a view removed from the
+ * tree are held back, neither decoded nor handed back, until the view is added to a parent again.
+ */
+class ImageDecodeService : public Task {
+public:
+    static ImageDecodeService* GetInstance();
+
+    /* Takes effect before the first request is submitted. */
+    void SetWorkerNum(uint8_t workerNum);
+
+    /*
+     * Submits a decode request, the file is decoded at the reduced size which still covers size. Returns false if
+     * the file can not be decoded asynchronously, in which case the caller is expected to decode it synchronously.
+     */
+    bool Decode(const char* src, ImageDecodeListener* listener, UIView* owner, const Image::DecodeSize& size);
+
+    /* Drops all requests of the listener, the listener is not called for them any more. */
+    void Cancel(const ImageDecodeListener* listener);
+
+    /* Checks whether the listener has requests which are not handed back yet, including the held back ones. */
+    bool IsPending(const ImageDecodeListener* listener);
+
+    void Callback() override;
+
+private:
+    static constexpr uint8_t DEFAULT_WORKER_NUM = 2;
+    static constexpr uint8_t MAX_WORKER_NUM = 4;
+
+    struct DecodeRequest : public HeapBase {
+        char* src;
+        ImageDecodeListener* listener;
+        UIView* owner;
+        ImageInfo* imgInfo;
+        Image::DecodeSize size;
+        uint8_t decodeShift;
+        bool decoded;
+        bool detached;
+    };
+
+    ImageDecodeService();
+    ~ImageDecodeService();
+
+    ImageDecodeService(const ImageDecodeService&) = delete;
+    ImageDecodeService& operator=(const ImageDecodeService&) = delete;
+    ImageDecodeService(ImageDecodeService&&) = delete;
+    ImageDecodeService& operator=(ImageDecodeService&&) = delete;
+
+    static void FreeRequest(DecodeRequest* request);
+    static void OnViewLifeEvent();
+    static bool IsDescendant(const UIView* view, const UIView* ancestor);
+    void CancelInList(List<DecodeRequest*>& list, const ImageDecodeListener* listener);
+    void CancelRequests(const ImageDecodeListener* listener);
+    void MoveRequests(List<DecodeRequest*>& from, List<DecodeRequest*>& to, const UIView* view, bool detached);
+    void DetachRequests(const UIView* view);
+    void AttachRequests(const UIView* view);
+
+#if ENABLE_ASYNC_IMAGE_DECODE
+    bool StartWorkers();
+    static void* WorkerMain(void* arg);
+    void DecodeLoop();
+
+    pthread_mutex_t lock_;
+    pthread_cond_t cond_;
+    pthread_t workers_[MAX_WORKER_NUM];
+#endif
+    List<DecodeRequest*> pendingList_;
+    List<DecodeRequest*> decodingList_;
+    List<DecodeRequest*> doneList_;
+    /* the requests of the views removed from the tree */
+    List<DecodeRequest*> detachedList_;
+    uint8_t workerNum_;
+    uint8_t startedNum_;
+    bool quit_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_IMAGE_DECODE_SERVICE_H
@@ -28,6 +28,8 @@ const uint32_t BITMAP_ALPHA_MASK = 0xFF000000;
 const uint32_t BITMAP_MAXCON_PIXNUM = 0xCB100;
 const uint32_t MOVE_HIGH = 16;
 const uint32_t MOVE_LOW = 8;
+const uint8_t RLE_RUN_FLAG = 0x80;
+const uint8_t RLE_COUNT_MASK = 0x7F;
 } // namespace
 
 namespace OHOS {
@@ -199,4 +201,40 @@ bool ImageLoad::GetImageInfo(int32_t fd, uint32_t size, ImageInfo& imageInfo)
     UIFree(buffer);
     return ret;
 }
+
+bool ImageLoad::DecodeRleRow(const uint8_t* row, uint32_t rowSize, uint8_t pxBytes, int16_t startX, int16_t len,
+                             uint8_t* buf)
+{
+    if ((row == nullptr) || (buf == nullptr) || (startX < 0) || (len <= 0)) {
+        return false;
+    }
+    const uint8_t* rowEnd = row + rowSize;
+    int32_t endX = startX + len;
+    int32_t x = 0;
+    while (x < endX) {
+        if (row >= rowEnd) {
+            return false;
+        }
+        bool isRun = (*row & RLE_RUN_FLAG) != 0;
+        int32_t count = (*row & RLE_COUNT_MASK) + 1;
+        row++;
+        uint32_t dataLen = isRun ? pxBytes : count * pxBytes;
+        if (dataLen > static_cast<uint32_t>(rowEnd - row)) {
+            return false;
+        }
+        /* only the pixels of the packet inside the requested range are copied */
+        int32_t from = (x > startX) ? x : startX;
+        int32_t to = (x + count < endX) ? (x + count) : endX;
+        for (int32_t px = from; px < to; px++) {
+            const uint8_t* src = isRun ? row : (row + (px - x) * pxBytes);
+            uint8_t* dst = buf + (px - startX) * pxBytes;
+            for (uint8_t i = 0; i < pxBytes; i++) {
+                dst[i] = src[i];
+            }
+        }
+        x += count;
+        row += dataLen;
+    }
+    return true;
+}
 } // namespace OHOS
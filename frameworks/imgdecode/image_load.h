@@ -24,12 +24,27 @@ enum CompressMode : uint8_t {
     COMPRESS_MODE__ZIP_ALG,
     COMPRESS_MODE_BITMAP_ALG,
     COMPRESS_MODE_BLOCK_ALG,
+    COMPRESS_MODE_ROW_RLE_ALG,
 };
 
+/*
+ * Layout of COMPRESS_MODE_ROW_RLE_ALG behind the image header:
+ *
+ *   uint32_t rowOffset[height + 1] | row 0 | row 1 | ...
+ *
+ * rowOffset is relative to the end of the offsets, so any row can be found without decoding the rows above it.
+ * A row is a list of packets, each starting with a byte: with the high bit set, one pixel repeated
+ * (byte & 0x7F) + 1 times follows; otherwise (byte + 1) literal pixels follow.
+ */
+
 class ImageLoad {
 public:
     static bool GetImageInfo(int32_t fd, uint32_t size, ImageInfo& imageInfo);
 
+    /* Decodes pixels [startX, startX + len) of a COMPRESS_MODE_ROW_RLE_ALG row. */
+    static bool DecodeRleRow(const uint8_t* row, uint32_t rowSize, uint8_t pxBytes, int16_t startX, int16_t len,
+                             uint8_t* buf);
+
 private:
     ImageLoad() = delete;
     ~ImageLoad() = delete;
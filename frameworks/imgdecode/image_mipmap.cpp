@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/image_mipmap.h"
+#include "gfx_utils/graphic_log.h"
+#include "gfx_utils/mem_api.h"
+
+namespace OHOS {
+namespace {
+constexpr uint8_t MIPMAP_PX_BYTES = 4; // 4: bytes per pixel of ARGB8888
+}
+
+ImageMipmap::~ImageMipmap()
+{
+    if (data_ != nullptr) {
+        UIFree(reinterpret_cast<void*>(data_));
+        data_ = nullptr;
+    }
+}
+
+ImageMipmap* ImageMipmap::Create(const ImageInfo& imgInfo)
+{
+    if ((imgInfo.data == nullptr) || (imgInfo.header.colorMode != ARGB8888)) {
+        return nullptr;
+    }
+    uint16_t width = imgInfo.header.width;
+    uint16_t height = imgInfo.header.height;
+    uint32_t dataSize = 0;
+    uint8_t levelNum = 0;
+    while ((levelNum < MAX_LEVEL_NUM) && ((width > 1) || (height > 1))) {
+        width = (width + 1) >> 1;
+        height = (height + 1) >> 1;
+        dataSize += static_cast<uint32_t>(width) * height * MIPMAP_PX_BYTES;
+        levelNum++;
+    }
+    if (levelNum == 0) {
+        return nullptr;
+    }
+
+    ImageMipmap* mipmap = new ImageMipmap();
+    if (mipmap == nullptr) {
+        GRAPHIC_LOGE("new ImageMipmap fail");
+        return nullptr;
+    }
+    mipmap->data_ = static_cast<uint8_t*>(UIMalloc(dataSize));
+    if (mipmap->data_ == nullptr) {
+        delete mipmap;
+        return nullptr;
+    }
+    mipmap->levelNum_ = levelNum;
+
+    const ImageInfo* prev = &imgInfo;
+    uint8_t* data = mipmap->data_;
+    for (uint8_t i = 0; i < levelNum; i++) {
+        ImageInfo& level = mipmap->levels_[i];
+        level.header = prev->header;
+        level.header.width = (prev->header.width + 1) >> 1;
+        level.header.height = (prev->header.height + 1) >> 1;
+        level.dataSize = static_cast<uint32_t>(level.header.width) * level.header.height * MIPMAP_PX_BYTES;
+        level.data = data;
+        Downsample(*prev, level);
+        data += level.dataSize;
+        prev = &level;
+    }
+    return mipmap;
+}
+
+void ImageMipmap::Downsample(const ImageInfo& src, ImageInfo& dst)
+{
+    uint16_t srcWidth = src.header.width;
+    uint16_t srcHeight = src.header.height;
+    uint32_t srcStride = static_cast<uint32_t>(srcWidth) * MIPMAP_PX_BYTES;
+    uint8_t* out = const_cast<uint8_t*>(dst.data);
+    for (uint16_t y = 0; y < dst.header.height; y++) {
+        const uint8_t* row0 = src.data + (y << 1) * srcStride;
+        /* the last row and column of an odd sized level are repeated */
+        const uint8_t* row1 = (((y << 1) + 1) < srcHeight) ? (row0 + srcStride) : row0;
+        for (uint16_t x = 0; x < dst.header.width; x++) {
+            uint32_t x0 = (x << 1) * MIPMAP_PX_BYTES;
+            uint32_t x1 = (((x << 1) + 1) < srcWidth) ? (x0 + MIPMAP_PX_BYTES) : x0;
+            for (uint8_t c = 0; c < MIPMAP_PX_BYTES; c++) {
+                // 2: rounding, 2: average of 4 pixels
+                out[c] = static_cast<uint8_t>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+            }
+            out += MIPMAP_PX_BYTES;
+        }
+    }
+}
+
+uint8_t ImageMipmap::SelectLevel(const TransformMap& transMap) const
+{
+    TransformMap map = transMap;
+    Matrix4<float> matrix = map.GetTransformMatrix();
+    Rect rect = map.GetTransMapRect();
+    Vector4<float> origin = matrix * Vector4<float>(rect.GetX(), rect.GetY(), 0, 1);
+    Vector4<float> axisX = matrix * Vector4<float>(rect.GetX() + 1, rect.GetY(), 0, 1);
+    Vector4<float> axisY = matrix * Vector4<float>(rect.GetX(), rect.GetY() + 1, 0, 1);
+    float dxX = axisX.x_ - origin.x_;
+    float dyX = axisX.y_ - origin.y_;
+    float dxY = axisY.x_ - origin.x_;
+    float dyY = axisY.y_ - origin.y_;
+    /* squared length of one source pixel on screen along the axis which shrinks the least */
+    float scaleX = dxX * dxX + dyX * dyX;
+    float scaleY = dxY * dxY + dyY * dyY;
+    float scale = (scaleX > scaleY) ? scaleX : scaleY;
+
+    uint8_t level = 0;
+    // 4: a level halves the scale, which is a quarter of the squared scale
+    while ((level < levelNum_) && (scale * 4 <= 1.0f)) {
+        scale *= 4; // 4: squared scale of the next level
+        level++;
+    }
+    return level;
+}
+
+bool ImageMipmap::Select(const TransformMap& transMap, ImageInfo& imgInfo, TransformMap& levelMap) const
+{
+    uint8_t level = SelectLevel(transMap);
+    if (level == 0) {
+        return false;
+    }
+    const ImageInfo& levelInfo = levels_[level - 1];
+    levelMap = transMap;
+    Rect rect = levelMap.GetTransMapRect();
+    float ratio = static_cast<float>(1 << level);
+    /* a pixel of the level covers (1 << level) pixels of the image, starting from the same origin */
+    Matrix4<float> matrix = levelMap.GetTransformMatrix() *
+        Matrix4<float>::Scale(Vector3<float>(ratio, ratio, 1.0f), Vector3<float>(rect.GetX(), rect.GetY(), 0));
+    levelMap.SetTransMapRect(Rect(rect.GetX(), rect.GetY(), rect.GetX() + levelInfo.header.width - 1,
+                                  rect.GetY() + levelInfo.header.height - 1));
+    levelMap.SetMatrix(matrix);
+    imgInfo = levelInfo;
+    return true;
+}
+} // namespace OHOS
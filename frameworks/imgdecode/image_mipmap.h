@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_IMAGE_MIPMAP_H
+#define GRAPHIC_LITE_IMAGE_MIPMAP_H
+
+#include "gfx_utils/heap_base.h"
+#include "gfx_utils/image_info.h"
+#include "gfx_utils/transform.h"
+
+namespace OHOS {
+/*
+ * Box filtered levels of an ARGB8888 image, each half the size of the previous one. A shrinking transform samples
+ * the level closest to its scale instead of the full image, which reads less memory and aliases less.
+ */
+class ImageMipmap : public HeapBase {
+public:
+    static constexpr uint8_t MAX_LEVEL_NUM = 3;
+
+    ~ImageMipmap();
+
+    /* Returns nullptr if the image is not ARGB8888 or is too small to have levels. */
+    static ImageMipmap* Create(const ImageInfo& imgInfo);
+
+    uint8_t GetLevelNum() const
+    {
+        return levelNum_;
+    }
+
+    /* Level 1 is half the size of the image. */
+    const ImageInfo* GetLevel(uint8_t level) const
+    {
+        return ((level == 0) || (level > levelNum_)) ? nullptr : &levels_[level - 1];
+    }
+
+    /* Returns the level which is still at least as large as the image drawn through transMap, 0 for the image. */
+    uint8_t SelectLevel(const TransformMap& transMap) const;
+
+    /*
+     * Replaces imgInfo and levelMap with the level selected for transMap and the transform which draws it in place
+     * of the image. Returns false if the image itself should be drawn.
+     */
+    bool Select(const TransformMap& transMap, ImageInfo& imgInfo, TransformMap& levelMap) const;
+
+private:
+    ImageMipmap() : levels_{}, data_(nullptr), levelNum_(0) {}
+
+    ImageMipmap(const ImageMipmap&) = delete;
+    ImageMipmap& operator=(const ImageMipmap&) = delete;
+    ImageMipmap(ImageMipmap&&) = delete;
+    ImageMipmap& operator=(ImageMipmap&&) = delete;
+
+    static void Downsample(const ImageInfo& src, ImageInfo& dst);
+
+    ImageInfo levels_[MAX_LEVEL_NUM];
+    uint8_t* data_;
+    uint8_t levelNum_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_IMAGE_MIPMAP_H
@@ -150,6 +150,7 @@ void WindowImpl::RaiseToTop()
     GRAPHIC_LOGI("RaiseToTop");
     if (iWindow_ != nullptr) {
         iWindow_->RaiseToTop();
+        RenderManager::GetInstance().RaiseToTop(this);
     }
 }
 
@@ -158,6 +159,7 @@ void WindowImpl::LowerToBottom()
     GRAPHIC_LOGI("LowerToBottom");
     if (iWindow_ != nullptr) {
         iWindow_->LowerToBottom();
+        RenderManager::GetInstance().LowerToBottom(this);
     }
 }
 
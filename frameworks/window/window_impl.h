@@ -51,6 +51,17 @@ public:
 
     BufferInfo* GetBufferInfo();
 
+    bool IsShow() const
+    {
+        return isShow_;
+    }
+
+    /* Whether the window hides the windows below it. */
+    bool IsOpaque() const
+    {
+        return (config_.compositeMode == WindowConfig::COPY) && (config_.opacity == OPA_OPAQUE);
+    }
+
 private:
     void UpdateHalDisplayBuffer();
 
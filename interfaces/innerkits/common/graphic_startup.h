@@ -26,6 +26,9 @@ public:
     static void Init();
 
     static void InitFontEngine(uintptr_t cacheMemAddr, uint32_t cacheMemLen, const char* dPath, const char* ttfName);
+    /* Sets the number of glyph metrics cached in the font memory, rounded up to a power of two. Call it before
+     * InitFontEngine, so the cache is allocated once. */
+    static void SetGlyphsCacheCapacity(uint32_t glyphNum);
     static void InitLineBreakEngine(uintptr_t cacheMemAddr, uint32_t cacheMemLen, const char* path,
                                     const char* fileName);
 };
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_VSYNC_SOURCE_H
+#define GRAPHIC_LITE_VSYNC_SOURCE_H
+
+#include <cstdint>
+
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/**
+ * @brief The vsync signal the frames are paced to, implemented by the display driver.
+ */
+class VsyncSource : public HeapBase {
+public:
+    virtual ~VsyncSource() {}
+
+    /**
+     * @brief Get the period of the vsync signal.
+     *
+     * @returns The period in microseconds
+     */
+    virtual uint32_t GetPeriod() const = 0;
+
+    /**
+     * @brief Get the time of the last vsync signal, which must not be later than the current time.
+     *
+     * @returns The time in microseconds, on the clock of GetTime
+     */
+    virtual uint64_t GetLastVsyncTime() = 0;
+
+    /**
+     * @brief Get the current time of the monotonic clock the frames are timed with.
+     *
+     * @returns The time in microseconds
+     */
+    static uint64_t GetTime();
+};
+
+/**
+ * @brief A vsync signal generated from the clock, for the displays which do not report theirs.
+ */
+class TimerVsyncSource : public VsyncSource {
+public:
+    explicit TimerVsyncSource(uint32_t period = DEFAULT_PERIOD);
+    ~TimerVsyncSource() {}
+
+    uint32_t GetPeriod() const override
+    {
+        return period_;
+    }
+
+    uint64_t GetLastVsyncTime() override;
+
+    static constexpr uint32_t DEFAULT_PERIOD = 16667; // 16667: 60 Hz in microseconds
+
+private:
+    uint32_t period_;
+    uint64_t startTime_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_VSYNC_SOURCE_H
@@ -33,6 +33,8 @@ enum : uint8_t {
     FOCUS_DIRECTION_DOWN,
 };
 
+class FocusIndex;
+
 class FocusManager {
 public:
     /**
@@ -85,9 +87,53 @@ public:
      */
     bool RequestFocusByDirection(uint8_t direction);
 
+    /**
+     * @brief Marks the index of the focusable views out of date if the view is in it. Called by the views when the
+     *        view tree or the geometry of a view changes, the index is built again by the next request by direction.
+     *
+     * @param view  Indicates the view which changes.
+     * @param moved Specifies whether only the position of the view changes. The moves of the children of a view group
+     *              between {@link BeginMoveChildren} and {@link EndMoveChildren} are applied to the index when the
+     *              move ends.
+     * @since 6.0
+     * @version 6.0
+     */
+    static void InvalidateIndex(const UIView* view, bool moved = false);
+
+    /**
+     * @brief Called before the children of a view group are moved, as a scroll does.
+     *
+     * @param viewGroup Indicates the view group whose children are moved.
+     * @since 6.0
+     * @version 6.0
+     */
+    static void BeginMoveChildren(const UIView* viewGroup);
+
+    /**
+     * @brief Called after the children of a view group are moved. The rects of the views under the view group are
+     *        updated in the index of the focusable views instead of building it again.
+     *
+     * @param viewGroup Indicates the view group whose children are moved.
+     * @since 6.0
+     * @version 6.0
+     */
+    static void EndMoveChildren(const UIView* viewGroup);
+
+    /**
+     * @brief Obtains how many times the index of the focusable views has been built.
+     *
+     * @return Returns the number of index builds.
+     * @since 6.0
+     * @version 6.0
+     */
+    static uint32_t GetIndexBuildNum()
+    {
+        return indexBuildNum_;
+    }
+
 private:
     FocusManager() : focusView_(nullptr), lastFocusView_(nullptr) {}
-    ~FocusManager() {}
+    ~FocusManager();
 
     bool GetNextFocus(UIView* focusedView, UIView*& candidate, uint8_t direction);
     bool GetNextFocus(UIView* focusedView, UIView*& candidate, UIView* view, uint8_t direction);
@@ -103,6 +149,11 @@ private:
 
     UIView* focusView_;
     UIView* lastFocusView_;
+    /* static, so the views destroyed at exit can still check the index */
+    static FocusIndex* index_;
+    static bool indexDirty_;
+    static const UIView* movingGroup_;
+    static uint32_t indexBuildNum_;
 };
 } // namespace OHOS
 #endif
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHIC_LITE_RECORDING_ENGINE_H
+#define GRAPHIC_LITE_RECORDING_ENGINE_H
+
+#include "graphic_config.h"
+#if ENABLE_DEBUG
+#include <map>
+#include "engines/gfx/gfx_engine_manager.h"
+
+namespace OHOS {
+/*
+ * Forwards every call to another engine and, while recording, writes the calls of a range of frames to a file
+ * which GfxReplayer re-executes. Install it in front of the engine in use:
+ *
+ *   BaseGfxEngine::InitGfxEngine(new RecordingEngine(BaseGfxEngine::GetInstance()));
+ *
+ * A frame ends with Flush, so Start is called between two frames. Start, Stop and the engine calls must come from
+ * the render thread. The canvas paths of DrawPath and FillPath are not recorded, only their area and
+ * duration.
+ */
+class RecordingEngine : public BaseGfxEngine {
+public:
+    explicit RecordingEngine(BaseGfxEngine* target);
+    ~RecordingEngine();
+
+    /* Records the next frameNum frames into path, or the frames until Stop if frameNum is 0. */
+    bool Start(const char* path, uint32_t frameNum);
+    void Stop();
+
+    bool IsRecording() const
+    {
+        return (fd_ >= 0);
+    }
+
+    /* Frames written since Start. */
+    uint32_t GetFrameCount() const
+    {
+        return frameCount_;
+    }
+
+    void DrawArc(BufferInfo& dst,
+                 ArcInfo& arcInfo,
+                 const Rect& mask,
+                 const Style& style,
+                 OpacityType opacity,
+                 uint8_t cap) override;
+
+    void MemoryBarrier() override
+    {
+        target_->MemoryBarrier();
+    }
+
+    void DrawLine(BufferInfo& dst,
+                  const Point& start,
+                  const Point& end,
+                  const Rect& mask,
+                  int16_t width,
+                  ColorType color,
+                  OpacityType opacity) override;
+
+    void DrawLetter(BufferInfo& gfxDstBuffer,
+                    const uint8_t* fontMap,
+                    const Rect& fontRect,
+                    const Rect& subRect,
+                    const uint8_t fontWeight,
+                    const ColorType& color,
+                    const OpacityType opa) override;
+
+    void DrawCubicBezier(BufferInfo& dst,
+                         const Point& start,
+                         const Point& control1,
+                         const Point& control2,
+                         const Point& end,
+                         const Rect& mask,
+                         int16_t width,
+                         ColorType color,
+                         OpacityType opacity) override;
+
+    void DrawRect(BufferInfo& dst,
+                  const Rect& rect,
+                  const Rect& dirtyRect,
+                  const Style& style,
+                  OpacityType opacity) override;
+
+    void DrawTransform(BufferInfo& dst,
+                       const Rect& mask,
+                       const Point& position,
+                       ColorType color,
+                       OpacityType opacity,
+                       const TransformMap& transMap,
+                       const TransformDataInfo& dataInfo) override;
+
+    void ClipCircle(const ImageInfo* info, float x, float y, float radius) override
+    {
+        target_->ClipCircle(info, x, y, radius);
+    }
+
+    void Blit(BufferInfo& dst,
+              const Point& dstPos,
+              const BufferInfo& src,
+              const Rect& subRect,
+              const BlendOption& blendOption) override;
+
+    void Fill(BufferInfo& dst, const Rect& fillArea, const ColorType color, const OpacityType opacity) override;
+
+    void DrawPath(BufferInfo& dst,
+                  void* param,
+                  const Paint& paint,
+                  const Rect& rect,
+                  const Rect& invalidatedArea,
+                  const Style& style) override;
+
+    void FillPath(BufferInfo& dst,
+                  void* param,
+                  const Paint& paint,
+                  const Rect& rect,
+                  const Rect& invalidatedArea,
+                  const Style& style) override;
+
+    uint8_t* AllocBuffer(uint32_t size, uint32_t usage) override
+    {
+        return target_->AllocBuffer(size, usage);
+    }
+
+    void FreeBuffer(uint8_t* buffer, uint32_t usage) override
+    {
+        target_->FreeBuffer(buffer, usage);
+    }
+
+    BufferInfo* GetFBBufferInfo() override
+    {
+        return target_->GetFBBufferInfo();
+    }
+
+    void AdjustLineStride(BufferInfo& info) override
+    {
+        target_->AdjustLineStride(info);
+    }
+
+    void Flush(const Rect& flushRect) override;
+
+    uint16_t GetScreenWidth() override
+    {
+        return target_->GetScreenWidth();
+    }
+
+    uint16_t GetScreenHeight() override
+    {
+        return target_->GetScreenHeight();
+    }
+
+    void SetScreenShape(ScreenShape screenShape) override
+    {
+        target_->SetScreenShape(screenShape);
+    }
+
+    ScreenShape GetScreenShape() override
+    {
+        return target_->GetScreenShape();
+    }
+
+private:
+    static constexpr uint16_t STAGING_SIZE = 4096;
+
+    struct TargetKey {
+        const void* addr;
+        uint32_t stride;
+        uint16_t width;
+        uint16_t height;
+        int16_t left;
+        int16_t top;
+        uint8_t mode;
+
+        bool operator<(const TargetKey& other) const;
+    };
+
+    uint16_t GetTargetId(const BufferInfo& dst);
+    uint32_t GetDataId(const uint8_t* data, uint32_t size);
+    static uint32_t GetDuration(uint64_t startTime);
+    void WriteCall(uint8_t op, const BufferInfo& dst, uint32_t duration, const void* payload, uint32_t size);
+    void WriteHeader(uint8_t op, uint16_t target, uint32_t size, uint32_t duration);
+    void Write(const void* data, uint32_t size);
+    void FlushStaging();
+
+    BaseGfxEngine* target_;
+    int32_t fd_;
+    bool error_;
+    uint32_t frameNum_;
+    uint32_t frameCount_;
+    uint32_t used_;
+    std::map<TargetKey, uint16_t> targets_;
+    std::map<uint64_t, uint32_t> data_;
+    uint8_t staging_[STAGING_SIZE];
+};
+} // namespace OHOS
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_RECORDING_ENGINE_H
@@ -36,6 +36,8 @@ public:
     uint16_t GetFontId(const char* ttfName, uint8_t fontSize = 0) const override;
     int16_t GetWidth(uint32_t unicode, uint16_t fontId, uint8_t fontSize = 0) override;
     uint8_t* GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize = 0) override;
+    uint8_t* PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize = 0) override;
+    void UnpinBitmap(uint8_t* bitmap) override;
     int8_t GetFontHeader(FontHeader& fontHeader, uint16_t fontId, uint8_t fontSize = 0) override;
     int8_t GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize = 0) override;
     int8_t GetGlyphNodeFromFile(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId);
@@ -59,7 +61,8 @@ protected:
     GraphicMutex lock_;
 
 private:
-    uint8_t* SearchInFont(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId);
+    uint8_t* SearchInFont(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, bool pin);
+    uint8_t* GetMappedBitmap(const GlyphNode& glyphNode, ColorMode mode);
     int16_t GetWidthInFontId(uint32_t unicode, uint16_t fontId);
 #if defined(ENABLE_MULTI_FONT) && ENABLE_MULTI_FONT
     int8_t GetMultiGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId);
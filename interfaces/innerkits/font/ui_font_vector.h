@@ -20,6 +20,7 @@
 #include "ft2build.h"
 #include "freetype/freetype.h"
 #include "freetype/tttables.h"
+#include "font/glyph_rasterizer.h"
 #include "font/glyphs_cache.h"
 #include "font/ui_font_cache.h"
 #include <memory>
@@ -38,6 +39,8 @@ public:
     uint16_t GetFontId(const char* ttfName, uint8_t fontSize = 0) const override;
     int16_t GetWidth(uint32_t unicode, uint16_t fontId, uint8_t fontSize) override;
     uint8_t* GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize) override;
+    uint8_t* PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize) override;
+    void UnpinBitmap(uint8_t* bitmap) override;
     int8_t GetFontHeader(FontHeader& fontHeader, uint16_t fontId, uint8_t fontSize) override;
     int8_t GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize) override;
     uint8_t GetFontWeight(uint16_t fontId) override;
@@ -60,6 +63,9 @@ public:
     void SetPsramMemory(uintptr_t psramAddr, uint32_t psramLen) override;
     int8_t SetCurrentLangId(uint8_t langId) override;
     bool IsEmojiFont(uint16_t fontId) override;
+    int32_t PreloadGlyphs(const uint32_t* unicodes, uint32_t num, uint16_t fontId, uint8_t fontSize,
+                          uint8_t threadNum) override;
+    int8_t SetGlyphCacheDir(const char* dir) override;
 
 private:
     static constexpr uint8_t FONT_ID_MAX = 0xFF;
@@ -68,6 +74,7 @@ private:
     static constexpr uint8_t TTF_NAME_LEN_MAX = 128;
     UITextLanguageFontParam fontInfo_[FONT_ID_MAX] = {{}};
     std::string ttfDir_;
+    std::string glyphCacheDir_;
     FT_Library ftLibrary_;
     FT_Face ftFaces_[FONT_ID_MAX] = {0};
     uint8_t fontSize_[FONT_ID_MAX] = {0};
@@ -92,7 +99,13 @@ private:
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     int8_t LoadGlyphIntoFace(uint16_t& fontId, uint32_t unicode, FT_Face face, TextStyle textStyle);
 #endif
-    void SaveGlyphNode(uint32_t unicode, uint16_t fontKey, Metric* metric);
+    uint8_t* SearchBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, bool pin);
+    uint8_t* GetCacheBitmap(uint16_t fontKey, uint32_t unicode, const GlyphNode& glyphNode, bool pin);
+    void SaveGlyphNode(uint32_t unicode, uint16_t fontKey, const Metric* metric,
+                       TextStyle textStyle = TEXT_STYLE_NORMAL);
+    bool PutBitmapCache(uint16_t fontKey, uint32_t unicode, const Metric& metric, const uint8_t* buffer,
+                        ColorMode mode);
+    bool GetFontFace(uint16_t fontId, uint8_t fontSize, std::string& path, GlyphRasterizer::FontFace& font);
     uint8_t IsGlyphFont(uint32_t unicode);
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     void SetItaly(FT_GlyphSlot slot);
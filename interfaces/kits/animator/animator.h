@@ -112,7 +112,8 @@ public:
      * @version 1.0
      */
     Animator()
-        : callback_(nullptr), view_(nullptr), state_(STOP), period_(0), repeat_(false), runTime_(0), lastRunTime_(0)
+        : callback_(nullptr), view_(nullptr), state_(STOP), period_(0), repeat_(false), runTime_(0), lastRunTime_(0),
+          slot_(INVALID_SLOT)
     {
     }
 
@@ -130,7 +131,8 @@ public:
      * @version 1.0
      */
     Animator(AnimatorCallback* callback, UIView* view, uint32_t time, bool repeat)
-        : callback_(callback), view_(view), state_(STOP), period_(time), repeat_(repeat), runTime_(0), lastRunTime_(0)
+        : callback_(callback), view_(view), state_(STOP), period_(time), repeat_(repeat), runTime_(0), lastRunTime_(0),
+          slot_(INVALID_SLOT)
     {
     }
 
@@ -271,6 +273,15 @@ public:
 
     void Run();
 
+    /**
+     * @brief Advances this animator to the given time, which is sampled once per frame by the animator manager.
+     *
+     * @param curTime Indicates the current time, in milliseconds.
+     * @since 1.0
+     * @version 1.0
+     */
+    void Run(uint32_t curTime);
+
 protected:
     AnimatorCallback* callback_;
     UIView* view_;
@@ -279,6 +290,13 @@ protected:
     bool repeat_;
     uint32_t runTime_;
     uint32_t lastRunTime_;
+
+private:
+    friend class AnimatorManager;
+    static constexpr uint16_t INVALID_SLOT = UINT16_MAX;
+
+    /* index in the animator array of the AnimatorManager, INVALID_SLOT if the animator is not added */
+    uint16_t slot_;
 };
 } // namespace OHOS
 #endif
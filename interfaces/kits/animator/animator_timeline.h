@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_Animator
+ * @{
+ *
+ * @brief Defines UI animation effects and provides matched curves.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file animator_timeline.h
+ *
+ * @brief Defines the animation timeline, which drives view property animations in batches.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+#ifndef GRAPHIC_LITE_ANIMATOR_TIMELINE_H
+#define GRAPHIC_LITE_ANIMATOR_TIMELINE_H
+
+#include "animator/animator.h"
+#include "animator/easing_equation.h"
+#include "gfx_utils/vector.h"
+
+namespace OHOS {
+/**
+ * @brief Represents the animation timeline.
+ *
+ * This is a singleton class driven by the <b>AnimatorManager</b>. Each animated view property is stored as a track
+ * in contiguous arrays. On each frame the easing of all tracks is evaluated in one pass through fixed-point lookup
+ * tables, and the results are then applied to the views with one invalidation per affected view.
+ *
+ * @see AnimatorManager
+ * @since 1.0
+ * @version 1.0
+ */
+class AnimatorTimeline : public HeapBase {
+public:
+    /**
+     * @brief Enumerates the view properties that can be animated.
+     */
+    enum Property : uint8_t {
+        /** X coordinate */
+        PROPERTY_X,
+        /** Y coordinate */
+        PROPERTY_Y,
+        /** Width */
+        PROPERTY_WIDTH,
+        /** Height */
+        PROPERTY_HEIGHT,
+        /** Opacity scale */
+        PROPERTY_OPA_SCALE,
+        PROPERTY_MAX
+    };
+
+    /** Indicates an invalid track ID. */
+    static constexpr int16_t INVALID_TRACK_ID = -1;
+
+    /**
+     * @brief Obtains the <b>AnimatorTimeline</b> instance.
+     *
+     * @return Returns the <b>AnimatorTimeline</b> instance.
+     * @since 1.0
+     * @version 1.0
+     */
+    static AnimatorTimeline* GetInstance();
+
+    /**
+     * @brief Adds a track which animates one property of a view and starts it immediately.
+     *
+     * The easing curve is sampled once into a lookup table the first time it is used. As a result,
+     * {@link EasingEquation::SetBackOvershoot} does not affect back easing curves which are already in use.
+     *
+     * @param view     Indicates the view to animate.
+     * @param property Indicates the property to animate. For details, see {@link Property}.
+     * @param startPos Indicates the start value of the property.
+     * @param endPos   Indicates the end value of the property.
+     * @param time     Indicates the duration of the track, in milliseconds.
+     * @param easing   Indicates the easing function, for example, {@link EasingEquation::CubicEaseOut}.
+     * @param repeat   Specifies whether to repeat the track.
+     * @param callback Indicates the callback whose <b>OnStop</b> is called when the track finishes. Can be null.
+     *
+     * @return Returns the track ID; returns {@link INVALID_TRACK_ID} if the track fails to be added.
+     * @see RemoveTrack
+     * @since 1.0
+     * @version 1.0
+     */
+    int16_t AddTrack(UIView* view,
+                     uint8_t property,
+                     int16_t startPos,
+                     int16_t endPos,
+                     uint16_t time,
+                     EasingFunc easing,
+                     bool repeat = false,
+                     AnimatorCallback* callback = nullptr);
+
+    /**
+     * @brief Removes a track without calling its stop callback. The property keeps its current value.
+     *
+     * @param trackId Indicates the track ID returned by {@link AddTrack}.
+     * @since 1.0
+     * @version 1.0
+     */
+    void RemoveTrack(int16_t trackId);
+
+    /**
+     * @brief Removes all tracks of a view. This is called when the view is destroyed.
+     *
+     * @param view Indicates the view whose tracks are removed.
+     * @since 1.0
+     * @version 1.0
+     */
+    void RemoveTracks(const UIView* view);
+
+    /**
+     * @brief Checks whether a track is still running.
+     *
+     * @param trackId Indicates the track ID returned by {@link AddTrack}.
+     * @return Returns <b>true</b> if the track is running; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool IsTrackRunning(int16_t trackId) const;
+
+    /**
+     * @brief Obtains the number of running tracks.
+     *
+     * @return Returns the number of running tracks.
+     * @since 1.0
+     * @version 1.0
+     */
+    uint16_t GetTrackNum() const
+    {
+        return states_.Size();
+    }
+
+    /**
+     * @brief Advances all tracks to the current time. This is called by the <b>AnimatorManager</b> once per frame.
+     *
+     * @since 1.0
+     * @version 1.0
+     */
+    void Update();
+
+    /**
+     * @brief Advances all tracks by the given time.
+     *
+     * @param elapse Indicates the elapsed time since the last update, in milliseconds.
+     * @since 1.0
+     * @version 1.0
+     */
+    void Update(uint32_t elapse);
+
+private:
+    static constexpr uint16_t EASING_LUT_SIZE = 256;
+    static constexpr uint8_t EASING_LUT_SHIFT = 8;
+    static constexpr uint8_t PROGRESS_SHIFT = 16;
+    static constexpr uint8_t MAX_EASING_NUM = 16;
+    static constexpr uint8_t FLAG_REPEAT = 0x01;
+    static constexpr uint8_t FLAG_FINISHED = 0x02;
+
+    /* Hot per-frame state, walked linearly by the batch easing pass. */
+    struct TrackState {
+        uint32_t elapse;
+        uint32_t invTime;
+        uint16_t time;
+        int16_t startPos;
+        int32_t delta;
+        uint8_t easingIndex;
+        uint8_t flags;
+    };
+
+    /* Cold state, only touched when the results are applied. */
+    struct TrackTarget {
+        UIView* view;
+        AnimatorCallback* callback;
+        int16_t id;
+        uint8_t property;
+    };
+
+    struct EasingTable {
+        EasingFunc func;
+        int16_t* lut;
+    };
+
+    AnimatorTimeline() : easingNum_(0), nextId_(0), lastRunTime_(0) {}
+    ~AnimatorTimeline();
+
+    AnimatorTimeline(const AnimatorTimeline&) = delete;
+    AnimatorTimeline& operator=(const AnimatorTimeline&) = delete;
+    AnimatorTimeline(AnimatorTimeline&&) = delete;
+    AnimatorTimeline& operator=(AnimatorTimeline&&) = delete;
+
+    int16_t GetEasingIndex(EasingFunc easing);
+    int16_t FindTrack(int16_t trackId) const;
+    int16_t GetNextId();
+    uint16_t GetInsertPosition(const UIView* view) const;
+    void EvaluateTracks(uint32_t elapse);
+    void ApplyTracks();
+    void CompactTracks(Graphic::Vector<TrackTarget>& finished);
+    void EraseTrack(uint16_t index);
+    static void ApplyProperty(UIView* view, uint8_t property, int16_t value);
+
+    Graphic::Vector<TrackState> states_;
+    Graphic::Vector<TrackTarget> targets_;
+    Graphic::Vector<int16_t> values_;
+    /* finished tracks whose stop callbacks are pending in the current update */
+    Graphic::Vector<TrackTarget> finished_;
+    EasingTable easingTables_[MAX_EASING_NUM];
+    uint8_t easingNum_;
+    int16_t nextId_;
+    uint32_t lastRunTime_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_ANIMATOR_TIMELINE_H
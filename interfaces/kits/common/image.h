@@ -42,6 +42,8 @@
 #include "gfx_utils/style.h"
 
 namespace OHOS {
+class ImageMipmap;
+
 /**
  * @brief Represents basic image attributes, including the image type and path.
  *
@@ -50,6 +52,22 @@ namespace OHOS {
  */
 class Image : public HeapBase {
 public:
+    /**
+     * @brief Describes the size at which a PNG or JPEG file is displayed, so that it can be decoded at a reduced
+     * size.
+     *
+     * @since 1.0
+     * @version 1.0
+     */
+    struct DecodeSize {
+        /** Target width. <b>0</b> indicates that the file is decoded at its original size. */
+        uint16_t width;
+        /** Target height. <b>0</b> indicates that the file is decoded at its original size. */
+        uint16_t height;
+        /** Whether it is enough for either side to reach the target size, which is the case for scaling to fit. */
+        bool fitInside;
+    };
+
     /**
      * @brief A constructor used to create an <b>Image</b> instance. You can use this constructor when a component
      * requires a map.
@@ -143,6 +161,65 @@ public:
      */
     bool PreParse(const char* src);
 
+    /**
+     * @brief Sets an image which has already been decoded from a file.
+     *
+     * The <b>Image</b> takes over <b>imgInfo</b> and its pixel data, which must both be allocated by <b>UIMalloc</b>.
+     *
+     * @param src     Indicates the path of the decoded file.
+     * @param imgInfo Indicates the pointer to the decoded image information.
+     * @param decodeShift Indicates that the file has been decoded at 1/(2^decodeShift) of its original size.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> if the operation fails.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool SetDecodedSrc(const char* src, ImageInfo* imgInfo, uint8_t decodeShift = 0);
+
+    /**
+     * @brief Sets the size at which the PNG or JPEG file is displayed.
+     *
+     * A file set afterwards is decoded at the smallest size, down to 1/8 of the original width and height, that
+     * still covers <b>size</b>.
+     *
+     * @param size Indicates the display size. For details, see {@link DecodeSize}.
+     * @since 1.0
+     * @version 1.0
+     */
+    void SetDecodeSize(const DecodeSize& size)
+    {
+        decodeSize_ = size;
+    }
+
+    /**
+     * @brief Obtains the size at which the PNG or JPEG file is displayed.
+     *
+     * @return Returns the display size. For details, see {@link DecodeSize}.
+     * @since 1.0
+     * @version 1.0
+     */
+    const DecodeSize& GetDecodeSize() const
+    {
+        return decodeSize_;
+    }
+
+    /**
+     * @brief Decodes the file again if the current image has been decoded too small for the display size.
+     *
+     * @return Returns <b>true</b> if the image is decoded again; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool ReDecode();
+
+    /**
+     * @brief Obtains the mip levels of the image information, which are created on first use.
+     *
+     * @return Returns the mip levels; returns <b>nullptr</b> if the image has no image information in ARGB8888.
+     * @since 1.0
+     * @version 1.0
+     */
+    const ImageMipmap* GetMipmap() const;
+
     void DrawImage(BufferInfo& gfxDstBuffer,
                    const Rect& coords,
                    const Rect& mask,
@@ -165,12 +242,21 @@ private:
 #endif
     uint8_t srcType_;
     bool mallocFlag_;
+    uint8_t decodeShift_;
+    DecodeSize decodeSize_;
+    mutable ImageMipmap* mipmap_;
     bool SetLiteSrc(const char* src);
     bool SetStandardSrc(const char* src);
 #if ENABLE_JPEG_AND_PNG
+    friend class ImageDecodeService;
     bool SetPNGSrc(const char* src);
     bool SetJPEGSrc(const char* src);
-    ImageType CheckImgType(const char* src);
+    static constexpr uint8_t MAX_DECODE_SHIFT = 3; // 3: the IDCT of libjpeg scales down to 1/8 at most
+    static ImageType CheckImgType(const char* src);
+    static uint8_t GetDecodeShift(uint32_t width, uint32_t height, const DecodeSize& size);
+    static ImageInfo* DecodePNG(const char* src, const DecodeSize& size, uint8_t& shift);
+    static ImageInfo* DecodeJPEG(const char* src, const DecodeSize& size, uint8_t& shift);
+    static void FreeDecodedImageInfo(ImageInfo* imgInfo);
 #endif
     bool IsImgValid(const char* suffix)
     {
@@ -126,6 +126,7 @@ struct SizeSpan {
 };
 
 struct LabelLineInfo;
+class DecodedText;
 
 /**
  * @brief Represents the base class of <b>Text</b>, providing the text attribute setting and text drawing
@@ -515,6 +516,8 @@ protected:
                                        SizeSpan* sizeSpans);
     uint16_t GetSpanFontIdBySize(uint8_t size);
     void InitSizeSpans();
+    DecodedText* GetDecodedText() const;
+    uint32_t GetLetterNum();
 #if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
     TextStyle* textStyles_;
 #endif
@@ -532,6 +535,7 @@ protected:
     List<LineBackgroundColor> linebackgroundColor_;
     SizeSpan* sizeSpans_;
     uint32_t characterSize_;
+    DecodedText* decodedText_; // the letters of text_, decoded once it is set
 
 private:
     uint8_t horizontalAlign_ : 4; // UITextLanguageAlignment
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_Common
+ * @{
+ *
+ * @brief Defines common UI capabilities, such as image and text processing.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ui_arena.h
+ *
+ * @brief Declares the arena allocators of the graphics module: the <b>UIArena</b> class, which keeps the objects
+ *        created for a page in a few large pages of memory, and the <b>UIFrameAllocator</b> class, which hands out
+ *        the temporary buffers used while a frame is rendered.
+ *
+ * @since 6.0
+ * @version 6.0
+ */
+
+#ifndef GRAPHIC_LITE_UI_ARENA_H
+#define GRAPHIC_LITE_UI_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+/**
+ * @brief Allocates the objects of a page from large pages of memory instead of one heap block for each object.
+ *
+ * An arena is made current with a {@link Scope}. The objects derived from {@link UIArenaObject} and the views created
+ * as {@link UIArenaView} while it is current are allocated from its pages, and deleting them gives the memory back to
+ * the arena. The other objects are not affected.
+ * A page whose objects are all deleted is reused, so building and tearing down a page does not fragment the heap.
+ * The objects created while no arena is current are allocated with <b>UIMalloc</b> as before.
+ *
+ * The arena must only be used on the UI thread. It may be destroyed before its objects, the pages still in use are
+ * then freed when their last object is deleted.
+ *
+ * @since 6.0
+ * @version 6.0
+ */
+class UIArena : public HeapBase {
+public:
+    /**
+     * @brief Stores the allocation counters of an arena.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    struct Stats {
+        /** Objects allocated from the arena */
+        uint32_t allocNum;
+        /** Objects given back to the arena */
+        uint32_t freeNum;
+        /** Objects allocated and not given back yet */
+        uint32_t liveNum;
+        /** Pages held by the arena */
+        uint32_t pageNum;
+        /** Bytes of the objects allocated and not given back yet */
+        uint32_t usedBytes;
+        /** Bytes of the pages held by the arena */
+        uint32_t reservedBytes;
+        /** Objects allocated with <b>UIMalloc</b> because a new page could not be allocated */
+        uint32_t fallbackNum;
+    };
+
+    /**
+     * @brief Makes an arena current until the scope ends, and the arena current before it current again then.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    class Scope : public HeapBase {
+    public:
+        /**
+         * @brief A constructor used to make an arena current.
+         *
+         * @param arena Indicates the arena to make current, <b>nullptr</b> to allocate with <b>UIMalloc</b>.
+         * @since 6.0
+         * @version 6.0
+         */
+        explicit Scope(UIArena* arena) : last_(current_)
+        {
+            current_ = arena;
+        }
+
+        /**
+         * @brief A destructor used to make the arena current before the scope current again.
+         *
+         * @since 6.0
+         * @version 6.0
+         */
+        ~Scope()
+        {
+            current_ = last_;
+        }
+
+    private:
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        UIArena* last_;
+    };
+
+    /**
+     * @brief A constructor used to create an arena.
+     *
+     * @param pageSize Indicates the size of the pages in bytes. Larger objects get a page of their own.
+     * @since 6.0
+     * @version 6.0
+     */
+    explicit UIArena(uint32_t pageSize = DEFAULT_PAGE_SIZE);
+
+    /**
+     * @brief A destructor used to free the pages not in use anymore.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    ~UIArena();
+
+    /**
+     * @brief Allocates memory from the current arena, or with <b>UIMalloc</b> if no arena is current.
+     *
+     * @param size Indicates the size of the memory in bytes.
+     * @return Returns the memory, which is given back with {@link Free}, or <b>nullptr</b> on failure.
+     * @since 6.0
+     * @version 6.0
+     */
+    static void* Allocate(size_t size);
+
+    /**
+     * @brief Gives back memory allocated by {@link Allocate}, to its arena if it came from one.
+     *
+     * @param ptr Indicates the memory to give back.
+     * @since 6.0
+     * @version 6.0
+     */
+    static void Free(void* ptr);
+
+    /**
+     * @brief Obtains the current arena.
+     *
+     * @return Returns the current arena, or <b>nullptr</b> if no arena is current.
+     * @since 6.0
+     * @version 6.0
+     */
+    static UIArena* GetCurrent()
+    {
+        return current_;
+    }
+
+    /**
+     * @brief Frees the pages of the arena which hold no object, so the memory can be used by others.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void ReleaseFreePages();
+
+    /**
+     * @brief Obtains the allocation counters of the arena.
+     *
+     * @return Returns the allocation counters.
+     * @since 6.0
+     * @version 6.0
+     */
+    const Stats& GetStats() const
+    {
+        return stats_;
+    }
+
+    /**
+     * @brief Clears the counters of the objects allocated and given back, the others describe the current state.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void ClearStats()
+    {
+        stats_.allocNum = 0;
+        stats_.freeNum = 0;
+        stats_.fallbackNum = 0;
+    }
+
+    /** Default size of the pages in bytes */
+    static constexpr uint32_t DEFAULT_PAGE_SIZE = 4096;
+
+private:
+    struct Page;
+
+    UIArena(const UIArena&) = delete;
+    UIArena& operator=(const UIArena&) = delete;
+    UIArena(UIArena&&) = delete;
+    UIArena& operator=(UIArena&&) = delete;
+
+    void* AllocateBlock(uint32_t size);
+    Page* GetPage(uint32_t size);
+    void FreeBlock(Page* page, uint32_t size);
+
+    static UIArena* current_;
+    Page* pages_;
+    uint32_t pageSize_;
+    Stats stats_;
+};
+
+/**
+ * @brief Represents the base class of the objects allocated from the current {@link UIArena}.
+ *
+ * @since 6.0
+ * @version 6.0
+ */
+class UIArenaObject : public HeapBase {
+public:
+    static void* operator new(size_t size)
+    {
+        return UIArena::Allocate(size);
+    }
+
+    static void* operator new[](size_t size)
+    {
+        return UIArena::Allocate(size);
+    }
+
+    static void* operator new(size_t, void* ptr)
+    {
+        return ptr;
+    }
+
+    static void operator delete(void* ptr)
+    {
+        UIArena::Free(ptr);
+    }
+
+    static void operator delete[](void* ptr)
+    {
+        UIArena::Free(ptr);
+    }
+
+    static void operator delete(void*, void*) {}
+};
+
+/**
+ * @brief Creates a view of the type <b>View</b> from the current {@link UIArena}, for instance
+ *        <b>new UIArenaView<UILabel>()</b>. The views created otherwise are allocated with <b>UIMalloc</b>.
+ *
+ * The operators are declared by the most derived class, so they are picked over the ones of the bases of the view.
+ *
+ * @since 6.0
+ * @version 6.0
+ */
+template <typename View>
+class UIArenaView : public View {
+public:
+    using View::View;
+
+    static void* operator new(size_t size)
+    {
+        return UIArena::Allocate(size);
+    }
+
+    static void* operator new[](size_t size)
+    {
+        return UIArena::Allocate(size);
+    }
+
+    static void* operator new(size_t, void* ptr)
+    {
+        return ptr;
+    }
+
+    static void operator delete(void* ptr)
+    {
+        UIArena::Free(ptr);
+    }
+
+    static void operator delete[](void* ptr)
+    {
+        UIArena::Free(ptr);
+    }
+
+    static void operator delete(void*, void*) {}
+};
+
+/**
+ * @brief Hands out the temporary buffers used while a frame is rendered.
+ *
+ * The buffers are taken one after another from one block of memory and are all given back at once when the frame
+ * is flushed, so they are not freed one by one. The buffers which do not fit in the block are allocated with
+ * <b>UIMalloc</b>, and the block grows to the size needed by the frame for the next frames, up to a limit.
+ * The allocator must only be used on the UI thread.
+ *
+ * @since 6.0
+ * @version 6.0
+ */
+class UIFrameAllocator : public HeapBase {
+public:
+    /**
+     * @brief Stores the allocation counters of the frame allocator.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    struct Stats {
+        /** Frames rendered */
+        uint32_t frameNum;
+        /** Buffers handed out */
+        uint32_t allocNum;
+        /** Buffers allocated with <b>UIMalloc</b> because they did not fit in the block */
+        uint32_t overflowNum;
+        /** Bytes handed out in the current frame */
+        uint32_t usedBytes;
+        /** Most bytes handed out in a frame */
+        uint32_t peakBytes;
+        /** Size of the block in bytes */
+        uint32_t capacity;
+    };
+
+    /**
+     * @brief Obtains the singleton instance of the frame allocator.
+     *
+     * @return Returns the singleton instance.
+     * @since 6.0
+     * @version 6.0
+     */
+    static UIFrameAllocator* GetInstance();
+
+    /**
+     * @brief Hands out a buffer which stays valid until the frame is flushed.
+     *
+     * @param size Indicates the size of the buffer in bytes.
+     * @return Returns the buffer, or <b>nullptr</b> on failure.
+     * @since 6.0
+     * @version 6.0
+     */
+    void* Allocate(uint32_t size);
+
+    /**
+     * @brief Gives back all the buffers handed out. Called by the root view when a frame is flushed.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void Reset();
+
+    /**
+     * @brief Obtains the allocation counters of the frame allocator.
+     *
+     * @return Returns the allocation counters.
+     * @since 6.0
+     * @version 6.0
+     */
+    const Stats& GetStats() const
+    {
+        return stats_;
+    }
+
+    /** Largest size of the block in bytes */
+    static constexpr uint32_t MAX_CAPACITY = 65536;
+
+private:
+    struct Overflow {
+        Overflow* next;
+    };
+
+    UIFrameAllocator() : buffer_(nullptr), offset_(0), overflows_(nullptr), stats_({}) {}
+    ~UIFrameAllocator() {}
+
+    UIFrameAllocator(const UIFrameAllocator&) = delete;
+    UIFrameAllocator& operator=(const UIFrameAllocator&) = delete;
+    UIFrameAllocator(UIFrameAllocator&&) = delete;
+    UIFrameAllocator& operator=(UIFrameAllocator&&) = delete;
+
+    uint8_t* buffer_;
+    uint32_t offset_;
+    Overflow* overflows_;
+    Stats stats_;
+};
+} // namespace OHOS
+#endif // GRAPHIC_LITE_UI_ARENA_H
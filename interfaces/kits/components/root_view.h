@@ -236,6 +236,47 @@ public:
         onVirtualEventListener_ = nullptr;
     }
 
+    /**
+     * @brief Listens for the frames flushed to the screen.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    class OnFlushListener : public HeapBase {
+    public:
+        /**
+         * @brief Called on the render thread after the damaged area of a frame is flushed to the screen.
+         *
+         * @param flushRect Indicates the area redrawn in this frame.
+         * @since 6.0
+         * @version 6.0
+         */
+        virtual void OnFlush(const Rect& flushRect) = 0;
+    };
+
+    /**
+     * @brief Sets a listener for monitoring the frames flushed to the screen.
+     *
+     * @param onFlushListener Indicates the pointer to the listener to set.
+     * @since 6.0
+     * @version 6.0
+     */
+    void SetOnFlushListener(OnFlushListener* onFlushListener)
+    {
+        onFlushListener_ = onFlushListener;
+    }
+
+    /**
+     * @brief Clears the listener for monitoring the frames flushed to the screen.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void ClearOnFlushListener()
+    {
+        onFlushListener_ = nullptr;
+    }
+
     /**
      * @brief Checks whether the target view is one of the child views of the specified parent view.
      *
@@ -276,6 +317,47 @@ public:
      */
     void UpdateBufferInfo(BufferInfo* fbBufferInfo);
 
+    /**
+     * @brief Defines the overdraw statistics of a frame.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    struct OverdrawStats {
+        /** Pixels of the dirty areas */
+        uint32_t dirtyArea;
+        /** Pixels drawn by the views, a pixel drawn by two views counts twice */
+        uint32_t drawnArea;
+        /** Pixels not drawn because opaque views in front of the views cover them */
+        uint32_t culledArea;
+        /** Number of views not drawn at all */
+        uint16_t culledViewNum;
+    };
+
+    /**
+     * @brief Obtains the overdraw statistics of the last rendered frame.
+     *
+     * @return Returns the overdraw statistics.
+     * @since 6.0
+     * @version 6.0
+     */
+    const OverdrawStats& GetOverdrawStats() const
+    {
+        return overdrawStats_;
+    }
+
+    /**
+     * @brief Sets whether to skip drawing the parts of views covered by opaque views in front of them.
+     *
+     * @param enable Specifies whether to enable the occlusion culling, which is enabled by default.
+     * @since 6.0
+     * @version 6.0
+     */
+    void SetOcclusionCullingEnabled(bool enable)
+    {
+        occlusionCullingEnabled_ = enable;
+    }
+
     /**
      * @brief save the drawing context.
      *
@@ -317,6 +399,20 @@ private:
     void ClearMapBuffer();
     void UpdateMapBufferInfo(Rect& invalidatedArea);
     void RestoreMapBufferInfo();
+#if ENABLE_WINDOW
+    bool BeginComposite(const Rect* occluders, uint8_t occluderNum, bool& hidden);
+    bool FlushComposite(Rect& flushRect);
+    bool IsCoveredByWindows(const Rect& rect) const;
+#if !LOCAL_RENDER
+    void ExposeCoveredRects();
+    bool CoverRect(const Rect& rect);
+#endif
+#endif
+    void RenderDirtyRect(const Rect& rect);
+    void FlushFrame(const Rect& flushRect);
+    void CollectOccluders(UIView* view, const Rect& rect);
+    void AddOccluder(UIView* view, const Rect& clipRect);
+    void DrawVisibleParts(UIView* view, const Rect& rect);
 #if LOCAL_RENDER
     void RemoveViewFromInvalidMap(UIView *view);
     void DrawInvalidMap(const Rect &buffRect);
@@ -332,12 +428,30 @@ private:
 
     OnKeyActListener* onKeyActListener_ {nullptr};
     OnVirtualDeviceEventListener* onVirtualEventListener_ {nullptr};
+    OnFlushListener* onFlushListener_ {nullptr};
 #if defined __linux__ || defined __LITEOS__ || defined __APPLE__
     pthread_mutex_t lock_;
 #endif
 
 #if ENABLE_WINDOW
     WindowImpl* boundWindow_ {nullptr};
+
+    static constexpr uint8_t MAX_WINDOW_OCCLUDER_NUM = 8;
+    static constexpr uint8_t MAX_COVERED_RECT_NUM = 16;
+    /* The window being composed by RenderManager, the occluders are the opaque windows above it. */
+    struct CompositeState {
+        Rect occluders[MAX_WINDOW_OCCLUDER_NUM];
+        uint8_t occluderNum;
+        bool composing;
+        bool flushPending;
+        Rect flushRect;
+    };
+    CompositeState composite_ {};
+#if !LOCAL_RENDER
+    /* damage hidden by the windows above, each rect is inside one of them, drawn once they do not hide it */
+    Rect coveredRects_[MAX_COVERED_RECT_NUM];
+    uint8_t coveredRectNum_ {0};
+#endif
 #endif
     /**
      * @brief draw context info.
@@ -352,6 +466,18 @@ private:
     };
     DrawContext dc_;
     DrawContext bakDc_;
+
+    /* An opaque area painted by view, which hides whatever is painted below it before. */
+    struct Occluder {
+        UIView* view;
+        Rect rect;
+    };
+    static constexpr uint8_t MAX_OCCLUDER_NUM = 16;
+    Occluder occluders_[MAX_OCCLUDER_NUM];
+    uint8_t occluderNum_ {0};
+    uint8_t occluderCursor_ {0}; // occluders from the cursor on are painted after the view being drawn
+    bool occlusionCullingEnabled_ {true};
+    OverdrawStats overdrawStats_ {};
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_ROOT_VIEW_H
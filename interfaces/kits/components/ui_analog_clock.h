@@ -62,7 +62,7 @@ public:
      * @since 1.0
      * @version 1.0
      */
-    virtual ~UIAnalogClock() {}
+    virtual ~UIAnalogClock();
 
     /**
      * @brief Enumerates the clock hand types.
@@ -346,10 +346,64 @@ public:
      */
     void UpdateClock(bool clockInit) override;
 
+    /**
+     * @brief Sets whether the image hands are drawn from rotated copies kept by this analog clock.
+     *
+     * When enabled, an image hand is rotated once the first time it points at an angle, into a copy trimmed to its
+     * visible pixels. The later ticks at this angle only blend the copy and redraw the area it covers. The angles
+     * of the hands are rounded to multiples of <b>angleStep</b>. The copies which would make the copies of this
+     * clock larger than {@link MAX_HAND_SPRITE_SIZE} are not kept, those angles are rotated when drawn as before.
+     *
+     * @param enable Specifies whether to keep the rotated hands. The default value is <b>false</b>.
+     * @param angleStep Indicates the angle between two kept copies in degrees, from 1 to 360. For example, 6 keeps
+     *                  a copy for each second of the second hand.
+     * @since 6.0
+     * @version 6.0
+     */
+    void SetHandSpriteCache(bool enable, uint16_t angleStep = 1);
+
+    /**
+     * @brief Checks whether the image hands are drawn from rotated copies.
+     *
+     * @return Returns <b>true</b> if the image hands are drawn from rotated copies; returns <b>false</b> otherwise.
+     * @since 6.0
+     * @version 6.0
+     */
+    bool IsHandSpriteCacheEnabled() const
+    {
+        return spriteAngleStep_ != 0;
+    }
+
+    /**
+     * @brief Obtains the size of the rotated copies of the hands kept by this analog clock.
+     *
+     * @return Returns the size in bytes.
+     * @since 6.0
+     * @version 6.0
+     */
+    uint32_t GetHandSpriteCacheSize() const
+    {
+        return spriteSize_;
+    }
+
+    /** Largest size of the rotated copies of the hands of a clock in bytes */
+    static constexpr uint32_t MAX_HAND_SPRITE_SIZE = 262144;
+
 private:
+    struct HandSprite : public HeapBase {
+        uint8_t* data = nullptr; // ARGB8888, trimmed to the visible pixels of the rotated hand
+        Rect rect;               // relative to the clock
+        bool failed = false;     // not kept, the hand is rotated when drawn at this angle
+    };
+    static constexpr uint8_t HAND_NUM = 3;
+
     Hand hourHand_;
     Hand minuteHand_;
     Hand secondHand_;
+    /* one for each angle step and hand, nullptr until the hand is drawn from the copies */
+    HandSprite* handSprites_[HAND_NUM];
+    uint16_t spriteAngleStep_;
+    uint32_t spriteSize_;
 
     void DrawHand(BufferInfo& gfxDstBuffer, const Rect& current, const Rect& invalidatedArea, Hand& hand);
     void DrawHandImage(BufferInfo& gfxDstBuffer, const Rect& current, const Rect& invalidatedArea, Hand& hand);
@@ -357,6 +411,12 @@ private:
     uint16_t ConvertHandValueToAngle(uint8_t handValue, uint8_t range, uint8_t secondHandValue, uint8_t ratio) const;
     uint16_t ConvertHandValueToAngle(uint8_t handValue, uint8_t range) const;
     void CalculateRedrawArea(const Rect& current, Hand& hand, bool clockInit);
+    uint8_t GetHandIndex(const Hand& hand) const;
+    uint16_t GetSpriteIndex(const Hand& hand) const;
+    HandSprite* GetHandSprite(const Rect& current, const Rect& imgRect, const Rect& box, Hand& hand);
+    bool RenderHandSprite(const Rect& current, const Rect& imgRect, const Rect& box, const Hand& hand,
+                          HandSprite& sprite);
+    void ClearHandSprites(uint8_t handIndex);
 };
 } // namespace OHOS
 #endif // UI_ANALOG_CLOCK_H
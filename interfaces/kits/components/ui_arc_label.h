@@ -41,6 +41,8 @@
 #include "components/ui_view.h"
 
 namespace OHOS {
+struct ArcLetterInfo;
+
 /**
  * @brief Defines functions related to an arc label.
  *
@@ -109,10 +111,7 @@ public:
      * @since 1.0
      * @version 1.0
      */
-    void SetStyle(Style& style) override
-    {
-        UIView::SetStyle(style);
-    }
+    void SetStyle(Style& style) override;
 
     /**
      * @brief Sets a style.
@@ -382,6 +381,8 @@ protected:
 private:
     void ReMeasure() override;
     void MeasureArcTextInfo();
+    bool UpdateArcLetters();
+    void ClearArcLetters();
 
     bool needRefresh_;
     Point textSize_;
@@ -392,6 +393,10 @@ private:
     TextOrientation orientation_;
 
     ArcTextInfo arcTextInfo_;
+
+    /* the letters placed on the arc, kept until the text, the font, the style or the arc changes */
+    ArcLetterInfo* arcLetters_;
+    uint16_t arcLetterNum_;
 };
 } // namespace OHOS
 #endif // GRAPHIC_LITE_UI_ARC_LABEL_H
@@ -36,6 +36,7 @@
 #ifndef GRAPHIC_LITE_UI_CANVAS_H
 #define GRAPHIC_LITE_UI_CANVAS_H
 
+#include "common/ui_arena.h"
 #include "common/image.h"
 #include "components/ui_label.h"
 #include "gfx_utils/diagram/depiction/depict_curve.h"
@@ -453,30 +454,30 @@ public:
 protected:
     constexpr static uint8_t MAX_CURVE_WIDTH = 3;
 
-    struct LineParam : public HeapBase {
+    struct LineParam : public UIArenaObject {
         Point start;
         Point end;
     };
 
-    struct CurveParam : public HeapBase {
+    struct CurveParam : public UIArenaObject {
         Point start;
         Point control1;
         Point control2;
         Point end;
     };
 
-    struct RectParam : public HeapBase {
+    struct RectParam : public UIArenaObject {
         Point start;
         int16_t height;
         int16_t width;
     };
 
-    struct CircleParam : public HeapBase {
+    struct CircleParam : public UIArenaObject {
         Point center;
         uint16_t radius;
     };
 
-    struct ArcParam : public HeapBase {
+    struct ArcParam : public UIArenaObject {
         Point center;
         uint16_t radius;
         int16_t startAngle;
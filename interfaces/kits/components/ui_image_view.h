@@ -43,6 +43,7 @@
 #endif
 
 namespace OHOS {
+class ImageDecodeListener;
 /**
  * @brief Defines the functions related to an image view.
  *
@@ -146,6 +147,71 @@ public:
      */
     virtual void SetSrc(const ImageInfo* src);
 
+    /**
+     * @brief Sets whether PNG and JPEG files are decoded asynchronously.
+     *
+     * When enabled, {@link SetSrc} returns immediately and shows the placeholder set by {@link SetPlaceholder}
+     * until the file is decoded on a worker thread. Decoding is held back while the view is removed from its parent
+     * and resumes when it is added again. Other image formats are still set synchronously.
+     * The progress is obtained by {@link GetAsyncDecodeState}.
+     *
+     * @param enable Specifies whether to decode asynchronously. The default value is <b>false</b>.
+     * @since 1.0
+     * @version 1.0
+     */
+    void SetAsyncDecode(bool enable);
+
+    /**
+     * @brief Checks whether PNG and JPEG files are decoded asynchronously.
+     *
+     * @return Returns <b>true</b> if asynchronous decoding is enabled; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool GetAsyncDecode() const
+    {
+        return asyncDecode_;
+    }
+
+    /**
+     * @brief Enumerates the states of the asynchronous decoding.
+     */
+    enum AsyncDecodeState : uint8_t {
+        /** No file is decoded asynchronously */
+        ASYNC_DECODE_NONE,
+        /** The file is being decoded, the placeholder is displayed */
+        ASYNC_DECODE_PENDING,
+        /** The decoded image is displayed */
+        ASYNC_DECODE_DONE,
+        /** The file failed to be decoded, the placeholder stays displayed */
+        ASYNC_DECODE_FAILED,
+    };
+
+    /**
+     * @brief Obtains the state of the asynchronous decoding of the file set last.
+     *
+     * @return Returns the state of the asynchronous decoding. For details, see {@link AsyncDecodeState}.
+     * @since 1.0
+     * @version 1.0
+     */
+    AsyncDecodeState GetAsyncDecodeState() const
+    {
+        return asyncDecodeState_;
+    }
+
+    /**
+     * @brief Sets the image displayed while a file is being decoded asynchronously.
+     *
+     * @param placeholder Indicates the pointer to the placeholder image, which must stay valid while it is in use.
+     *                    If it is null, nothing is drawn while decoding.
+     * @since 1.0
+     * @version 1.0
+     */
+    void SetPlaceholder(const ImageInfo* placeholder)
+    {
+        placeholder_ = placeholder;
+    }
+
     /**
      * @brief Sets whether the image view size needs to be adaptive to the image size.
      *
@@ -159,6 +225,7 @@ public:
         if (autoEnable_ != enable) {
             needRefresh_ = autoEnable_ ? needRefresh_ : true;
             autoEnable_ = enable;
+            UpdateDecodeSize();
             UpdateDrawTransMap(true);
         }
     }
@@ -175,6 +242,31 @@ public:
         return autoEnable_;
     }
 
+    /**
+     * @brief Sets whether an image shrunk by the resize mode or a transform is drawn from a reduced copy.
+     *
+     * When enabled, a PNG or JPEG file shrunk by the resize mode is decoded at a reduced size that still covers this
+     * image view, which takes effect for files set after the size and the resize mode. In addition, an image shrunk
+     * by a transform is drawn from the mip level closest to its scale, which costs up to 1/3 of the image memory.
+     *
+     * @param enable Specifies whether to draw from a reduced copy. The default value is <b>false</b>.
+     * @since 1.0
+     * @version 1.0
+     */
+    void SetDownscaleEnable(bool enable);
+
+    /**
+     * @brief Checks whether an image shrunk by the resize mode or a transform is drawn from a reduced copy.
+     *
+     * @return Returns <b>true</b> if it is drawn from a reduced copy; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool GetDownscaleEnable() const
+    {
+        return downscaleEnable_;
+    }
+
     /**
      * @brief Sets the blur level for this image when it is rotated or scaled.
      *
@@ -322,9 +414,20 @@ protected:
     TransformMap* drawTransMap_ = nullptr;
     Matrix4<float>* contentMatrix_ = nullptr;
     bool transMapInvalid_ = true;
+    bool asyncDecode_ = false;
+    AsyncDecodeState asyncDecodeState_ = ASYNC_DECODE_NONE;
+    const ImageInfo* placeholder_ = nullptr;
+    ImageDecodeListener* decodeListener_ = nullptr;
+    bool downscaleEnable_ = false;
 
 private:
+    friend class ImageViewDecodeListener;
     void ReMeasure() override;
+    bool SetSrcAsync(const char* src);
+    void CancelAsyncDecode();
+    void OnAsyncDecodeFinished(const char* src, ImageInfo* imgInfo, uint8_t decodeShift);
+    Image::DecodeSize GetDecodeSize();
+    void UpdateDecodeSize();
 #if defined(ENABLE_GIF) && (ENABLE_GIF == 1)
     friend class GifImageAnimator;
     void AddAndStartGifAnimator();
@@ -406,6 +406,31 @@ public:
      */
     int16_t GetRollStartPos() const;
 
+    /**
+     * @brief Sets whether the text scrolled in {@link LINE_BREAK_MARQUEE} mode is drawn from a cached strip.
+     *
+     * When enabled, the line of text is rendered once into an ARGB8888 strip as wide as the text, and each scroll
+     * step only blends the visible part of the strip into the label. The strip is rendered again when the text, the
+     * style or the size changes. It takes the text width x the content height x 4 bytes.
+     *
+     * @param enable Specifies whether to draw the scrolled text from a cached strip.
+     * @since 6.0
+     * @version 6.0
+     */
+    void SetMarqueeCacheEnable(bool enable);
+
+    /**
+     * @brief Checks whether the text scrolled in {@link LINE_BREAK_MARQUEE} mode is drawn from a cached strip.
+     *
+     * @return Returns <b>true</b> if the scrolled text is drawn from a cached strip; returns <b>false</b> otherwise.
+     * @since 6.0
+     * @version 6.0
+     */
+    bool IsMarqueeCacheEnabled() const
+    {
+        return marqueeStrip_ != nullptr;
+    }
+
     /**
      * @brief Sets the width for this label.
      *
@@ -430,21 +455,25 @@ public:
     {
         InitLabelText();
         labelText_->SetSupportBaseLine(baseLine);
+        MarkMarqueeStripDirty();
     }
 
     void SetBackgroundColorSpan(ColorType backgroundColor, int16_t start, int16_t end)
     {
         labelText_->SetBackgroundColorSpan(backgroundColor, start, end);
+        MarkMarqueeStripDirty();
     }
 
     void SetForegroundColorSpan(ColorType fontColor, int16_t start, int16_t end)
     {
         labelText_->SetForegroundColorSpan(fontColor, start, end);
+        MarkMarqueeStripDirty();
     }
 
     void SetLineBackgroundSpan(ColorType lineBackgroundColor, int16_t start, int16_t end)
     {
         labelText_->SetLineBackgroundSpan(lineBackgroundColor, start, end);
+        MarkMarqueeStripDirty();
     }
 
     void SetAbsoluteSizeSpan(uint16_t start, uint16_t end, uint8_t size);
@@ -457,8 +486,14 @@ protected:
 
 private:
     friend class LabelAnimator;
+    struct MarqueeStrip;
 
     void RemeasureForMarquee(int16_t textWidth);
+    void InvalidateMarquee();
+    void MarkMarqueeStripDirty();
+    bool UpdateMarqueeStrip(int16_t width, int16_t height, const Style& style);
+    bool DrawMarqueeStrip(BufferInfo& gfxDstBuffer, const Rect& invalidatedArea, const Style& style,
+                          OpacityType opaScale);
 
     bool needRefresh_ : 1;
     bool useTextColor_ : 1;
@@ -467,6 +502,7 @@ private:
     uint16_t ellipsisIndex_;
     int16_t offsetX_;
     ColorType textColor_;
+    MarqueeStrip* marqueeStrip_;
 
     static constexpr uint16_t DEFAULT_ANIMATOR_SPEED = 35;
     union {
@@ -1258,6 +1258,8 @@ public:
     /**
      * @brief Sets a style.
      *
+     * The views whose styles are set key by key share one copy of each distinct style.
+     *
      * @param key Indicates the key of the style to set.
      * @param value Indicates the value matching the key.
      * @since 1.0
@@ -1538,7 +1540,7 @@ protected:
     bool dragParentInstead_ : 1;
     bool isViewGroup_ : 1;
     bool needRedraw_ : 1;
-    bool styleAllocFlag_ : 1;
+    bool styleAllocFlag_ : 1; // style_ is a pooled style
     bool isIntercept_ : 1;
 #if ENABLE_FOCUS_MANAGER
     bool focusable_ : 1;
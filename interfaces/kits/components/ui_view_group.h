@@ -232,10 +232,7 @@ public:
      * @since 5.0
      * @version 3.0
      */
-    void SetInterceptFocus(bool interceptFocus)
-    {
-        isInterceptFocus_ = interceptFocus;
-    }
+    void SetInterceptFocus(bool interceptFocus);
 
     /**
      * @brief 获取组件是否拦截焦点.
@@ -38,11 +38,14 @@
 #include "graphic_config.h"
 #include "gfx_utils/heap_base.h"
 #if ENABLE_DEBUG
+#include <map>
 #include "cJSON.h"
 #include "components/ui_view.h"
 #endif // ENABLE_DEBUG
 namespace OHOS {
 #if ENABLE_DEBUG
+class DomJsonWriter;
+
 /**
  * @brief Enumerates export modes.
  */
@@ -110,43 +113,101 @@ public:
      */
     char* DumpDomNode(const char* id);
 
-private:
-#if ENABLE_DEBUG
-    bool searchFlag_;     // Search flag, set when find the view with right id.
-    bool allocErrorFlag_; // Alloc error flag, set when cJSON fails to allocate memory.
-    char* pJson_;         // Pointer for returning cJSON string.
-    cJSON* rootJson_;     // Root pointer of cJSON structure.
-    const char* path_;
-
-    void DumpJsonById(UIView* view, const char* id, DumpMode mode);
-
-    void AddNameField(UIViewType type, cJSON* usr) const;
-    void AddCommonField(UIView* view, cJSON* usr) const;
-    void AddImageViewSpecialField(const UIView* view, cJSON* usr) const;
-    void AddLabelField(const UIView* view, cJSON* usr) const;
-    void AddLabelButtonField(const UIView* view, cJSON* usr) const;
-    void AddCheckboxField(const UIView* view, cJSON* usr) const;
-    void AddToggleButtonField(const UIView* view, cJSON* usr) const;
-    void AddProgressField(const UIView* view, cJSON* usr) const;
-    void AddScrollViewField(const UIView* view, cJSON* usr) const;
-    void AddListField(const UIView* view, cJSON* usr) const;
-    void AddClockField(const UIView* view, cJSON* usr) const;
-    void AddPickerField(const UIView* view, cJSON* usr) const;
-    void AddSwipeViewField(const UIView* view, cJSON* usr) const;
-    void AddTimePickerField(const UIView* view, cJSON* usr) const;
-    void AddSpecialField(const UIView* view, cJSON* usr) const;
-    void OutputDomNode(UIView* view);
-    void OutputDomTree(UIView* view, cJSON* usr);
-    bool WriteDumpFile() const;
-
-    UIDumpDomTree()
-        : searchFlag_(false),
-          allocErrorFlag_(false),
-          pJson_(nullptr),
-          rootJson_(nullptr),
-          path_(DEFAULT_DUMP_DOM_TREE_PATH)
+    /**
+     * @brief Exports information about a DOM tree starting from a specified DOM node and writes it to an opened file.
+     *
+     * The information is written while the DOM tree is walked, through a small fixed buffer, so no memory is
+     * allocated for the whole tree. The file descriptor is not closed.
+     *
+     * @param id Indicates the pointer to the DOM node ID. The whole tree is exported if it is <b>nullptr</b>.
+     * @param fd Indicates the file descriptor to write.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool DumpDomTreeToFd(const char* id, int32_t fd);
+
+    /**
+     * @brief Exports information about a DOM tree starting from a specified DOM node into a buffer.
+     *
+     * @param id Indicates the pointer to the DOM node ID. The whole tree is exported if it is <b>nullptr</b>.
+     * @param buf Indicates the pointer to the buffer, which is terminated with '\0' on success.
+     * @param size Indicates the size of the buffer.
+     * @return Returns the length of the information if the operation is successful; returns <b>-1</b> if the node
+     *         is not found or the buffer is too small.
+     * @since 1.0
+     * @version 1.0
+     */
+    int32_t DumpDomTreeToBuffer(const char* id, char* buf, uint32_t size);
+
+    /**
+     * @brief Sets whether the DOM tree is exported incrementally.
+     *
+     * In incremental mode, a DOM tree export only contains the subtrees changed since the previous export, as
+     * <b>{"changed":[...]}</b>. A subtree is exported as a whole when its root node is new, when any of its
+     * information changes or when its children are added, removed or reordered; the root of each exported subtree
+     * carries the ID of its parent as <b>parentId</b>. The first export after the mode is enabled contains the
+     * whole tree.
+     *
+     * @param enable Specifies whether to enable the incremental mode.
+     * @since 1.0
+     * @version 1.0
+     */
+    void SetIncrementalMode(bool enable);
+
+    /**
+     * @brief Checks whether the DOM tree is exported incrementally.
+     *
+     * @return Returns <b>true</b> if the incremental mode is enabled; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool IsIncrementalMode() const
     {
+#if ENABLE_DEBUG
+        return incremental_;
+#else
+        return false;
+#endif // ENABLE_DEBUG
     }
+
+private:
+#if ENABLE_DEBUG
+    struct DumpRecord {
+        uint32_t hash;       // Hash of the node information and its children.
+        uint32_t generation; // The latest export which has seen the node.
+    };
+
+    bool incremental_;
+    uint32_t generation_;
+    std::map<const UIView*, DumpRecord> records_;
+
+    UIView* GetDumpRoot(const char* id) const;
+    UIView* FindViewById(UIView* view, const char* id) const;
+
+    void AddNameField(UIViewType type, DomJsonWriter& writer) const;
+    void AddCommonField(UIView* view, DomJsonWriter& writer) const;
+    void AddImageViewSpecialField(const UIView* view, DomJsonWriter& writer) const;
+    void AddLabelField(const UIView* view, DomJsonWriter& writer) const;
+    void AddLabelButtonField(const UIView* view, DomJsonWriter& writer) const;
+    void AddCheckboxField(const UIView* view, DomJsonWriter& writer) const;
+    void AddToggleButtonField(const UIView* view, DomJsonWriter& writer) const;
+    void AddProgressField(const UIView* view, DomJsonWriter& writer) const;
+    void AddScrollViewField(const UIView* view, DomJsonWriter& writer) const;
+    void AddListField(const UIView* view, DomJsonWriter& writer) const;
+    void AddClockField(const UIView* view, DomJsonWriter& writer) const;
+    void AddPickerField(const UIView* view, DomJsonWriter& writer) const;
+    void AddSwipeViewField(const UIView* view, DomJsonWriter& writer) const;
+    void AddTimePickerField(const UIView* view, DomJsonWriter& writer) const;
+    void AddSpecialField(const UIView* view, DomJsonWriter& writer) const;
+    void AddViewFields(UIView* view, DomJsonWriter& writer) const;
+    uint32_t GetNodeHash(UIView* view) const;
+    void OutputDomNode(UIView* view, DomJsonWriter& writer) const;
+    void OutputDomTree(UIView* view, DomJsonWriter& writer, bool isChangedRoot);
+    void OutputChangedTree(UIView* view, DomJsonWriter& writer);
+    bool OutputDom(UIView* view, DomJsonWriter& writer);
+
+    UIDumpDomTree() : incremental_(false), generation_(0) {}
 #else
     UIDumpDomTree() {}
 #endif // ENABLE_DEBUG
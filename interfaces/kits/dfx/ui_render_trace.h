@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @addtogroup UI_DFX
+ * @{
+ *
+ * @brief Provides test and analysis capabilities, such as stimulating input events and viewing information about a
+ *        Document Object Model (DOM) tree.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+
+/**
+ * @file ui_render_trace.h
+ *
+ * @brief Declares the render trace, which records how long measuring, drawing, font rasterization and image
+ *        decoding take and exports the records in the Chrome trace event format.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+#ifndef GRAPHIC_LITE_UI_RENDER_TRACE_H
+#define GRAPHIC_LITE_UI_RENDER_TRACE_H
+
+#include "graphic_config.h"
+
+#if ENABLE_DEBUG
+#include <atomic>
+#include <cstdint>
+#include "gfx_utils/heap_base.h"
+
+namespace OHOS {
+class UIView;
+
+/**
+ * @brief Records the duration of the render stages into a ring buffer.
+ *
+ * Probes are placed around <b>RootView::Measure</b>, <b>RootView::DrawTop</b>, the <b>OnDraw</b> and
+ * <b>OnPostDraw</b> of each view, the calls of the software graphics engine, font rasterization and image decoding.
+ * A probe costs a single flag check while tracing is stopped. While tracing, the oldest records are overwritten once
+ * the ring buffer is full. The records can be opened in <b>chrome://tracing</b> or Perfetto.
+ *
+ * @since 1.0
+ * @version 1.0
+ */
+class UIRenderTrace : public HeapBase {
+public:
+    /** Default number of records kept in the ring buffer */
+    static constexpr uint32_t DEFAULT_EVENT_NUM = 4096;
+
+    /**
+     * @brief Obtains a singleton <b>UIRenderTrace</b> instance.
+     *
+     * @return Returns the <b>UIRenderTrace</b> instance.
+     * @since 1.0
+     * @version 1.0
+     */
+    static UIRenderTrace* GetInstance();
+
+    /**
+     * @brief Starts tracing. Records of the previous tracing are dropped.
+     *
+     * @param eventNum Indicates the number of records kept in the ring buffer, which is rounded up to a power of 2.
+     *                 The buffer is only reallocated when this number changes, which must not happen while image
+     *                 decoding is running on other threads.
+     * @return Returns <b>true</b> if tracing is started; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool Start(uint32_t eventNum = DEFAULT_EVENT_NUM);
+
+    /**
+     * @brief Stops tracing. The records are kept until the next {@link Start}.
+     *
+     * @since 1.0
+     * @version 1.0
+     */
+    void Stop();
+
+    /**
+     * @brief Checks whether tracing is running.
+     *
+     * @return Returns <b>true</b> if tracing is running; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    static bool IsTracing()
+    {
+        return tracing_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtains the index of the current frame, which is increased each time the render task runs.
+     *
+     * @return Returns the frame index.
+     * @since 1.0
+     * @version 1.0
+     */
+    uint32_t GetFrameIndex() const
+    {
+        return frameIndex_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Exports the records of a frame range to a file in the Chrome trace event JSON format.
+     *
+     * Call {@link Stop} before exporting, otherwise the records written meanwhile may be skipped.
+     *
+     * @param path       Indicates the pointer to the file path.
+     * @param startFrame Indicates the first frame to export.
+     * @param endFrame   Indicates the last frame to export.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool DumpTrace(const char* path, uint32_t startFrame, uint32_t endFrame) const;
+
+    /**
+     * @brief Exports all records to a file in the Chrome trace event JSON format.
+     *
+     * @param path Indicates the pointer to the file path.
+     * @return Returns <b>true</b> if the operation is successful; returns <b>false</b> otherwise.
+     * @since 1.0
+     * @version 1.0
+     */
+    bool DumpTrace(const char* path) const
+    {
+        return DumpTrace(path, 0, UINT32_MAX);
+    }
+
+    /* Called by the render task at the beginning of each frame. */
+    void BeginFrame()
+    {
+        frameIndex_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /* Appends a record which starts at startTime and ends now, view is null for the records of no view. */
+    void AddEvent(const char* name, const UIView* view, uint64_t startTime);
+
+    /* Monotonic time in microseconds. */
+    static uint64_t GetTime();
+
+private:
+    struct TraceRecord {
+        const char* name;
+        uint64_t start;
+        uint32_t duration;
+        uint32_t frame;
+        uint32_t tid;
+        uint8_t viewType;
+    };
+
+    /* seq is the write index plus 1 once the record is complete, and 0 while it is being written */
+    struct TraceEvent {
+        std::atomic<uint32_t> seq;
+        TraceRecord record;
+    };
+
+    static constexpr uint8_t NO_VIEW = 0xFF;
+
+    UIRenderTrace() : events_(nullptr), eventNum_(0), writeIndex_(0), frameIndex_(0) {}
+    ~UIRenderTrace();
+
+    UIRenderTrace(const UIRenderTrace&) = delete;
+    UIRenderTrace& operator=(const UIRenderTrace&) = delete;
+    UIRenderTrace(UIRenderTrace&&) = delete;
+    UIRenderTrace& operator=(UIRenderTrace&&) = delete;
+
+    static uint32_t GetThreadId();
+    static bool WriteRecord(int32_t fd, const TraceRecord& record, bool first);
+
+    static std::atomic<bool> tracing_;
+    TraceEvent* events_;
+    uint32_t eventNum_;
+    std::atomic<uint32_t> writeIndex_;
+    std::atomic<uint32_t> frameIndex_;
+};
+
+/* Records the lifetime of the scope it is declared in. */
+class UIRenderTraceScope {
+public:
+    UIRenderTraceScope(const char* name, const UIView* view) : name_(nullptr), view_(view), start_(0)
+    {
+        if (UIRenderTrace::IsTracing()) {
+            name_ = name;
+            start_ = UIRenderTrace::GetTime();
+        }
+    }
+
+    ~UIRenderTraceScope()
+    {
+        if (name_ != nullptr) {
+            UIRenderTrace::GetInstance()->AddEvent(name_, view_, start_);
+        }
+    }
+
+private:
+    const char* name_;
+    const UIView* view_;
+    uint64_t start_;
+};
+} // namespace OHOS
+
+#define UI_RENDER_TRACE_CONCAT_IMPL(a, b) a##b
+#define UI_RENDER_TRACE_CONCAT(a, b) UI_RENDER_TRACE_CONCAT_IMPL(a, b)
+#define UI_RENDER_TRACE_SCOPE(name) \
+    OHOS::UIRenderTraceScope UI_RENDER_TRACE_CONCAT(renderTraceScope, __LINE__)(name, nullptr)
+#define UI_RENDER_TRACE_VIEW_SCOPE(name, view) \
+    OHOS::UIRenderTraceScope UI_RENDER_TRACE_CONCAT(renderTraceScope, __LINE__)(name, view)
+#define UI_RENDER_TRACE_FRAME() OHOS::UIRenderTrace::GetInstance()->BeginFrame()
+#else
+#define UI_RENDER_TRACE_SCOPE(name)
+#define UI_RENDER_TRACE_VIEW_SCOPE(name, view)
+#define UI_RENDER_TRACE_FRAME()
+#endif // ENABLE_DEBUG
+#endif // GRAPHIC_LITE_UI_RENDER_TRACE_H
@@ -39,6 +39,7 @@
 
 #if ENABLE_DEBUG
 #include "gfx_utils/heap_base.h"
+#include "gfx_utils/rect.h"
 
 namespace OHOS {
 /**
@@ -48,6 +49,7 @@ namespace OHOS {
  * @version 1.0
  */
 class UIScreenshotListener;
+class UIScreenCapturer;
 
 /**
  * @brief Provides external screenshot functions.
@@ -76,10 +78,90 @@ public:
      */
     bool ScreenshotToFile(const char* path);
 
+    /**
+     * @brief Captures an area of the framebuffer and saves it to a file in the format of {@link ScreenshotToFile}.
+     *
+     * The pixels are copied into one of the preallocated capture buffers at once, and converted and written to the
+     * file on a background thread. The capture is dropped if all capture buffers are still being written.
+     *
+     * @param rect Indicates the area of the screen to capture.
+     * @param path Indicates the pointer to the path for storing the screenshot file.
+     * @return Returns <b>true</b> if the area is captured; returns <b>false</b> otherwise.
+     * @since 6.0
+     * @version 6.0
+     */
+    bool ScreenshotRectToFile(const Rect& rect, const char* path);
+
+    /**
+     * @brief Starts capturing the area redrawn by every frame flushed to the screen into a file.
+     *
+     * Each captured frame is written as a {@link CaptureFrameHeader} followed by the ARGB8888 pixels of its area.
+     * Frames flushed while all capture buffers are still being written are dropped and counted.
+     *
+     * @param path Indicates the pointer to the path for storing the frames.
+     * @return Returns <b>true</b> if the capture is started; returns <b>false</b> otherwise.
+     * @since 6.0
+     * @version 6.0
+     */
+    bool StartFrameCapture(const char* path);
+
+    /**
+     * @brief Stops capturing frames, the frames already captured are written to the file before it returns.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void StopFrameCapture();
+
+    /**
+     * @brief Waits until all captured areas and frames are written.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    void WaitCaptureFinished();
+
+    /**
+     * @brief Obtains the number of captures dropped because all capture buffers were in use.
+     *
+     * @return Returns the number of dropped captures.
+     * @since 6.0
+     * @version 6.0
+     */
+    uint32_t GetDroppedCaptureNum() const;
+
+    /**
+     * @brief Sets the number of capture buffers, each holds a whole screen. Takes effect before the first capture.
+     *
+     * @param bufferNum Indicates the number of capture buffers.
+     * @since 6.0
+     * @version 6.0
+     */
+    void SetCaptureBufferNum(uint8_t bufferNum);
+
+    /**
+     * @brief Defines the header of a frame written by {@link StartFrameCapture}.
+     *
+     * @since 6.0
+     * @version 6.0
+     */
+    struct CaptureFrameHeader {
+        /** Index of the frame since the capture started, including the dropped frames */
+        uint32_t frame;
+        /** Position of the captured area on the screen */
+        int16_t x;
+        int16_t y;
+        /** Size of the captured area */
+        uint16_t width;
+        uint16_t height;
+    };
+
 private:
     UIScreenshotListener* screenshotListener_;
+    UIScreenCapturer* screenCapturer_;
 
-    UIScreenshot() : screenshotListener_(nullptr) {}
+    UIScreenshot() : screenshotListener_(nullptr), screenCapturer_(nullptr) {}
+    bool InitCapturer();
     virtual ~UIScreenshot();
 
     UIScreenshot(const UIScreenshot&) = delete;
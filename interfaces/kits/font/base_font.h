@@ -80,6 +80,24 @@ public:
      */
     virtual uint8_t* GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize) = 0;
 
+    /**
+     * @brief Get bitmap for specific unicode, the bitmap is not evicted from the font cache until UnpinBitmap
+     *
+     * @param unicode
+     * @return uint8_t*
+     */
+    virtual uint8_t* PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize)
+    {
+        return GetBitmap(unicode, glyphNode, fontId, fontSize);
+    }
+
+    /**
+     * @brief Release a bitmap returned by PinBitmap
+     *
+     * @param bitmap
+     */
+    virtual void UnpinBitmap(uint8_t* bitmap) {}
+
     /**
      * @brief Get font header
      *
@@ -217,6 +235,21 @@ public:
 
     virtual void SetFontFileOffset(uint32_t offset) {}
 
+    /**
+     * @brief Rasterizes the glyphs of the code points into the bitmap cache ahead of drawing.
+     * @return int32_t: number of the code points whose bitmaps are cached, INVALID_RET_VALUE if not supported
+     */
+    virtual int32_t PreloadGlyphs(const uint32_t* unicodes, uint32_t num, uint16_t fontId, uint8_t fontSize,
+                                  uint8_t threadNum)
+    {
+        return INVALID_RET_VALUE;
+    }
+
+    virtual int8_t SetGlyphCacheDir(const char* dir)
+    {
+        return INVALID_RET_VALUE;
+    }
+
     void SetRamAddr(uintptr_t ramAddr);
     uintptr_t GetRamAddr();
     uint32_t GetRamLen();
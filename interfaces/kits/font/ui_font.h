@@ -19,6 +19,8 @@
 namespace OHOS {
 class UIFont : public HeapBase {
 public:
+    static constexpr uint8_t DEFAULT_PRELOAD_THREAD_NUM = 2;
+
     UIFont(const UIFont &) = delete;
     UIFont& operator=(const UIFont &) = delete;
 
@@ -113,6 +115,19 @@ public:
      */
     uint8_t* GetBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, uint8_t shapingFont);
 
+    /**
+     * @brief Get bitmap for specific unicode, the bitmap stays valid until UnpinBitmap
+     *
+     * @param unicode
+     * @return uint8_t*
+     */
+    uint8_t* PinBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, uint8_t shapingFont);
+
+    void UnpinBitmap(uint8_t* bitmap)
+    {
+        instance_->UnpinBitmap(bitmap);
+    }
+
     int8_t GetGlyphNode(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize);
 
     /**
@@ -223,6 +238,45 @@ public:
 
     void SetFontFileOffset(uint32_t offset);
 
+    /**
+     * @brief Rasterizes the glyphs of texts on worker threads and puts them into the bitmap cache, so that the
+     *        first drawing of the texts does not wait for the vector font engine. Only supported by vector fonts.
+     *
+     * @param texts: [in] UTF-8 texts
+     * @param textNum: [in] number of texts
+     * @param fontId: [in] font id
+     * @param fontSize: [in] font size
+     * @param threadNum: [in] number of worker threads
+     * @return int32_t: number of the code points whose bitmaps are cached, INVALID_RET_VALUE on failure
+     */
+    int32_t PreloadGlyphs(const char* const* texts, uint16_t textNum, uint16_t fontId, uint8_t fontSize,
+                          uint8_t threadNum = DEFAULT_PRELOAD_THREAD_NUM);
+
+    /**
+     * @brief Rasterizes the glyphs of code point ranges on worker threads and puts them into the bitmap cache.
+     *
+     * @param ranges: [in] closed ranges of code points
+     * @param rangeNum: [in] number of ranges
+     * @param fontId: [in] font id
+     * @param fontSize: [in] font size
+     * @param threadNum: [in] number of worker threads
+     * @return int32_t: number of the code points whose bitmaps are cached, INVALID_RET_VALUE on failure
+     */
+    int32_t PreloadGlyphs(const GlyphRange* ranges, uint16_t rangeNum, uint16_t fontId, uint8_t fontSize,
+                          uint8_t threadNum = DEFAULT_PRELOAD_THREAD_NUM);
+
+    /**
+     * @brief Set the directory keeping the preloaded glyphs on disk, so that they are not rasterized again after
+     *        restart. The files are named after the hash of the font file and the font size.
+     *
+     * @param dir: directory path, nullptr to disable the disk cache
+     * @return int8_t
+     */
+    int8_t SetGlyphCacheDir(const char* dir)
+    {
+        return instance_->SetGlyphCacheDir(dir);
+    }
+
     virtual uint16_t
         GetOffsetPosY(const char* text, uint16_t lineLength, bool& isAllEmoji, uint16_t fontId, uint8_t fontSize)
     {
@@ -260,6 +314,9 @@ private:
      *
      */
     ~UIFont();
+    uint8_t* SearchBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize,
+                          uint8_t shapingFont, bool pin);
+    uint8_t* GetFontBitmap(uint32_t unicode, GlyphNode& glyphNode, uint16_t fontId, uint8_t fontSize, bool pin);
 
     BaseFont* instance_;
     BaseFont* defaultInstance_;
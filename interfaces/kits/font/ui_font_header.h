@@ -414,6 +414,14 @@ struct TtfInfo {
     uint8_t shaping;
 };
 
+/**
+ * @brief struct GlyphRange for a closed range of code points to preload, refer to UIFont::PreloadGlyphs
+ */
+struct GlyphRange {
+    uint32_t first;
+    uint32_t last;
+};
+
 struct UI_STRUCT_ALIGN Metric {
     int left;
     int top;
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "animator/animator_timeline.h"
+
+#include <climits>
+#include <gtest/gtest.h>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const int16_t START_POS = 0;
+const int16_t END_POS = 100;
+const uint16_t TIME = 100;
+const uint16_t HALF_TIME = 50;
+} // namespace
+
+class TestTimelineCallback : public AnimatorCallback {
+public:
+    TestTimelineCallback() : stopCount_(0) {}
+    virtual ~TestTimelineCallback() {}
+
+    void Callback(UIView* view) override {}
+
+    void OnStop(UIView& view) override
+    {
+        stopCount_++;
+    }
+
+    uint16_t stopCount_;
+};
+
+class AnimatorTimelineTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: AnimatorTimelineAddTrack_001
+ * @tc.desc: Verify AddTrack function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTimelineTest, AnimatorTimelineAddTrack_001, TestSize.Level0)
+{
+    AnimatorTimeline* timeline = AnimatorTimeline::GetInstance();
+    UIView* view = new UIView();
+    EXPECT_EQ(timeline->AddTrack(nullptr, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone), AnimatorTimeline::INVALID_TRACK_ID);
+    EXPECT_EQ(timeline->AddTrack(view, AnimatorTimeline::PROPERTY_MAX, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone), AnimatorTimeline::INVALID_TRACK_ID);
+    EXPECT_EQ(timeline->AddTrack(view, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, 0,
+        EasingEquation::LinearEaseNone), AnimatorTimeline::INVALID_TRACK_ID);
+
+    int16_t trackId = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone);
+    EXPECT_NE(trackId, AnimatorTimeline::INVALID_TRACK_ID);
+    EXPECT_EQ(timeline->IsTrackRunning(trackId), true);
+    EXPECT_EQ(timeline->GetTrackNum(), 1);
+
+    timeline->Update(HALF_TIME);
+    EXPECT_EQ(view->GetX(), (START_POS + END_POS) / 2); // 2: half of the distance
+    timeline->Update(HALF_TIME);
+    EXPECT_EQ(view->GetX(), END_POS);
+    EXPECT_EQ(timeline->IsTrackRunning(trackId), false);
+    EXPECT_EQ(timeline->GetTrackNum(), 0);
+    delete view;
+}
+
+/**
+ * @tc.name: AnimatorTimelineRepeat_001
+ * @tc.desc: Verify repeated track and RemoveTracks function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTimelineTest, AnimatorTimelineRepeat_001, TestSize.Level1)
+{
+    AnimatorTimeline* timeline = AnimatorTimeline::GetInstance();
+    UIView* view = new UIView();
+    int16_t trackX = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::CubicEaseOut, true);
+    int16_t trackY = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_Y, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone, true);
+    timeline->Update(TIME + HALF_TIME);
+    EXPECT_EQ(timeline->IsTrackRunning(trackX), true);
+    EXPECT_EQ(view->GetY(), (START_POS + END_POS) / 2); // 2: half of the distance
+    EXPECT_EQ(view->GetX(), EasingEquation::CubicEaseOut(START_POS, END_POS, HALF_TIME, TIME));
+
+    timeline->RemoveTracks(view);
+    EXPECT_EQ(timeline->IsTrackRunning(trackX), false);
+    EXPECT_EQ(timeline->IsTrackRunning(trackY), false);
+    EXPECT_EQ(timeline->GetTrackNum(), 0);
+    delete view;
+}
+
+/**
+ * @tc.name: AnimatorTimelineOnStop_001
+ * @tc.desc: Verify stop callback and opacity track, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTimelineTest, AnimatorTimelineOnStop_001, TestSize.Level1)
+{
+    AnimatorTimeline* timeline = AnimatorTimeline::GetInstance();
+    UIView* view = new UIView();
+    TestTimelineCallback callback;
+    timeline->AddTrack(view, AnimatorTimeline::PROPERTY_OPA_SCALE, OPA_TRANSPARENT, OPA_OPAQUE, TIME,
+        EasingEquation::QuadEaseIn, false, &callback);
+    timeline->Update(HALF_TIME);
+    EXPECT_EQ(callback.stopCount_, 0);
+    timeline->Update(TIME);
+    EXPECT_EQ(callback.stopCount_, 1);
+    EXPECT_EQ(view->GetOpaScale(), OPA_OPAQUE);
+    delete view;
+}
+
+/**
+ * @tc.name: AnimatorTimelineDeleteView_001
+ * @tc.desc: Verify the tracks of a view are removed when the view is deleted, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTimelineTest, AnimatorTimelineDeleteView_001, TestSize.Level1)
+{
+    AnimatorTimeline* timeline = AnimatorTimeline::GetInstance();
+    UIView* view = new UIView();
+    UIView* other = new UIView();
+    int16_t trackId = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone, true);
+    int16_t otherId = timeline->AddTrack(other, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone, true);
+    delete view;
+    EXPECT_EQ(timeline->IsTrackRunning(trackId), false);
+    EXPECT_EQ(timeline->IsTrackRunning(otherId), true);
+    EXPECT_EQ(timeline->GetTrackNum(), 1);
+    timeline->Update(HALF_TIME);
+    EXPECT_EQ(other->GetX(), (START_POS + END_POS) / 2); // 2: half of the distance
+    delete other;
+    EXPECT_EQ(timeline->GetTrackNum(), 0);
+}
+
+/**
+ * @tc.name: AnimatorTimelineTrackId_001
+ * @tc.desc: Verify the track IDs which wrap around skip the running tracks, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTimelineTest, AnimatorTimelineTrackId_001, TestSize.Level1)
+{
+    AnimatorTimeline* timeline = AnimatorTimeline::GetInstance();
+    UIView* view = new UIView();
+    int16_t trackId = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_X, START_POS, END_POS, TIME,
+        EasingEquation::LinearEaseNone, true);
+    for (int32_t i = 0; i <= INT16_MAX; i++) {
+        int16_t id = timeline->AddTrack(view, AnimatorTimeline::PROPERTY_Y, START_POS, END_POS, TIME,
+            EasingEquation::LinearEaseNone);
+        EXPECT_NE(id, trackId);
+        timeline->RemoveTrack(id);
+    }
+    EXPECT_EQ(timeline->IsTrackRunning(trackId), true);
+    EXPECT_EQ(timeline->GetTrackNum(), 1);
+    delete view;
+}
+} // namespace OHOS
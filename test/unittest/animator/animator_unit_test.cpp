@@ -226,4 +226,41 @@ HWTEST_F(AnimatorTest, AnimatorManagerAddAndRemove_001, TestSize.Level0)
     delete callback;
     delete view;
 }
+
+/**
+ * @tc.name: AnimatorManagerRemove_001
+ * @tc.desc: Verify animators removed and added again while the animators are running, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatorTest, AnimatorManagerRemove_001, TestSize.Level1)
+{
+    UIView* view = new UIView();
+    auto first = new TestAnimatorCallback(view);
+    auto second = new TestAnimatorCallback(view);
+    if (!first->Init() || !second->Init()) {
+        EXPECT_NE(0, 0);
+        return;
+    }
+    Animator* animator = first->GetAnimator();
+    Animator* other = second->GetAnimator();
+    animator->Start();
+    other->Start();
+    animator->Start();
+    animator->Pause();
+    EXPECT_EQ(animator->GetState(), Animator::PAUSE);
+    animator->Resume();
+
+    other->SetRunTime(TIME);
+    AnimatorManager::GetInstance()->AnimatorTask();
+    EXPECT_EQ(other->GetState(), Animator::STOP);
+    EXPECT_EQ(animator->GetState(), Animator::START);
+
+    delete second;
+    other = nullptr;
+    animator->SetRunTime(TIME);
+    AnimatorManager::GetInstance()->AnimatorTask();
+    EXPECT_EQ(animator->GetState(), Animator::STOP);
+    delete first;
+    delete view;
+}
 } // namespace OHOS
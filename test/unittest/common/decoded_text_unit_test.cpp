@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/decoded_text.h"
+
+#include <gtest/gtest.h>
+#include "common/typed_text.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+/* ASCII runs longer than a block, two to four byte letters, a bad continuation and a sequence cut by the end */
+const char* MIXED_TEXT = "Hello, graphic world\n鸿蒙 OS 0123456789 \xF0\x9F\x98\x80 end\xC3(\xE9\xB8";
+} // namespace
+
+class DecodedTextTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: DecodedTextBuild_001
+ * @tc.desc: Verify the letters of a text are the ones TypedText::GetUTF8Next steps over, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DecodedTextTest, DecodedTextBuild_001, TestSize.Level0)
+{
+    DecodedText decodedText;
+    uint32_t byteNum = strlen(MIXED_TEXT);
+    EXPECT_TRUE(decodedText.Build(MIXED_TEXT, byteNum));
+    EXPECT_FALSE(decodedText.IsAscii());
+    EXPECT_EQ(decodedText.GetByteNum(), byteNum);
+    /* the last sequence lacks its last byte, it is one letter ending at the end of the text */
+    uint32_t cutByte = byteNum - 2; // 2: the two bytes of the cut sequence
+    EXPECT_EQ(decodedText.GetLetterNum(), TypedText::GetUTF8CharacterSize(MIXED_TEXT, cutByte) + 1);
+
+    uint32_t i = 0;
+    uint16_t letter = 0;
+    while (i < cutByte) {
+        EXPECT_EQ(decodedText.GetByteOffset(letter), i);
+        EXPECT_EQ(decodedText.GetLetterIndex(i), letter);
+        uint32_t next = 0;
+        EXPECT_EQ(decodedText.GetCodePoints()[letter], TypedText::GetUTF8Next(MIXED_TEXT, i, next));
+        for (uint32_t j = i + 1; j < next; j++) {
+            EXPECT_EQ(decodedText.GetLetterIndex(j), letter + 1);
+        }
+        i = next;
+        letter++;
+    }
+    EXPECT_EQ(decodedText.GetByteOffset(letter), cutByte);
+    EXPECT_EQ(decodedText.GetCodePoints()[letter], 0);
+    EXPECT_EQ(decodedText.GetByteOffset(letter + 1), byteNum);
+    EXPECT_EQ(decodedText.GetLetterIndex(byteNum), decodedText.GetLetterNum());
+}
+
+/**
+ * @tc.name: DecodedTextBuild_002
+ * @tc.desc: Verify an ASCII text keeps no byte offsets, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DecodedTextTest, DecodedTextBuild_002, TestSize.Level0)
+{
+    const char* text = "0123456789abcdefghijklmnopqrstuvwxyz";
+    DecodedText decodedText;
+    EXPECT_TRUE(decodedText.Build(text, strlen(text)));
+    EXPECT_TRUE(decodedText.IsAscii());
+    EXPECT_EQ(decodedText.GetLetterNum(), strlen(text));
+    for (uint16_t i = 0; i < decodedText.GetLetterNum(); i++) {
+        EXPECT_EQ(decodedText.GetCodePoints()[i], static_cast<uint32_t>(text[i]));
+        EXPECT_EQ(decodedText.GetByteOffset(i), i);
+        EXPECT_EQ(decodedText.GetLetterIndex(i), i);
+    }
+
+    EXPECT_FALSE(decodedText.Build("", 0));
+    EXPECT_EQ(decodedText.GetText(), nullptr);
+    EXPECT_EQ(decodedText.GetLetterNum(), 0);
+    EXPECT_EQ(decodedText.GetWidths(0, 0), nullptr);
+}
+
+/**
+ * @tc.name: DecodedTextGetTextWidth_001
+ * @tc.desc: Verify the width of a decoded text is the width of the text, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DecodedTextTest, DecodedTextGetTextWidth_001, TestSize.Level1)
+{
+    const char* text = "abc 鸿蒙 def\nghi";
+    DecodedText decodedText;
+    EXPECT_TRUE(decodedText.Build(text, strlen(text)));
+    const uint8_t letterSpace = 2;
+    for (uint16_t begin = 0; begin < decodedText.GetLetterNum(); begin++) {
+        uint16_t beginByte = decodedText.GetByteOffset(begin);
+        for (uint16_t end = begin + 1; end <= decodedText.GetLetterNum(); end++) {
+            uint16_t length = decodedText.GetByteOffset(end) - beginByte;
+            EXPECT_EQ(TypedText::GetTextWidth(decodedText, beginByte, 0, 0, length, letterSpace),
+                      TypedText::GetTextWidth(text + beginByte, 0, 0, length, letterSpace));
+        }
+    }
+}
+} // namespace OHOS
@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 
+#include "components/text_adapter.h"
 #include "components/ui_label.h"
+#include "components/ui_list.h"
 #include "dock/focus_manager.h"
 
 #include <climits>
@@ -142,5 +144,126 @@ HWTEST_F(FocusManagerTest, RequestFocusByDirection_001, TestSize.Level0)
     focusedView = FocusManager::GetInstance()->GetFocusedView();
     EXPECT_EQ(focusedView, label1_);
 }
+
+/**
+ * @tc.name: RequestFocusByDirection_002
+ * @tc.desc: Verify RequestFocusByDirection follows the views moved after the last request, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FocusManagerTest, RequestFocusByDirection_002, TestSize.Level1)
+{
+    FocusManager::GetInstance()->RequestFocus(label1_);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_RIGHT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), label2_);
+
+    label2_->SetPosition(0, 50); // 0: x, 50: y, left of label1_
+    FocusManager::GetInstance()->RequestFocus(label1_);
+    EXPECT_FALSE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_RIGHT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), label1_);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_LEFT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), label2_);
+    label2_->SetPosition(150, 150); // 150: x, 150: y
+}
+
+/**
+ * @tc.name: RequestFocusByDirection_003
+ * @tc.desc: Verify RequestFocusByDirection moves to the next tile of a grid, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FocusManagerTest, RequestFocusByDirection_003, TestSize.Level1)
+{
+    const uint8_t gridSize = 8;
+    const int16_t tileSize = 20;
+    UIViewGroup grid;
+    grid.SetPosition(0, 0, gridSize * tileSize, gridSize * tileSize);
+    UILabel tiles[gridSize][gridSize];
+    for (uint8_t row = 0; row < gridSize; row++) {
+        for (uint8_t col = 0; col < gridSize; col++) {
+            tiles[row][col].SetFocusable(true);
+            tiles[row][col].SetPosition(col * tileSize, row * tileSize, tileSize - 2, tileSize - 2); // 2: the gap
+            grid.Add(&tiles[row][col]);
+        }
+    }
+    FocusManager::GetInstance()->RequestFocus(&tiles[0][0]);
+    for (uint8_t i = 0; i < 3; i++) { // 3: three tiles to the right
+        EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_RIGHT));
+    }
+    for (uint8_t i = 0; i < 2; i++) { // 2: two tiles down
+        EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_DOWN));
+    }
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), &tiles[2][3]); // 2, 3: the row and the column
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_UP));
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_LEFT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), &tiles[1][2]); // 1, 2: the row and the column
+
+    FocusManager::GetInstance()->ClearFocus();
+    grid.RemoveAll();
+}
+
+/**
+ * @tc.name: RequestFocusByDirection_004
+ * @tc.desc: Verify RequestFocusByDirection follows the items of a scrolled list without building the index again.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FocusManagerTest, RequestFocusByDirection_004, TestSize.Level1)
+{
+    const int16_t itemSize = 20;
+    UIViewGroup screen;
+    screen.SetPosition(0, 0, 200, 100); // 200: width, 100: height
+    List<const char*> data;
+    data.PushBack("item0");
+    data.PushBack("item1");
+    data.PushBack("item2");
+    data.PushBack("item3");
+    TextAdapter adapter;
+    adapter.SetData(&data);
+    adapter.SetWidth(100); // 100: width
+    adapter.SetHeight(itemSize);
+    UIList list(UIList::VERTICAL);
+    list.SetPosition(0, 0, 100, 100); // 100: width, 100: height
+    list.SetAdapter(&adapter);
+    UIView* items[4] = {}; // 4: the number of items
+    uint8_t itemNum = 0;
+    for (UIView* item = list.GetChildrenHead(); (item != nullptr) && (itemNum < 4); item = item->GetNextSibling()) {
+        item->SetFocusable(true);
+        items[itemNum++] = item;
+    }
+    ASSERT_EQ(itemNum, 4); // 4: all the items fit in the list
+    UILabel side;
+    side.SetFocusable(true);
+    side.SetPosition(110, 0, itemSize, itemSize - 2); // 110: right of the list, 2: the gap
+    screen.Add(&list);
+    screen.Add(&side);
+
+    FocusManager::GetInstance()->RequestFocus(&side);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_LEFT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), items[0]);
+    uint32_t buildNum = FocusManager::GetIndexBuildNum();
+
+    /* the items in line with the side label change when the list scrolls */
+    list.MoveChildByOffset(0, -2 * itemSize); // 2: scroll by two items
+    FocusManager::GetInstance()->RequestFocus(&side);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_LEFT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), items[2]); // 2: the item scrolled to the top
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_DOWN));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), items[3]); // 3: the item below
+    list.MoveChildByOffset(0, itemSize);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_UP));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), items[2]); // 2: the item above
+    EXPECT_EQ(FocusManager::GetIndexBuildNum(), buildNum);
+
+    /* the views out of the tree do not touch the index, the ones in it do */
+    UILabel detached;
+    detached.SetPosition(10, 10, itemSize, itemSize); // 10: x, 10: y
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_DOWN));
+    EXPECT_EQ(FocusManager::GetIndexBuildNum(), buildNum);
+    side.SetY(itemSize);
+    EXPECT_TRUE(FocusManager::GetInstance()->RequestFocusByDirection(FOCUS_DIRECTION_RIGHT));
+    EXPECT_EQ(FocusManager::GetInstance()->GetFocusedView(), &side);
+    EXPECT_EQ(FocusManager::GetIndexBuildNum(), buildNum + 1);
+
+    FocusManager::GetInstance()->ClearFocus();
+    screen.RemoveAll();
+}
 } // namespace OHOS
 #endif
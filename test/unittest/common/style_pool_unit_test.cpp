@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/style_pool.h"
+
+#include <gtest/gtest.h>
+#include "components/ui_view.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const int16_t BORDER_WIDTH = 3;
+const uint8_t VIEW_NUM = 8;
+} // namespace
+
+class StylePoolTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: StylePoolShare_001
+ * @tc.desc: Verify views set to the same look share one style, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StylePoolTest, StylePoolShare_001, TestSize.Level0)
+{
+    StylePool::MemoryReport before = StylePool::GetInstance()->GetMemoryReport();
+    UIView* views = new UIView[VIEW_NUM];
+    for (uint8_t i = 0; i < VIEW_NUM; i++) {
+        views[i].SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+        views[i].SetStyle(STYLE_BORDER_WIDTH, BORDER_WIDTH);
+    }
+    for (uint8_t i = 1; i < VIEW_NUM; i++) {
+        EXPECT_EQ(&views[i].GetStyleConst(), &views[0].GetStyleConst());
+    }
+    StylePool::MemoryReport report = StylePool::GetInstance()->GetMemoryReport();
+    EXPECT_EQ(report.refNum - before.refNum, VIEW_NUM);
+    EXPECT_EQ(report.styleNum - before.styleNum, 1);
+    EXPECT_GT(report.savedBytes, before.savedBytes);
+
+    delete[] views;
+    report = StylePool::GetInstance()->GetMemoryReport();
+    EXPECT_EQ(report.refNum, before.refNum);
+    EXPECT_EQ(report.styleNum, before.styleNum);
+}
+
+/**
+ * @tc.name: StylePoolCopyOnWrite_001
+ * @tc.desc: Verify changing the shared style of a view leaves the other views alone, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StylePoolTest, StylePoolCopyOnWrite_001, TestSize.Level0)
+{
+    UIView view1;
+    UIView view2;
+    view1.SetStyle(STYLE_BORDER_WIDTH, BORDER_WIDTH);
+    view2.SetStyle(STYLE_BORDER_WIDTH, BORDER_WIDTH);
+    EXPECT_EQ(&view1.GetStyleConst(), &view2.GetStyleConst());
+    view1.SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+    view2.SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+
+    view2.SetStyle(STYLE_BACKGROUND_COLOR, Color::Blue().full);
+    EXPECT_NE(&view1.GetStyleConst(), &view2.GetStyleConst());
+    EXPECT_EQ(view1.GetStyle(STYLE_BACKGROUND_COLOR), Color::Red().full);
+    EXPECT_EQ(view2.GetStyle(STYLE_BACKGROUND_COLOR), Color::Blue().full);
+    EXPECT_EQ(view1.GetStyle(STYLE_BORDER_WIDTH), BORDER_WIDTH);
+    EXPECT_EQ(view2.GetStyle(STYLE_BORDER_WIDTH), BORDER_WIDTH);
+
+    /* back to the same look, back to the same style */
+    view2.SetStyle(STYLE_BACKGROUND_COLOR, Color::Red().full);
+    EXPECT_EQ(&view1.GetStyleConst(), &view2.GetStyleConst());
+}
+} // namespace OHOS
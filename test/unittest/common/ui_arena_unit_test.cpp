@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/ui_arena.h"
+
+#include <gtest/gtest.h>
+#include "components/ui_view.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint8_t VIEW_NUM = 16;
+const uint32_t PAGE_SIZE = 1024;
+const uint32_t BUFFER_SIZE = 100;
+using ArenaView = UIArenaView<UIView>;
+
+/* a view which is also a listener, created with new as before */
+class ListenerView : public UIView, public UIView::OnClickListener {};
+} // namespace
+
+class UIArenaTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+};
+
+/**
+ * @tc.name: UIArenaAllocate_001
+ * @tc.desc: Verify arena views created in the scope of an arena are allocated from it, and other views are not.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArenaTest, UIArenaAllocate_001, TestSize.Level0)
+{
+    UIArena arena(PAGE_SIZE);
+    UIView* views[VIEW_NUM];
+    {
+        UIArena::Scope scope(&arena);
+        EXPECT_EQ(UIArena::GetCurrent(), &arena);
+        for (uint8_t i = 0; i < VIEW_NUM; i++) {
+            views[i] = new ArenaView();
+            ASSERT_NE(views[i], nullptr);
+        }
+        UIView* view = new UIView();
+        delete view;
+        view = new ListenerView();
+        delete view;
+    }
+    EXPECT_EQ(UIArena::GetCurrent(), nullptr);
+    UIArena::Stats stats = arena.GetStats();
+    EXPECT_EQ(stats.allocNum, VIEW_NUM);
+    EXPECT_EQ(stats.liveNum, VIEW_NUM);
+    EXPECT_GE(stats.usedBytes, VIEW_NUM * sizeof(ArenaView));
+    EXPECT_GE(stats.reservedBytes, stats.usedBytes);
+    EXPECT_LT(stats.pageNum, VIEW_NUM);
+
+    /* outside the scope the arena views are allocated as before */
+    UIView* view = new ArenaView();
+    EXPECT_EQ(arena.GetStats().allocNum, VIEW_NUM);
+    delete view;
+
+    for (uint8_t i = 0; i < VIEW_NUM; i++) {
+        delete views[i];
+    }
+    stats = arena.GetStats();
+    EXPECT_EQ(stats.freeNum, VIEW_NUM);
+    EXPECT_EQ(stats.liveNum, 0);
+    EXPECT_EQ(stats.usedBytes, 0);
+    arena.ReleaseFreePages();
+    EXPECT_EQ(arena.GetStats().pageNum, 0);
+    EXPECT_EQ(arena.GetStats().reservedBytes, 0);
+}
+
+/**
+ * @tc.name: UIArenaAllocate_002
+ * @tc.desc: Verify the pages of an arena are reused once their objects are deleted, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArenaTest, UIArenaAllocate_002, TestSize.Level0)
+{
+    UIArena arena(PAGE_SIZE);
+    UIArena::Scope scope(&arena);
+    ArenaView* views = new ArenaView[VIEW_NUM];
+    ASSERT_NE(views, nullptr);
+    delete[] views;
+    uint32_t pageNum = arena.GetStats().pageNum;
+    views = new ArenaView[VIEW_NUM];
+    ASSERT_NE(views, nullptr);
+    EXPECT_EQ(arena.GetStats().pageNum, pageNum);
+    EXPECT_EQ(arena.GetStats().allocNum, 2); // 2: two arrays
+    delete[] views;
+
+    arena.ClearStats();
+    EXPECT_EQ(arena.GetStats().allocNum, 0);
+    EXPECT_EQ(arena.GetStats().pageNum, pageNum);
+}
+
+/**
+ * @tc.name: UIArenaAllocate_003
+ * @tc.desc: Verify the objects of an arena can be deleted after the arena, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArenaTest, UIArenaAllocate_003, TestSize.Level0)
+{
+    UIView* view = nullptr;
+    {
+        UIArena arena(PAGE_SIZE);
+        UIArena::Scope scope(&arena);
+        view = new ArenaView();
+        ASSERT_NE(view, nullptr);
+    }
+    view->SetWidth(BUFFER_SIZE);
+    EXPECT_EQ(view->GetWidth(), BUFFER_SIZE);
+    delete view;
+}
+
+/**
+ * @tc.name: UIFrameAllocatorReset_001
+ * @tc.desc: Verify the frame allocator grows to the size used by a frame, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArenaTest, UIFrameAllocatorReset_001, TestSize.Level0)
+{
+    UIFrameAllocator* allocator = UIFrameAllocator::GetInstance();
+    allocator->Reset();
+    UIFrameAllocator::Stats before = allocator->GetStats();
+    EXPECT_EQ(before.usedBytes, 0);
+
+    uint32_t size = before.capacity + BUFFER_SIZE;
+    uint8_t* buf1 = static_cast<uint8_t*>(allocator->Allocate(size));
+    uint8_t* buf2 = static_cast<uint8_t*>(allocator->Allocate(BUFFER_SIZE));
+    ASSERT_NE(buf1, nullptr);
+    ASSERT_NE(buf2, nullptr);
+    buf1[size - 1] = 0;
+    buf2[BUFFER_SIZE - 1] = 0;
+    UIFrameAllocator::Stats stats = allocator->GetStats();
+    EXPECT_GE(stats.overflowNum, before.overflowNum + 1);
+    EXPECT_EQ(stats.allocNum, before.allocNum + 2); // 2: two buffers
+    EXPECT_GE(stats.usedBytes, size + BUFFER_SIZE);
+    EXPECT_GE(stats.peakBytes, stats.usedBytes);
+
+    /* the next frame fits in the block */
+    allocator->Reset();
+    stats = allocator->GetStats();
+    EXPECT_EQ(stats.frameNum, before.frameNum + 1);
+    EXPECT_EQ(stats.usedBytes, 0);
+    EXPECT_GE(stats.capacity, size + BUFFER_SIZE);
+    EXPECT_NE(allocator->Allocate(size), nullptr);
+    EXPECT_NE(allocator->Allocate(BUFFER_SIZE), nullptr);
+    EXPECT_EQ(allocator->GetStats().overflowNum, stats.overflowNum);
+    allocator->Reset();
+}
+} // namespace OHOS
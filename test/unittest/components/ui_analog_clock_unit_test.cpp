@@ -266,4 +266,57 @@ HWTEST_F(UIAnalogClockTest, UIAnalogClockSetWorkMode_001, TestSize.Level1)
     clock_->SetWorkMode(UIAnalogClock::NORMAL);
     EXPECT_EQ(clock_->GetWorkMode(), UIAnalogClock::NORMAL);
 }
+
+/**
+ * @tc.name: UIAnalogClockSetHandSpriteCache_001
+ * @tc.desc: Verify the image hand drawn from its rotated copy looks the same as the rotated image, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIAnalogClockTest, UIAnalogClockSetHandSpriteCache_001, TestSize.Level0)
+{
+    const int16_t size = 64;
+    const int16_t handWidth = 4;
+    const int16_t handHeight = 24;
+    const uint8_t pxBytes = 4;
+    static uint8_t handData[handWidth * handHeight * pxBytes];
+    static uint8_t buffer1[size * size * pxBytes];
+    static uint8_t buffer2[size * size * pxBytes];
+    for (uint32_t i = 0; i < sizeof(handData); i++) {
+        handData[i] = UINT8_MAX;
+    }
+    ImageInfo imageInfo = {};
+    imageInfo.header.colorMode = ARGB8888;
+    imageInfo.header.width = handWidth;
+    imageInfo.header.height = handHeight;
+    imageInfo.dataSize = sizeof(handData);
+    imageInfo.data = handData;
+    UIImageView img;
+    img.SetSrc(&imageInfo);
+
+    UIAnalogClock clock;
+    clock.SetPosition(0, 0, size, size);
+    Point position = {30, 8}; // 30, 8: the hand points up from the center of the clock
+    Point center = {2, 24};   // 2, 24: the bottom center of the hand
+    clock.SetHandImage(UIAnalogClock::HandType::SECOND_HAND, img, position, center);
+    clock.SetInitTime24Hour(0, 0, 0);
+    clock.SetTime24Hour(0, 0, 10); // 10: the second hand at 60 degrees
+    EXPECT_FALSE(clock.IsHandSpriteCacheEnabled());
+
+    Rect rect(0, 0, size - 1, size - 1);
+    BufferInfo dst1{rect, size * pxBytes, nullptr, buffer1, size, size, ARGB8888, 0};
+    BufferInfo dst2{rect, size * pxBytes, nullptr, buffer2, size, size, ARGB8888, 0};
+    clock.OnPostDraw(dst1, rect);
+    clock.SetHandSpriteCache(true, 6); // 6: one copy for each second
+    EXPECT_TRUE(clock.IsHandSpriteCacheEnabled());
+    clock.OnPostDraw(dst2, rect);
+    EXPECT_GT(clock.GetHandSpriteCacheSize(), 0);
+    /* the copy is smaller than the box of the rotated hand */
+    EXPECT_LT(clock.GetHandSpriteCacheSize(), static_cast<uint32_t>(size) * size * pxBytes);
+    for (uint32_t i = 0; i < sizeof(buffer1); i++) {
+        ASSERT_LE(abs(buffer1[i] - buffer2[i]), 2); // 2: rounding of blending the copy
+    }
+
+    clock.SetHandSpriteCache(false);
+    EXPECT_EQ(clock.GetHandSpriteCacheSize(), 0);
+}
 }
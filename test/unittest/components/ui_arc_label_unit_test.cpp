@@ -17,10 +17,40 @@
 
 #include <climits>
 #include <gtest/gtest.h>
+#include "draw/rotated_glyph_cache.h"
+#include "securec.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
+namespace {
+const int16_t ARC_BUFFER_WIDTH = 64;
+const uint8_t ARC_PX_BYTES = 4;
+const uint32_t ARC_BUFFER_SIZE = ARC_BUFFER_WIDTH * ARC_BUFFER_WIDTH * ARC_PX_BYTES;
+
+void InitArcLabel(UIArcLabel& label)
+{
+    label.SetPosition(0, 0, ARC_BUFFER_WIDTH, ARC_BUFFER_WIDTH);
+    label.SetArcTextCenter(ARC_BUFFER_WIDTH / 2, ARC_BUFFER_WIDTH / 2); // 2: center of the buffer
+    label.SetArcTextRadius(ARC_BUFFER_WIDTH / 2 - 8);                   // 2, 8: inside the buffer
+    label.SetArcTextAngle(0, 270);                                       // 270: three quarters of a circle
+    label.SetStyle(STYLE_BACKGROUND_OPA, OPA_TRANSPARENT);
+    label.SetStyle(STYLE_TEXT_COLOR, Color::Red().full);
+    label.SetText("arc");
+    EXPECT_GE(label.GetWidth(), 0); // measures the arc text
+}
+
+/* draws the label over an opaque white background, as it is drawn over its parent */
+void DrawArcLabel(UIArcLabel& label, uint8_t* buffer)
+{
+    (void)memset_s(buffer, ARC_BUFFER_SIZE, UINT8_MAX, ARC_BUFFER_SIZE);
+    Rect rect(0, 0, ARC_BUFFER_WIDTH - 1, ARC_BUFFER_WIDTH - 1);
+    BufferInfo dst{rect, ARC_BUFFER_WIDTH * ARC_PX_BYTES, nullptr, buffer, ARC_BUFFER_WIDTH, ARC_BUFFER_WIDTH,
+                   ARGB8888, 0};
+    label.OnDraw(dst, rect);
+}
+} // namespace
+
 class UIArcLabelTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -229,4 +259,71 @@ HWTEST_F(UIArcLabelTest, UIArcLabelSetFontId_001, TestSize.Level1)
     arcLabel_->SetFontId(fontId);
     EXPECT_EQ(arcLabel_->GetFontId(), fontId);
 }
+
+/**
+ * @tc.name: UIArcLabelOnDraw_001
+ * @tc.desc: Verify the arc text drawn from the cached glyphs is the same as the text drawn through the transform,
+ *           equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelOnDraw_001, TestSize.Level0)
+{
+    static uint8_t buffer1[ARC_BUFFER_SIZE];
+    static uint8_t buffer2[ARC_BUFFER_SIZE];
+    static uint8_t buffer3[ARC_BUFFER_SIZE];
+    UIArcLabel label;
+    InitArcLabel(label);
+    RotatedGlyphCache& cache = RotatedGlyphCache::GetInstance();
+    cache.Clear();
+
+    DrawArcLabel(label, buffer1);
+    uint32_t hitNum = cache.GetStats().hitNum;
+    DrawArcLabel(label, buffer2);
+    EXPECT_GT(cache.GetStats().hitNum, hitNum);
+    cache.SetEnabled(false);
+    DrawArcLabel(label, buffer3);
+    cache.SetEnabled(true);
+
+    bool hasText = false;
+    for (uint32_t i = 0; i < ARC_BUFFER_SIZE; i++) {
+        ASSERT_EQ(buffer1[i], buffer2[i]);
+        ASSERT_LE(abs(buffer2[i] - buffer3[i]), 2); // 2: rounding of blending the cached glyph
+        hasText = hasText || (buffer3[i] != UINT8_MAX);
+    }
+    EXPECT_TRUE(hasText);
+}
+
+/**
+ * @tc.name: UIArcLabelSetStyle_001
+ * @tc.desc: Verify the cached arc text layout is rebuilt when the letter space is set with a new style, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIArcLabelTest, UIArcLabelSetStyle_001, TestSize.Level1)
+{
+    static uint8_t buffer1[ARC_BUFFER_SIZE];
+    static uint8_t buffer2[ARC_BUFFER_SIZE];
+    static uint8_t buffer3[ARC_BUFFER_SIZE];
+    const int16_t letterSpace = 6;
+    Style style; // outlives the labels which use it
+    UIArcLabel label;
+    InitArcLabel(label);
+    DrawArcLabel(label, buffer1);
+
+    style = label.GetStyleConst();
+    style.letterSpace_ = letterSpace;
+    label.SetStyle(style);
+    DrawArcLabel(label, buffer2);
+
+    UIArcLabel spacedLabel;
+    spacedLabel.SetStyle(style);
+    InitArcLabel(spacedLabel);
+    DrawArcLabel(spacedLabel, buffer3);
+
+    bool changed = false;
+    for (uint32_t i = 0; i < ARC_BUFFER_SIZE; i++) {
+        ASSERT_EQ(buffer2[i], buffer3[i]);
+        changed = changed || (buffer1[i] != buffer2[i]);
+    }
+    EXPECT_TRUE(changed);
+}
 }
@@ -15,15 +15,38 @@
 
 #include "components/ui_image_view.h"
 #include <climits>
+#include <cstdio>
 #include <gtest/gtest.h>
+#include <unistd.h>
 #include "components/root_view.h"
 #include "components/ui_view_group.h"
 #include "draw/draw_utils.h"
+#include "imgdecode/image_decode_service.h"
 #include "test_resource_config.h"
 
 using namespace testing::ext;
 
 namespace OHOS {
+namespace {
+#if ENABLE_ASYNC_IMAGE_DECODE
+const char* BROKEN_IMAGE_PATH = "./ui_image_view_test.png";
+const uint16_t WAIT_LOOP_NUM = 2000;
+const uint32_t WAIT_INTERVAL = 1000; // 1000: 1ms in microseconds
+
+/* runs the task of the decode service as the task handler would, until the view is not decoding or it times out */
+void WaitAsyncDecode(const UIImageView* view)
+{
+    for (uint16_t i = 0; i < WAIT_LOOP_NUM; i++) {
+        ImageDecodeService::GetInstance()->Callback();
+        if (view->GetAsyncDecodeState() != UIImageView::ASYNC_DECODE_PENDING) {
+            return;
+        }
+        usleep(WAIT_INTERVAL);
+    }
+}
+#endif
+} // namespace
+
 class UIImageViewTest : public testing::Test {
 public:
     UIImageViewTest() : imageView_(nullptr) {}
@@ -538,4 +561,91 @@ HWTEST_F(UIImageViewTest, UIImageViewSetResizeMode_001, TestSize.Level0)
     imageView_->SetResizeMode(mode);
     EXPECT_EQ(imageView_->GetResizeMode(), mode); // 0 : IMG_SRC_VARIABLE 1 : IMG_SRC_FILE 2 : IMG_SRC_UNKNOWN
 }
+
+#if ENABLE_ASYNC_IMAGE_DECODE
+/**
+ * @tc.name: UIImageViewAsyncDecode_001
+ * @tc.desc: Verify the placeholder is shown until the decoded image is set, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIImageViewTest, UIImageViewAsyncDecode_001, TestSize.Level1)
+{
+    if (imageView_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    imageView_->SetAsyncDecode(true);
+    imageView_->SetSrc(BLUE_IMAGE_PATH);
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_PENDING);
+    WaitAsyncDecode(imageView_);
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_DONE);
+    EXPECT_EQ(imageView_->GetSrcType(), IMG_SRC_VARIABLE);
+    EXPECT_GT(imageView_->GetWidth(), 0);
+
+    // a new source cancels the decoding of the old one
+    imageView_->SetSrc(BLUE_IMAGE_PATH);
+    imageView_->SetSrc(static_cast<const ImageInfo*>(nullptr));
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_NONE);
+}
+
+/**
+ * @tc.name: UIImageViewAsyncDecode_002
+ * @tc.desc: Verify the decoding of a removed view resumes when the view is added again, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIImageViewTest, UIImageViewAsyncDecode_002, TestSize.Level1)
+{
+    if (imageView_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    UIViewGroup group;
+    group.Add(imageView_);
+    imageView_->SetAsyncDecode(true);
+    imageView_->SetSrc(BLUE_IMAGE_PATH);
+    group.Remove(imageView_);
+    WaitAsyncDecode(imageView_);
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_PENDING);
+
+    group.Add(imageView_);
+    WaitAsyncDecode(imageView_);
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_DONE);
+    EXPECT_EQ(imageView_->GetSrcType(), IMG_SRC_VARIABLE);
+    group.Remove(imageView_);
+}
+
+/**
+ * @tc.name: UIImageViewAsyncDecode_003
+ * @tc.desc: Verify a file which fails to be decoded is reported and keeps the placeholder, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIImageViewTest, UIImageViewAsyncDecode_003, TestSize.Level1)
+{
+    if (imageView_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    // a PNG signature followed by no valid chunk
+    const uint8_t data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x01, 0x02, 0x03};
+    FILE* file = fopen(BROKEN_IMAGE_PATH, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(data, 1, sizeof(data), file);
+    fclose(file);
+
+    uint32_t pixel = 0;
+    ImageInfo placeholder = {};
+    placeholder.header.colorMode = ARGB8888;
+    placeholder.header.width = 1;
+    placeholder.header.height = 1;
+    placeholder.dataSize = sizeof(pixel);
+    placeholder.data = reinterpret_cast<uint8_t*>(&pixel);
+    imageView_->SetPlaceholder(&placeholder);
+    imageView_->SetAsyncDecode(true);
+    imageView_->SetSrc(BROKEN_IMAGE_PATH);
+    WaitAsyncDecode(imageView_);
+    EXPECT_EQ(imageView_->GetAsyncDecodeState(), UIImageView::ASYNC_DECODE_FAILED);
+    EXPECT_EQ(imageView_->GetImageInfo(), &placeholder);
+    remove(BROKEN_IMAGE_PATH);
+}
+#endif
 } // namespace OHOS
@@ -18,6 +18,7 @@
 #include <climits>
 #include <gtest/gtest.h>
 #include "font/ui_font.h"
+#include "securec.h"
 
 using namespace testing::ext;
 namespace OHOS {
@@ -351,4 +352,71 @@ HWTEST_F(UILabelTest, UILabelSetSize_001, TestSize.Level0)
     label_->SetHeight(0);
     EXPECT_EQ(label_->GetHeight(), 0);
 }
+
+/**
+ * @tc.name: UILabelSetMarqueeCacheEnable_001
+ * @tc.desc: Verify SetMarqueeCacheEnable function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UILabelTest, UILabelSetMarqueeCacheEnable_001, TestSize.Level0)
+{
+    if (label_ == nullptr) {
+        EXPECT_EQ(1, 0);
+        return;
+    }
+    EXPECT_FALSE(label_->IsMarqueeCacheEnabled());
+    label_->SetLineBreakMode(UILabel::LINE_BREAK_MARQUEE);
+    label_->SetMarqueeCacheEnable(true);
+    EXPECT_TRUE(label_->IsMarqueeCacheEnabled());
+    label_->SetText("marquee text");
+    EXPECT_TRUE(label_->IsMarqueeCacheEnabled());
+    label_->SetMarqueeCacheEnable(false);
+    EXPECT_FALSE(label_->IsMarqueeCacheEnabled());
+    label_->SetLineBreakMode(UILabel::LINE_BREAK_ELLIPSIS);
+}
+
+/**
+ * @tc.name: UILabelSetMarqueeCacheEnable_002
+ * @tc.desc: Verify a scrolled marquee frame drawn from the strip looks the same as the text drawn directly, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UILabelTest, UILabelSetMarqueeCacheEnable_002, TestSize.Level0)
+{
+    const int16_t width = 64;
+    const int16_t height = 32;
+    const uint8_t pxBytes = 4;
+    static uint8_t buffer1[width * height * pxBytes];
+    static uint8_t buffer2[width * height * pxBytes];
+
+    UILabel label;
+    label.SetPosition(0, 0, width, height);
+#if defined(ENABLE_VECTOR_FONT) && ENABLE_VECTOR_FONT
+    label.SetFont(DEFAULT_VECTOR_FONT_FILENAME, 18); // 18: font size
+#endif
+    label.SetStyle(STYLE_BACKGROUND_OPA, OPA_TRANSPARENT);
+    label.SetTextColor(Color::Red());
+    label.SetLineBreakMode(UILabel::LINE_BREAK_MARQUEE);
+    label.SetRollStartPos(-13); // -13: a frame in the middle of the scroll
+    label.SetText("marquee text scrolled in the label");
+    label.ReMeasure();
+    ASSERT_GT(label.GetTextWidth(), width);
+
+    /* an opaque white background, as the label is drawn over its parent */
+    (void)memset_s(buffer1, sizeof(buffer1), UINT8_MAX, sizeof(buffer1));
+    (void)memset_s(buffer2, sizeof(buffer2), UINT8_MAX, sizeof(buffer2));
+    Rect rect(0, 0, width - 1, height - 1);
+    BufferInfo dst1{rect, width * pxBytes, nullptr, buffer1, width, height, ARGB8888, 0};
+    BufferInfo dst2{rect, width * pxBytes, nullptr, buffer2, width, height, ARGB8888, 0};
+    label.OnDraw(dst1, rect);
+    label.SetMarqueeCacheEnable(true);
+    label.OnDraw(dst2, rect);
+    label.SetMarqueeCacheEnable(false);
+
+    bool hasText = false;
+    for (uint32_t i = 0; i < sizeof(buffer1); i++) {
+        ASSERT_LE(abs(buffer1[i] - buffer2[i]), 2); // 2: rounding of blending the strip
+        hasText = hasText || (buffer1[i] != UINT8_MAX);
+    }
+    EXPECT_TRUE(hasText);
+}
 } // namespace OHOS
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_dump_dom_tree.h"
+
+#if ENABLE_DEBUG
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "common/graphic_startup.h"
+#include "components/root_view.h"
+#include "components/ui_label.h"
+#include "components/ui_view_group.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint16_t DUMP_BUFFER_SIZE = 2048;
+const char* const GROUP_ID = "dumpGroup";
+const char* const LABEL_ID = "dumpLabel";
+const char* const VIEW_ID = "dumpView";
+} // namespace
+
+class UIDumpDomTreeTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GraphicStartUp::Init();
+    }
+
+    static void TearDownTestCase() {}
+
+    void SetUp()
+    {
+        group_ = new UIViewGroup();
+        group_->SetViewId(GROUP_ID);
+        group_->SetPosition(0, 0, 200, 200); // 200: width and height
+        label_ = new UILabel();
+        label_->SetViewId(LABEL_ID);
+        label_->SetPosition(0, 0, 100, 50); // 100: width, 50: height
+        label_->SetText("hello");
+        view_ = new UIView();
+        view_->SetViewId(VIEW_ID);
+        view_->SetPosition(0, 100, 50, 50); // 100: y, 50: width and height
+        group_->Add(label_);
+        group_->Add(view_);
+        RootView::GetInstance()->Add(group_);
+    }
+
+    void TearDown()
+    {
+        UIDumpDomTree::GetInstance()->SetIncrementalMode(false);
+        RootView::GetInstance()->Remove(group_);
+        group_->RemoveAll();
+        delete view_;
+        delete label_;
+        delete group_;
+    }
+
+    int32_t Dump()
+    {
+        return UIDumpDomTree::GetInstance()->DumpDomTreeToBuffer(GROUP_ID, buf_, sizeof(buf_));
+    }
+
+    bool Contains(const char* str) const
+    {
+        return strstr(buf_, str) != nullptr;
+    }
+
+    UIViewGroup* group_ = nullptr;
+    UILabel* label_ = nullptr;
+    UIView* view_ = nullptr;
+    char buf_[DUMP_BUFFER_SIZE] = {0};
+};
+
+/**
+ * @tc.name: DumpDomTreeToBuffer_001
+ * @tc.desc: Verify the DOM tree is written into a bounded buffer, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIDumpDomTreeTest, DumpDomTreeToBuffer_001, TestSize.Level0)
+{
+    int32_t length = Dump();
+    ASSERT_GT(length, 0);
+    EXPECT_EQ(static_cast<uint32_t>(length), strlen(buf_));
+    EXPECT_EQ(buf_[0], '{');
+    EXPECT_EQ(buf_[length - 1], '}');
+    EXPECT_TRUE(Contains("\"id\":\"dumpGroup\""));
+    EXPECT_TRUE(Contains("\"child\":[{\"name\":\"UILabel\""));
+    EXPECT_TRUE(Contains("\"text\":\"hello\""));
+    EXPECT_TRUE(Contains("\"id\":\"dumpView\""));
+
+    char* node = UIDumpDomTree::GetInstance()->DumpDomNode(LABEL_ID);
+    ASSERT_NE(node, nullptr);
+    EXPECT_TRUE(Contains(node));
+    cJSON_free(node);
+
+    char small[16]; // 16: too small for the tree
+    EXPECT_EQ(UIDumpDomTree::GetInstance()->DumpDomTreeToBuffer(GROUP_ID, small, sizeof(small)), -1);
+    EXPECT_EQ(UIDumpDomTree::GetInstance()->DumpDomTreeToBuffer("notExist", buf_, sizeof(buf_)), -1);
+}
+
+/**
+ * @tc.name: DumpDomTreeIncremental_001
+ * @tc.desc: Verify the incremental mode only dumps the changed subtrees, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIDumpDomTreeTest, DumpDomTreeIncremental_001, TestSize.Level0)
+{
+    UIDumpDomTree::GetInstance()->SetIncrementalMode(true);
+    EXPECT_TRUE(UIDumpDomTree::GetInstance()->IsIncrementalMode());
+    ASSERT_GT(Dump(), 0);
+    EXPECT_TRUE(Contains("\"id\":\"dumpGroup\""));
+    EXPECT_TRUE(Contains("\"id\":\"dumpLabel\""));
+
+    ASSERT_GT(Dump(), 0);
+    EXPECT_STREQ(buf_, "{\"changed\":[]}");
+
+    label_->SetText("world");
+    ASSERT_GT(Dump(), 0);
+    EXPECT_TRUE(Contains("\"parentId\":\"dumpGroup\""));
+    EXPECT_TRUE(Contains("\"text\":\"world\""));
+    EXPECT_FALSE(Contains("\"id\":\"dumpView\""));
+
+    group_->Remove(view_);
+    ASSERT_GT(Dump(), 0);
+    EXPECT_TRUE(Contains("\"id\":\"dumpGroup\""));
+    EXPECT_FALSE(Contains("\"id\":\"dumpView\""));
+
+    ASSERT_GT(Dump(), 0);
+    EXPECT_STREQ(buf_, "{\"changed\":[]}");
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_render_trace.h"
+
+#if ENABLE_DEBUG
+#include <cstdio>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "components/ui_label.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* TRACE_PATH = "./ui_render_trace_test.json";
+const uint32_t EVENT_NUM = 4;
+const uint16_t READ_BUFFER_SIZE = 4096;
+} // namespace
+
+class UIRenderTraceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void)
+    {
+        UIRenderTrace::GetInstance()->Stop();
+        remove(TRACE_PATH);
+    }
+
+    static uint32_t ReadTrace(char* buf, uint32_t size)
+    {
+        FILE* file = fopen(TRACE_PATH, "rb");
+        if (file == nullptr) {
+            return 0;
+        }
+        size_t len = fread(buf, 1, size - 1, file);
+        buf[len] = '\0';
+        fclose(file);
+        return static_cast<uint32_t>(len);
+    }
+
+    static uint32_t CountOf(const char* buf, const char* word)
+    {
+        uint32_t count = 0;
+        const char* pos = strstr(buf, word);
+        while (pos != nullptr) {
+            count++;
+            pos = strstr(pos + 1, word);
+        }
+        return count;
+    }
+};
+
+/**
+ * @tc.name: UIRenderTraceStart_001
+ * @tc.desc: Verify Start and Stop function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIRenderTraceTest, UIRenderTraceStart_001, TestSize.Level0)
+{
+    UIRenderTrace* trace = UIRenderTrace::GetInstance();
+    EXPECT_EQ(trace->Start(0), false);
+    EXPECT_EQ(trace->Start(EVENT_NUM), true);
+    EXPECT_EQ(UIRenderTrace::IsTracing(), true);
+    EXPECT_EQ(trace->GetFrameIndex(), 0);
+    UI_RENDER_TRACE_FRAME();
+    EXPECT_EQ(trace->GetFrameIndex(), 1);
+    trace->Stop();
+    EXPECT_EQ(UIRenderTrace::IsTracing(), false);
+}
+
+/**
+ * @tc.name: UIRenderTraceDumpTrace_001
+ * @tc.desc: Verify DumpTrace function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIRenderTraceTest, UIRenderTraceDumpTrace_001, TestSize.Level1)
+{
+    UIRenderTrace* trace = UIRenderTrace::GetInstance();
+    UILabel label;
+    ASSERT_EQ(trace->Start(EVENT_NUM), true);
+    UI_RENDER_TRACE_FRAME();
+    {
+        UI_RENDER_TRACE_SCOPE("Measure");
+    }
+    {
+        UI_RENDER_TRACE_VIEW_SCOPE("OnDraw", &label);
+    }
+    UI_RENDER_TRACE_FRAME();
+    {
+        UI_RENDER_TRACE_SCOPE("DrawTop");
+    }
+    trace->Stop();
+    {
+        // not recorded once stopped
+        UI_RENDER_TRACE_SCOPE("Stopped");
+    }
+
+    char buf[READ_BUFFER_SIZE];
+    ASSERT_EQ(trace->DumpTrace(TRACE_PATH), true);
+    ASSERT_NE(ReadTrace(buf, READ_BUFFER_SIZE), 0);
+    EXPECT_EQ(strncmp(buf, "{\"traceEvents\":[", strlen("{\"traceEvents\":[")), 0);
+    EXPECT_EQ(CountOf(buf, "\"ph\":\"X\""), 3); // 3: records of the three scopes
+    EXPECT_NE(strstr(buf, "\"name\":\"UILabel::OnDraw\""), nullptr);
+    EXPECT_EQ(strstr(buf, "Stopped"), nullptr);
+
+    ASSERT_EQ(trace->DumpTrace(TRACE_PATH, 2, 2), true); // 2: the second frame only
+    ASSERT_NE(ReadTrace(buf, READ_BUFFER_SIZE), 0);
+    EXPECT_EQ(CountOf(buf, "\"ph\":\"X\""), 1);
+    EXPECT_NE(strstr(buf, "\"name\":\"DrawTop\""), nullptr);
+}
+
+/**
+ * @tc.name: UIRenderTraceDumpTrace_002
+ * @tc.desc: Verify the oldest records are overwritten, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIRenderTraceTest, UIRenderTraceDumpTrace_002, TestSize.Level1)
+{
+    UIRenderTrace* trace = UIRenderTrace::GetInstance();
+    ASSERT_EQ(trace->Start(EVENT_NUM), true);
+    {
+        UI_RENDER_TRACE_SCOPE("Oldest");
+    }
+    for (uint32_t i = 0; i < EVENT_NUM; i++) {
+        UI_RENDER_TRACE_SCOPE("Newer");
+    }
+    trace->Stop();
+
+    char buf[READ_BUFFER_SIZE];
+    ASSERT_EQ(trace->DumpTrace(TRACE_PATH), true);
+    ASSERT_NE(ReadTrace(buf, READ_BUFFER_SIZE), 0);
+    EXPECT_EQ(CountOf(buf, "\"ph\":\"X\""), EVENT_NUM);
+    EXPECT_EQ(strstr(buf, "Oldest"), nullptr);
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfx/ui_screenshot.h"
+
+#if ENABLE_DEBUG
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "engines/gfx/soft_engine.h"
+#include "gfx_utils/image_info.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* SCREENSHOT_PATH = "./ui_screenshot_test.bin";
+const uint8_t PX_BYTES = 4;
+const uint8_t RGB565_BYTES = 2;
+const int16_t SCREEN_SIZE = 16;
+const Rect CAPTURE_RECT(2, 3, 9, 7); // 2, 3, 9, 7: an area inside the screen
+const int16_t CAPTURE_WIDTH = 8;
+const int16_t CAPTURE_HEIGHT = 5;
+
+class CaptureTestEngine : public SoftEngine {
+public:
+    BufferInfo* GetFBBufferInfo() override
+    {
+        return &fbBufferInfo_;
+    }
+
+    BufferInfo fbBufferInfo_ {};
+};
+} // namespace
+
+class UIScreenshotTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        oldEngine_ = BaseGfxEngine::GetInstance();
+        BaseGfxEngine::InitGfxEngine(&engine_);
+    }
+    static void TearDownTestCase(void)
+    {
+        BaseGfxEngine::InitGfxEngine(oldEngine_);
+        remove(SCREENSHOT_PATH);
+    }
+
+    void SetFBBuffer(ColorMode mode, uint8_t pxBytes)
+    {
+        for (uint32_t i = 0; i < sizeof(screen_); i++) {
+            screen_[i] = static_cast<uint8_t>(i);
+        }
+        BufferInfo& info = engine_.fbBufferInfo_;
+        info.rect = Rect(0, 0, SCREEN_SIZE - 1, SCREEN_SIZE - 1);
+        info.stride = SCREEN_SIZE * pxBytes;
+        info.virAddr = screen_;
+        info.width = SCREEN_SIZE;
+        info.height = SCREEN_SIZE;
+        info.mode = mode;
+    }
+
+    bool ReadScreenshot(ImageHeader& header, uint32_t* pixels)
+    {
+        FILE* file = fopen(SCREENSHOT_PATH, "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        bool ret = (fread(&header, sizeof(header), 1, file) == 1) &&
+                   (fread(pixels, PX_BYTES, CAPTURE_WIDTH * CAPTURE_HEIGHT, file) == CAPTURE_WIDTH * CAPTURE_HEIGHT);
+        fclose(file);
+        return ret;
+    }
+
+    static BaseGfxEngine* oldEngine_;
+    static CaptureTestEngine engine_;
+    uint8_t screen_[SCREEN_SIZE * SCREEN_SIZE * PX_BYTES];
+};
+
+BaseGfxEngine* UIScreenshotTest::oldEngine_ = nullptr;
+CaptureTestEngine UIScreenshotTest::engine_;
+
+/**
+ * @tc.name: ScreenshotRectToFile_001
+ * @tc.desc: Verify an area of an ARGB8888 framebuffer is saved as it is, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIScreenshotTest, ScreenshotRectToFile_001, TestSize.Level0)
+{
+    SetFBBuffer(ARGB8888, PX_BYTES);
+    EXPECT_TRUE(UIScreenshot::GetInstance()->ScreenshotRectToFile(CAPTURE_RECT, SCREENSHOT_PATH));
+    UIScreenshot::GetInstance()->WaitCaptureFinished();
+
+    ImageHeader header;
+    uint32_t pixels[CAPTURE_WIDTH * CAPTURE_HEIGHT];
+    ASSERT_TRUE(ReadScreenshot(header, pixels));
+    EXPECT_EQ(header.colorMode, ARGB8888);
+    EXPECT_EQ(header.width, CAPTURE_WIDTH);
+    EXPECT_EQ(header.height, CAPTURE_HEIGHT);
+    const uint32_t* screen = reinterpret_cast<const uint32_t*>(screen_);
+    for (int16_t y = 0; y < CAPTURE_HEIGHT; y++) {
+        for (int16_t x = 0; x < CAPTURE_WIDTH; x++) {
+            uint32_t expect = screen[(y + CAPTURE_RECT.GetTop()) * SCREEN_SIZE + x + CAPTURE_RECT.GetLeft()];
+            EXPECT_EQ(pixels[y * CAPTURE_WIDTH + x], expect);
+        }
+    }
+}
+
+/**
+ * @tc.name: ScreenshotRectToFile_002
+ * @tc.desc: Verify an area of an RGB565 framebuffer is converted to opaque ARGB8888, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIScreenshotTest, ScreenshotRectToFile_002, TestSize.Level0)
+{
+    SetFBBuffer(RGB565, RGB565_BYTES);
+    const uint16_t white = 0xFFFF;
+    uint16_t* screen = reinterpret_cast<uint16_t*>(screen_);
+    screen[CAPTURE_RECT.GetTop() * SCREEN_SIZE + CAPTURE_RECT.GetLeft()] = white;
+    EXPECT_TRUE(UIScreenshot::GetInstance()->ScreenshotRectToFile(CAPTURE_RECT, SCREENSHOT_PATH));
+    UIScreenshot::GetInstance()->WaitCaptureFinished();
+
+    ImageHeader header;
+    uint32_t pixels[CAPTURE_WIDTH * CAPTURE_HEIGHT];
+    ASSERT_TRUE(ReadScreenshot(header, pixels));
+    EXPECT_EQ(pixels[0], 0xFFFFFFFF);
+    for (uint16_t i = 0; i < CAPTURE_WIDTH * CAPTURE_HEIGHT; i++) {
+        EXPECT_EQ(pixels[i] >> 24, OPA_OPAQUE); // 24: alpha channel
+    }
+}
+
+/**
+ * @tc.name: ScreenshotRectToFile_003
+ * @tc.desc: Verify an area outside the screen is not captured, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIScreenshotTest, ScreenshotRectToFile_003, TestSize.Level0)
+{
+    SetFBBuffer(ARGB8888, PX_BYTES);
+    Rect outside(SCREEN_SIZE, SCREEN_SIZE, SCREEN_SIZE + CAPTURE_WIDTH, SCREEN_SIZE + CAPTURE_HEIGHT);
+    EXPECT_FALSE(UIScreenshot::GetInstance()->ScreenshotRectToFile(outside, SCREENSHOT_PATH));
+    EXPECT_EQ(UIScreenshot::GetInstance()->GetDroppedCaptureNum(), 0);
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/draw_rect.h"
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "engines/gfx/soft_engine.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint8_t PX_BYTES = 4;
+const int16_t BUFFER_SIZE = 64;
+const int16_t RECT_MARGIN = 4;
+const int16_t RADIUS = 12;
+const int16_t BORDER_WIDTH = 3;
+const uint16_t DRAW_TIMES = 1000;
+} // namespace
+
+class DrawRectTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            static SoftEngine softEngine;
+            BaseGfxEngine::InitGfxEngine(&softEngine);
+        }
+    }
+    static void TearDownTestCase(void)
+    {
+        DrawRect::ClearCornerMasks();
+    }
+
+    void SetUp()
+    {
+        for (uint32_t i = 0; i < sizeof(buffer_); i++) {
+            buffer_[i] = 0;
+        }
+        style_.bgColor_ = Color::Red();
+        style_.bgOpa_ = OPA_OPAQUE;
+        style_.borderColor_ = Color::Blue();
+        style_.borderOpa_ = OPA_OPAQUE;
+        style_.borderRadius_ = RADIUS;
+        style_.borderWidth_ = BORDER_WIDTH;
+    }
+
+    void DrawCard()
+    {
+        Rect rect(RECT_MARGIN, RECT_MARGIN, BUFFER_SIZE - RECT_MARGIN - 1, BUFFER_SIZE - RECT_MARGIN - 1);
+        Rect mask(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+        BufferInfo dst{mask, BUFFER_SIZE * PX_BYTES, nullptr, buffer_, BUFFER_SIZE, BUFFER_SIZE, ARGB8888, 0};
+        DrawRect::Draw(dst, rect, mask, style_, OPA_OPAQUE);
+    }
+
+    Color32 GetPixel(int16_t x, int16_t y) const
+    {
+        Color32 color;
+        color.full = *reinterpret_cast<const uint32_t*>(&buffer_[(y * BUFFER_SIZE + x) * PX_BYTES]);
+        return color;
+    }
+
+    Style style_;
+    uint8_t buffer_[BUFFER_SIZE * BUFFER_SIZE * PX_BYTES];
+};
+
+/**
+ * @tc.name: DrawRectCornerMask_001
+ * @tc.desc: Verify the corners of a rounded rect with border drawn by the corner masks, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawRectTest, DrawRectCornerMask_001, TestSize.Level0)
+{
+    DrawCard();
+
+    const int16_t center = BUFFER_SIZE / 2; // 2: half
+    const int16_t last = BUFFER_SIZE - RECT_MARGIN - 1;
+    EXPECT_EQ(GetPixel(center, center).full, Color::ColorTo32(Color::Red()));
+    EXPECT_EQ(GetPixel(RECT_MARGIN, center).full, Color::ColorTo32(Color::Blue()));
+    EXPECT_EQ(GetPixel(center, last).full, Color::ColorTo32(Color::Blue()));
+    /* outside the curve of the corners */
+    EXPECT_EQ(GetPixel(RECT_MARGIN, RECT_MARGIN).alpha, OPA_TRANSPARENT);
+    EXPECT_EQ(GetPixel(last, last).alpha, OPA_TRANSPARENT);
+    /* inside the curve of the corners */
+    const int16_t inner = RECT_MARGIN + RADIUS;
+    EXPECT_EQ(GetPixel(inner, inner).full, Color::ColorTo32(Color::Red()));
+    EXPECT_EQ(GetPixel(last - RADIUS, last - RADIUS).full, Color::ColorTo32(Color::Red()));
+
+    /* the four corners are mirrored */
+    for (int16_t y = RECT_MARGIN; y < inner; y++) {
+        for (int16_t x = RECT_MARGIN; x < inner; x++) {
+            int16_t mirrorX = BUFFER_SIZE - 1 - x;
+            int16_t mirrorY = BUFFER_SIZE - 1 - y;
+            EXPECT_EQ(GetPixel(x, y).full, GetPixel(mirrorX, y).full);
+            EXPECT_EQ(GetPixel(x, y).full, GetPixel(x, mirrorY).full);
+            EXPECT_EQ(GetPixel(x, y).full, GetPixel(mirrorX, mirrorY).full);
+        }
+    }
+}
+
+/**
+ * @tc.name: DrawRectCornerMask_002
+ * @tc.desc: Benchmark of drawing a rounded rect with border repeatedly, equal.
+ * @tc.type: PERF
+ */
+HWTEST_F(DrawRectTest, DrawRectCornerMask_002, TestSize.Level1)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint16_t i = 0; i < DRAW_TIMES; i++) {
+        DrawCard();
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    printf("DrawRectCornerMask: %u rounded rects of %ux%u, %lld us per rect\n", DRAW_TIMES, BUFFER_SIZE,
+           BUFFER_SIZE, static_cast<long long>(cost.count() / DRAW_TIMES));
+    EXPECT_EQ(GetPixel(BUFFER_SIZE / 2, BUFFER_SIZE / 2).full, Color::ColorTo32(Color::Red())); // 2: center
+}
+} // namespace OHOS
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "draw/draw_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint8_t PX_BYTES = 4;
+const uint16_t IMAGE_SIZE = 64;
+const uint16_t BUFFER_SIZE = 128;
+const int16_t IMAGE_POS = (BUFFER_SIZE - IMAGE_SIZE) / 2;
+const uint8_t IMAGE_VALUE = 200;
+const int16_t ROTATE_STEP = 3;
+const int16_t ROUND_ANGLE = 360;
+} // namespace
+
+class DrawTransformTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    void SetUp()
+    {
+        for (uint32_t i = 0; i < sizeof(image_); i++) {
+            image_[i] = IMAGE_VALUE;
+        }
+        // opaque pixels, so the partly covered pixels are those on the border of the image
+        for (uint32_t i = PX_BYTES - 1; i < sizeof(image_); i += PX_BYTES) {
+            image_[i] = OPA_OPAQUE;
+        }
+        ClearBuffer();
+    }
+
+    void ClearBuffer()
+    {
+        for (uint32_t i = 0; i < sizeof(buffer_); i++) {
+            buffer_[i] = 0;
+        }
+    }
+
+    void DrawRotated(int16_t angle)
+    {
+        Rect rect(0, 0, IMAGE_SIZE - 1, IMAGE_SIZE - 1);
+        TransformMap transMap(rect);
+        transMap.Rotate(angle, Vector2<float>(IMAGE_SIZE / 2, IMAGE_SIZE / 2)); // 2: rotate around the center
+        ImageHeader header = {};
+        header.colorMode = ARGB8888;
+        header.width = IMAGE_SIZE;
+        header.height = IMAGE_SIZE;
+        TransformDataInfo dataInfo = {header, image_, DrawUtils::GetPxSizeByColorMode(ARGB8888), BlurLevel::LEVEL0,
+                                      TransformAlgorithm::BILINEAR};
+        Rect mask(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+        BufferInfo dst{mask, BUFFER_SIZE * PX_BYTES, nullptr, buffer_, BUFFER_SIZE, BUFFER_SIZE, ARGB8888, 0};
+        DrawUtils::GetInstance()->DrawTransform(dst, mask, {IMAGE_POS, IMAGE_POS}, Color::Black(), OPA_OPAQUE,
+                                                transMap, dataInfo);
+    }
+
+    uint8_t GetAlpha(int16_t x, int16_t y) const
+    {
+        return buffer_[(y * BUFFER_SIZE + x) * PX_BYTES + PX_BYTES - 1];
+    }
+
+    uint8_t image_[IMAGE_SIZE * IMAGE_SIZE * PX_BYTES];
+    uint8_t buffer_[BUFFER_SIZE * BUFFER_SIZE * PX_BYTES];
+};
+
+/**
+ * @tc.name: DrawTransformBorder_001
+ * @tc.desc: Verify the border of a rotated image fades out without a bordered copy of the image, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DrawTransformTest, DrawTransformBorder_001, TestSize.Level0)
+{
+    DrawRotated(30); // 30: degree
+
+    const int16_t center = BUFFER_SIZE / 2; // 2: half
+    EXPECT_EQ(GetAlpha(center, center), OPA_OPAQUE);
+    EXPECT_EQ(buffer_[(center * BUFFER_SIZE + center) * PX_BYTES], IMAGE_VALUE);
+    EXPECT_EQ(GetAlpha(0, 0), OPA_TRANSPARENT);
+    EXPECT_EQ(GetAlpha(BUFFER_SIZE - 1, BUFFER_SIZE - 1), OPA_TRANSPARENT);
+
+    uint32_t partNum = 0;
+    for (int16_t y = 0; y < BUFFER_SIZE; y++) {
+        for (int16_t x = 0; x < BUFFER_SIZE; x++) {
+            uint8_t alpha = GetAlpha(x, y);
+            if ((alpha != OPA_TRANSPARENT) && (alpha != OPA_OPAQUE)) {
+                partNum++;
+            }
+        }
+    }
+    EXPECT_GT(partNum, 0);
+}
+
+/**
+ * @tc.name: DrawTransformRotate_001
+ * @tc.desc: Benchmark of rotating an image step by step like UITextureMapper, equal.
+ * @tc.type: PERF
+ */
+HWTEST_F(DrawTransformTest, DrawTransformRotate_001, TestSize.Level1)
+{
+    uint32_t frameNum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int16_t angle = 0; angle < ROUND_ANGLE; angle += ROTATE_STEP) {
+        ClearBuffer();
+        DrawRotated(angle);
+        frameNum++;
+    }
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    printf("DrawTransformRotate: %u frames of %ux%u, %lld us per frame\n", frameNum, IMAGE_SIZE, IMAGE_SIZE,
+           static_cast<long long>(cost.count() / frameNum));
+    EXPECT_EQ(frameNum, ROUND_ANGLE / ROTATE_STEP);
+    EXPECT_EQ(GetAlpha(BUFFER_SIZE / 2, BUFFER_SIZE / 2), OPA_OPAQUE); // 2: center of the buffer
+}
+} // namespace OHOS
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "engines/gfx/recording_engine.h"
+
+#if ENABLE_DEBUG
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "engines/gfx/gfx_replayer.h"
+#include "engines/gfx/soft_engine.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* RECORD_PATH = "./gfx_record_replay_test.rec";
+const uint8_t PX_BYTES = 4;
+const int16_t BUFFER_SIZE = 32;
+const int16_t GLYPH_SIZE = 8;
+const uint8_t FONT_WEIGHT = 8;
+const uint16_t LOOP_NUM = 3;
+} // namespace
+
+class GfxRecordReplayTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        if (BaseGfxEngine::GetInstance() == nullptr) {
+            static SoftEngine softEngine;
+            BaseGfxEngine::InitGfxEngine(&softEngine);
+        }
+    }
+    static void TearDownTestCase(void)
+    {
+        remove(RECORD_PATH);
+    }
+
+    void SetUp()
+    {
+        for (uint32_t i = 0; i < sizeof(buffer_); i++) {
+            buffer_[i] = 0;
+        }
+        for (uint32_t i = 0; i < sizeof(glyph_); i++) {
+            glyph_[i] = static_cast<uint8_t>(i * 4); // 4: any gradient
+        }
+    }
+
+    void DrawFrame(BaseGfxEngine& engine)
+    {
+        Rect mask(0, 0, BUFFER_SIZE - 1, BUFFER_SIZE - 1);
+        BufferInfo dst{mask, BUFFER_SIZE * PX_BYTES, nullptr, buffer_, BUFFER_SIZE, BUFFER_SIZE, ARGB8888, 0};
+        engine.Fill(dst, mask, Color::Blue(), OPA_OPAQUE);
+        Style style;
+        style.bgColor_ = Color::Red();
+        style.bgOpa_ = OPA_OPAQUE;
+        engine.DrawRect(dst, Rect(2, 2, 13, 13), mask, style, OPA_OPAQUE); // 2, 13: a rect in the top left
+        /* the same glyph twice, its pixels are recorded once */
+        Rect fontRect(16, 16, 16 + GLYPH_SIZE - 1, 16 + GLYPH_SIZE - 1); // 16: bottom right
+        engine.DrawLetter(dst, glyph_, fontRect, mask, FONT_WEIGHT, Color::White(), OPA_OPAQUE);
+        fontRect = Rect(2, 16, 2 + GLYPH_SIZE - 1, 16 + GLYPH_SIZE - 1); // 2, 16: bottom left
+        engine.DrawLetter(dst, glyph_, fontRect, mask, FONT_WEIGHT, Color::White(), OPA_OPAQUE);
+        engine.Flush(mask);
+    }
+
+    uint8_t buffer_[BUFFER_SIZE * BUFFER_SIZE * PX_BYTES];
+    uint8_t glyph_[GLYPH_SIZE * GLYPH_SIZE];
+};
+
+/**
+ * @tc.name: GfxRecordReplay_001
+ * @tc.desc: Verify the recorded frames replay to the same pixels, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GfxRecordReplayTest, GfxRecordReplay_001, TestSize.Level0)
+{
+    SoftEngine softEngine;
+    RecordingEngine recorder(&softEngine);
+    EXPECT_TRUE(recorder.Start(RECORD_PATH, 2)); // 2: frames to record
+    DrawFrame(recorder);
+    DrawFrame(recorder);
+    /* the third frame is past the range */
+    EXPECT_FALSE(recorder.IsRecording());
+    DrawFrame(recorder);
+    EXPECT_EQ(recorder.GetFrameCount(), 2); // 2: frames recorded
+
+    GfxReplayer replayer(&softEngine);
+    ASSERT_TRUE(replayer.Load(RECORD_PATH));
+    EXPECT_EQ(replayer.GetFrameNum(), 2); // 2: frames recorded
+    EXPECT_EQ(replayer.GetCallNum(), 8);  // 8: four calls a frame
+    EXPECT_TRUE(replayer.Replay(LOOP_NUM));
+    EXPECT_EQ(replayer.GetSkippedNum(), 0);
+    EXPECT_EQ(replayer.GetOpStats(REC_DRAW_LETTER).count, 4); // 4: two letters a frame
+    const GfxReplayer::CallTiming* call = replayer.GetCallTiming(0);
+    ASSERT_NE(call, nullptr);
+    EXPECT_EQ(call->op, REC_FILL);
+    EXPECT_EQ(call->frame, 0);
+    EXPECT_EQ(replayer.GetCallTiming(replayer.GetCallNum()), nullptr);
+
+    const BufferInfo* target = replayer.GetTarget(0);
+    ASSERT_NE(target, nullptr);
+    EXPECT_EQ(replayer.GetTarget(1), nullptr);
+    EXPECT_EQ(target->width, BUFFER_SIZE);
+    const uint8_t* pixels = static_cast<const uint8_t*>(target->virAddr);
+    for (uint32_t i = 0; i < sizeof(buffer_); i++) {
+        ASSERT_EQ(pixels[i], buffer_[i]);
+    }
+}
+
+/**
+ * @tc.name: GfxRecordReplay_002
+ * @tc.desc: Verify a broken recording is refused, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GfxRecordReplayTest, GfxRecordReplay_002, TestSize.Level0)
+{
+    FILE* file = fopen(RECORD_PATH, "wb");
+    ASSERT_NE(file, nullptr);
+    const char text[] = "not a recording";
+    fwrite(text, 1, sizeof(text), file);
+    fclose(file);
+
+    SoftEngine softEngine;
+    GfxReplayer replayer(&softEngine);
+    EXPECT_FALSE(replayer.Load(RECORD_PATH));
+    EXPECT_FALSE(replayer.Replay());
+    EXPECT_EQ(replayer.GetCallNum(), 0);
+    EXPECT_FALSE(replayer.Load(nullptr));
+}
+} // namespace OHOS
+#endif // ENABLE_DEBUG
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/glyphs_cache.h"
+
+#include <gtest/gtest.h>
+#include "font/font_ram_allocator.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint16_t FONT_KEY = 1;
+const uint32_t CAPACITY = 64;
+const uint32_t LOAD_NUM = CAPACITY - CAPACITY / 4; // 4: the table is filled to three quarters
+const uint32_t FONT_RAM_SIZE = 16384;
+uint8_t g_fontRam[FONT_RAM_SIZE];
+} // namespace
+
+class GlyphsCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        /* the font ram is only set once, by the first of the font tests */
+        FontRamAllocator::GetInstance().SetRamAddr(reinterpret_cast<uintptr_t>(g_fontRam), FONT_RAM_SIZE);
+    }
+
+    void SetUp()
+    {
+        cache_ = new GlyphsCache();
+        ASSERT_EQ(cache_->SetCapacity(CAPACITY), RET_VALUE_OK);
+        ASSERT_EQ(cache_->CacheInit(), RET_VALUE_OK);
+    }
+
+    void TearDown()
+    {
+        /* as when the language changes, the dynamic font ram is given back at once */
+        cache_->ClearCacheFlag();
+        FontRamAllocator::GetInstance().ClearRam();
+        delete cache_;
+        cache_ = nullptr;
+    }
+
+    bool Insert(uint32_t unicode)
+    {
+        GlyphCacheNode* node = cache_->GetNodeCacheSpace(unicode, FONT_KEY);
+        if (node == nullptr) {
+            return false;
+        }
+        node->node.advance = static_cast<uint16_t>(unicode);
+        return true;
+    }
+
+    GlyphsCache* cache_ = nullptr;
+};
+
+/**
+ * @tc.name: GlyphsCacheGetNode_001
+ * @tc.desc: Verify the nodes saved are found by their key and counted as hits, the others as misses.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GlyphsCacheTest, GlyphsCacheGetNode_001, TestSize.Level0)
+{
+    for (uint32_t unicode = 0; unicode < LOAD_NUM; unicode++) {
+        ASSERT_TRUE(Insert(unicode));
+    }
+    for (uint32_t unicode = 0; unicode < LOAD_NUM; unicode++) {
+        GlyphCacheNode* node = cache_->GetNodeFromCache(unicode, FONT_KEY, CACHE_TYPE_NONE);
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(node->node.unicode, unicode);
+        EXPECT_EQ(node->node.fontId, FONT_KEY);
+        EXPECT_EQ(node->node.advance, unicode);
+    }
+    EXPECT_EQ(cache_->GetNodeFromCache(LOAD_NUM, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+    EXPECT_EQ(cache_->GetNodeFromCache(0, FONT_KEY + 1, CACHE_TYPE_NONE), nullptr);
+    EXPECT_EQ(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_STATIC), nullptr);
+
+    /* saving a key again reuses its node */
+    ASSERT_TRUE(Insert(0));
+    GlyphsCache::Stats stats = cache_->GetStats();
+    EXPECT_EQ(stats.hitNum, LOAD_NUM);
+    EXPECT_EQ(stats.missNum, 3); // 3: the lookups of the keys not saved
+    EXPECT_EQ(stats.evictNum, 0);
+    EXPECT_EQ(stats.nodeNum, LOAD_NUM);
+    EXPECT_EQ(stats.capacity, CAPACITY);
+}
+
+/**
+ * @tc.name: GlyphsCacheEvict_001
+ * @tc.desc: Verify a full cache evicts one node per new key and keeps the node used between the evictions.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GlyphsCacheTest, GlyphsCacheEvict_001, TestSize.Level0)
+{
+    const uint32_t usedUnicode = LOAD_NUM / 2;
+    for (uint32_t unicode = 0; unicode < LOAD_NUM; unicode++) {
+        ASSERT_TRUE(Insert(unicode));
+    }
+    for (uint32_t unicode = LOAD_NUM; unicode < LOAD_NUM + CAPACITY; unicode++) {
+        ASSERT_NE(cache_->GetNodeFromCache(usedUnicode, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+        ASSERT_TRUE(Insert(unicode));
+    }
+    GlyphsCache::Stats stats = cache_->GetStats();
+    EXPECT_EQ(stats.nodeNum, LOAD_NUM);
+    EXPECT_EQ(stats.evictNum, CAPACITY);
+
+    /* the nodes left are still found after the nodes before them in their probe were removed */
+    uint32_t foundNum = 0;
+    for (uint32_t unicode = 0; unicode < LOAD_NUM + CAPACITY; unicode++) {
+        GlyphCacheNode* node = cache_->GetNodeFromCache(unicode, FONT_KEY, CACHE_TYPE_NONE);
+        if (node != nullptr) {
+            EXPECT_EQ(node->node.advance, unicode);
+            foundNum++;
+        }
+    }
+    EXPECT_EQ(foundNum, LOAD_NUM);
+    EXPECT_NE(cache_->GetNodeFromCache(usedUnicode, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+}
+
+/**
+ * @tc.name: GlyphsCacheSetCapacity_001
+ * @tc.desc: Verify the capacity is rounded up to a power of two and changing it drops the nodes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GlyphsCacheTest, GlyphsCacheSetCapacity_001, TestSize.Level0)
+{
+    ASSERT_TRUE(Insert(0));
+    EXPECT_EQ(cache_->SetCapacity(CAPACITY), RET_VALUE_OK);
+    EXPECT_NE(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+
+    EXPECT_EQ(cache_->SetCapacity(CAPACITY + 1), RET_VALUE_OK);
+    EXPECT_EQ(cache_->GetCapacity(), CAPACITY * 2);
+    EXPECT_EQ(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+    EXPECT_EQ(cache_->GetStats().nodeNum, 0);
+    ASSERT_TRUE(Insert(0));
+    EXPECT_NE(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+
+    EXPECT_EQ(cache_->SetCapacity(1), RET_VALUE_OK);
+    EXPECT_EQ(cache_->GetCapacity(), CAPACITY);
+    EXPECT_EQ(cache_->SetCapacity(UINT32_MAX), INVALID_RET_VALUE);
+    EXPECT_EQ(cache_->GetCapacity(), CAPACITY);
+}
+
+#if defined(ENABLE_SPANNABLE_STRING) && ENABLE_SPANNABLE_STRING
+/**
+ * @tc.name: GlyphsCacheTextStyle_001
+ * @tc.desc: Verify the text style is part of the key of the nodes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GlyphsCacheTest, GlyphsCacheTextStyle_001, TestSize.Level0)
+{
+    GlyphCacheNode* node = cache_->GetNodeCacheSpace(0, FONT_KEY, TEXT_STYLE_BOLD);
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->node.textStyle, TEXT_STYLE_BOLD);
+    EXPECT_EQ(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_NONE), nullptr);
+    EXPECT_EQ(cache_->GetNodeFromCache(0, FONT_KEY, CACHE_TYPE_NONE, TEXT_STYLE_BOLD), node);
+}
+#endif
+} // namespace OHOS
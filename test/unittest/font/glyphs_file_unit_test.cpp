@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/glyphs_file.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include "font/font_ram_allocator.h"
+#include "font/ui_font_builder.h"
+#include "gfx_utils/file.h"
+#include "securec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const char* FONT_PATH = "./glyphs_file_test.bin";
+const uint32_t UNICODE = 0x4E2D;
+const uint16_t GLYPH_COLS = 4;
+const uint16_t GLYPH_ROWS = 2;
+const uint32_t BITMAP_SIZE = GLYPH_COLS * GLYPH_ROWS;
+const uint8_t RADIX_BITS = 4;
+const uint8_t RADIX_LEVEL_NUM = 32 / RADIX_BITS;
+const uint16_t RADIX_SLOT_NUM = 1 << RADIX_BITS;
+const uint32_t FONT_RAM_SIZE = 16384;
+UITextLanguageFontParam g_fontTable[1] = {};
+uint8_t g_fontRam[FONT_RAM_SIZE];
+} // namespace
+
+class GlyphsFileTest : public testing::Test {
+public:
+    static void SetUpTestCase(void)
+    {
+        if (UIFontBuilder::GetInstance()->GetBitmapFontIdMax() == 0) {
+            UIFontBuilder::GetInstance()->SetTextLangFontsTable(g_fontTable, 1);
+        }
+        /* the font headers are kept in the font ram, which is only set once */
+        FontRamAllocator::GetInstance().SetRamAddr(reinterpret_cast<uintptr_t>(g_fontRam), FONT_RAM_SIZE);
+        WriteFontFile();
+    }
+
+    static void TearDownTestCase(void)
+    {
+        remove(FONT_PATH);
+    }
+
+    /* one font holding one A8 glyph */
+    static void WriteFontFile()
+    {
+        BinHeader binHeader = {};
+        (void)strncpy_s(binHeader.fontMagic, FONT_MAGIC_NUM_LEN, FONT_MAGIC_NUMBER, FONT_MAGIC_NUM_LEN - 1);
+        binHeader.fontNum = 1;
+        FontHeader fontHeader = {};
+        fontHeader.glyphNum = 1;
+        fontHeader.fontHeight = GLYPH_ROWS;
+        fontHeader.indexLen = RADIX_LEVEL_NUM * RADIX_SLOT_NUM * sizeof(uint16_t);
+        /* every level of the radix tree points to the next one, the last one points to the first glyph */
+        uint16_t index[RADIX_LEVEL_NUM][RADIX_SLOT_NUM] = {};
+        for (uint8_t level = 0; level < RADIX_LEVEL_NUM; level++) {
+            uint8_t key = (UNICODE >> (32 - RADIX_BITS * (level + 1))) & (RADIX_SLOT_NUM - 1); // 32: bits of unicode
+            index[level][key] = (level == RADIX_LEVEL_NUM - 1) ? 1 : (level + 1);
+        }
+        GlyphNode node = {};
+        node.unicode = UNICODE;
+        node.cols = GLYPH_COLS;
+        node.rows = GLYPH_ROWS;
+        node.kernOff = BITMAP_SIZE;
+        uint8_t bitmap[BITMAP_SIZE];
+        for (uint32_t i = 0; i < BITMAP_SIZE; i++) {
+            bitmap[i] = i + 1;
+        }
+        FILE* file = fopen(FONT_PATH, "wb");
+        ASSERT_NE(file, nullptr);
+        fwrite(&binHeader, sizeof(binHeader), 1, file);
+        fwrite(&fontHeader, sizeof(fontHeader), 1, file);
+        fwrite(index, sizeof(index), 1, file);
+        fwrite(&node, sizeof(node), 1, file);
+        fwrite(bitmap, sizeof(bitmap), 1, file);
+        fclose(file);
+    }
+};
+
+/**
+ * @tc.name: GlyphsFileGetBitmap_001
+ * @tc.desc: Verify the glyph node and bitmap are read from the font file, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GlyphsFileTest, GlyphsFileGetBitmap_001, TestSize.Level0)
+{
+    int32_t fd = open(FONT_PATH, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    GlyphsFile* glyphsFile = new GlyphsFile();
+    ASSERT_EQ(glyphsFile->SetFile(FONT_PATH, fd, 0), RET_VALUE_OK);
+
+    GlyphNode node;
+    EXPECT_EQ(glyphsFile->GetNodeFromFile(UNICODE + 1, 0, node), INVALID_RET_VALUE);
+    ASSERT_EQ(glyphsFile->GetNodeFromFile(UNICODE, 0, node), RET_VALUE_OK);
+    EXPECT_EQ(node.unicode, UNICODE);
+    EXPECT_EQ(node.cols, GLYPH_COLS);
+    EXPECT_EQ(node.rows, GLYPH_ROWS);
+
+    uint8_t bitmap[BITMAP_SIZE] = {0};
+    BufferInfo bufInfo{Rect(), GLYPH_COLS, nullptr, bitmap, GLYPH_COLS, GLYPH_ROWS, A8, 0};
+    EXPECT_EQ(glyphsFile->GetBitmap(node, bufInfo), RET_VALUE_OK);
+    for (uint32_t i = 0; i < BITMAP_SIZE; i++) {
+        EXPECT_EQ(bitmap[i], i + 1);
+    }
+
+    const uint8_t* mapped = glyphsFile->GetMappedBitmap(node);
+    if (glyphsFile->IsMapped()) {
+        ASSERT_NE(mapped, nullptr);
+        EXPECT_EQ(memcmp(mapped, bitmap, BITMAP_SIZE), 0);
+    } else {
+        EXPECT_EQ(mapped, nullptr);
+    }
+    delete glyphsFile;
+    close(fd);
+}
+} // namespace OHOS
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "font/ui_font_cache.h"
+
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint16_t FONT_KEY = 1;
+const uint32_t BITMAP_SIZE = UIFontCache::FONT_CACHE_MIN_SIZE;
+const uint32_t SMALL_CACHE_SIZE = 0x2000;
+const uint32_t FILL_NUM = SMALL_CACHE_SIZE / BITMAP_SIZE + 1;
+const uint32_t LARGE_CACHE_SIZE = UIFontCache::FONT_CACHE_SHARD_MIN_SIZE * UIFontCache::FONT_CACHE_SHARD_NR;
+const uint8_t THREAD_NUM = 4;
+const uint32_t GLYPH_NUM = 200; // fits in one shard, so both caches only miss the first time
+const uint32_t GLYPH_STRIDE = 7; // coprime to GLYPH_NUM, so every thread walks all the glyphs
+const uint32_t LOOP_NUM = 100000;
+} // namespace
+
+class UIFontCacheTest : public testing::Test {
+public:
+    void TearDown()
+    {
+        delete cache_;
+        cache_ = nullptr;
+        delete[] ram_;
+        ram_ = nullptr;
+    }
+
+    void CreateCache(uint32_t size)
+    {
+        ram_ = new uint8_t[size];
+        cache_ = new UIFontCache(ram_, size);
+    }
+
+    /* looks a glyph up and adds it when missing, as a worker thread rasterizing text would */
+    static void DrawGlyph(UIFontCache* cache, uint32_t unicode)
+    {
+        uint8_t* bitmap = cache->PinBitmap(FONT_KEY, unicode);
+        if (bitmap == nullptr) {
+            bitmap = cache->PinSpace(FONT_KEY, unicode, BITMAP_SIZE);
+            if (bitmap == nullptr) {
+                return;
+            }
+            bitmap[0] = static_cast<uint8_t>(unicode);
+        }
+        EXPECT_EQ(bitmap[0], static_cast<uint8_t>(unicode));
+        cache->UnpinBitmap(bitmap);
+    }
+
+    uint8_t* ram_ = nullptr;
+    UIFontCache* cache_ = nullptr;
+};
+
+/**
+ * @tc.name: UIFontCacheGetBitmap_001
+ * @tc.desc: Verify the bitmaps added are found by their key, and the shard number follows the cache size.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontCacheTest, UIFontCacheGetBitmap_001, TestSize.Level0)
+{
+    CreateCache(LARGE_CACHE_SIZE);
+    EXPECT_EQ(cache_->GetShardNum(), UIFontCache::FONT_CACHE_SHARD_NR);
+    for (uint32_t unicode = 0; unicode < UIFontCache::FONT_CACHE_HASH_NR * 2; unicode++) { // 2: two per bucket
+        uint8_t* space = cache_->GetSpace(FONT_KEY, unicode, BITMAP_SIZE);
+        ASSERT_NE(space, nullptr);
+        space[0] = static_cast<uint8_t>(unicode);
+    }
+    for (uint32_t unicode = 0; unicode < UIFontCache::FONT_CACHE_HASH_NR * 2; unicode++) { // 2: two per bucket
+        uint8_t* bitmap = cache_->GetBitmap(FONT_KEY, unicode);
+        ASSERT_NE(bitmap, nullptr);
+        EXPECT_EQ(bitmap[0], unicode);
+    }
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY + 1, 0), nullptr);
+
+    uint8_t* bitmap = cache_->GetBitmap(FONT_KEY, 0);
+    cache_->PutSpace(bitmap);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), nullptr);
+
+    TearDown();
+    CreateCache(SMALL_CACHE_SIZE);
+    EXPECT_EQ(cache_->GetShardNum(), 1);
+}
+
+/**
+ * @tc.name: UIFontCachePin_001
+ * @tc.desc: Verify a full cache evicts the bitmaps which are not pinned only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontCacheTest, UIFontCachePin_001, TestSize.Level0)
+{
+    CreateCache(SMALL_CACHE_SIZE);
+    ASSERT_NE(cache_->GetSpace(FONT_KEY, 0, BITMAP_SIZE), nullptr);
+    uint8_t* pinned = cache_->PinBitmap(FONT_KEY, 0);
+    ASSERT_NE(pinned, nullptr);
+
+    for (uint32_t unicode = 1; unicode <= FILL_NUM; unicode++) {
+        ASSERT_NE(cache_->GetSpace(FONT_KEY, unicode, BITMAP_SIZE), nullptr);
+    }
+    /* the oldest bitmaps were evicted, but the pinned one */
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 1), nullptr);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), pinned);
+
+    cache_->UnpinBitmap(pinned);
+    for (uint32_t unicode = FILL_NUM + 1; unicode <= FILL_NUM * 2; unicode++) { // 2: fill the cache again
+        ASSERT_NE(cache_->GetSpace(FONT_KEY, unicode, BITMAP_SIZE), nullptr);
+    }
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), nullptr);
+}
+
+/**
+ * @tc.name: UIFontCachePin_002
+ * @tc.desc: Verify PutSpace on a pinned bitmap hides it and frees it on the last unpin only.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontCacheTest, UIFontCachePin_002, TestSize.Level0)
+{
+    CreateCache(SMALL_CACHE_SIZE);
+    uint8_t* space = cache_->GetSpace(FONT_KEY, 0, BITMAP_SIZE);
+    ASSERT_NE(space, nullptr);
+    space[0] = 1;
+    uint8_t* first = cache_->PinBitmap(FONT_KEY, 0);
+    uint8_t* second = cache_->PinBitmap(FONT_KEY, 0);
+    ASSERT_EQ(first, space);
+    ASSERT_EQ(second, space);
+
+    cache_->PutSpace(space);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), nullptr);
+    for (uint32_t unicode = 1; unicode <= FILL_NUM; unicode++) {
+        ASSERT_NE(cache_->GetSpace(FONT_KEY, unicode, BITMAP_SIZE), nullptr);
+    }
+    /* still drawn, so neither freed nor reused */
+    EXPECT_EQ(first[0], 1);
+
+    cache_->UnpinBitmap(first);
+    EXPECT_EQ(second[0], 1);
+    cache_->UnpinBitmap(second);
+    for (uint32_t unicode = FILL_NUM + 1; unicode <= FILL_NUM * 2; unicode++) { // 2: fill the cache again
+        ASSERT_NE(cache_->GetSpace(FONT_KEY, unicode, BITMAP_SIZE), nullptr);
+    }
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), nullptr);
+
+    /* bitmaps mapped from font files are not in the cache, unpinning them does nothing */
+    uint8_t mapped[BITMAP_SIZE] = {0};
+    cache_->UnpinBitmap(mapped);
+}
+
+/**
+ * @tc.name: UIFontCachePinSpace_001
+ * @tc.desc: Verify a pinned space is found once it is unpinned, and a second one of the same key is dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontCacheTest, UIFontCachePinSpace_001, TestSize.Level0)
+{
+    CreateCache(SMALL_CACHE_SIZE);
+    uint8_t* first = cache_->PinSpace(FONT_KEY, 0, BITMAP_SIZE);
+    uint8_t* second = cache_->PinSpace(FONT_KEY, 0, BITMAP_SIZE);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), nullptr);
+
+    cache_->UnpinBitmap(first);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), first);
+    cache_->UnpinBitmap(second);
+    EXPECT_EQ(cache_->GetBitmap(FONT_KEY, 0), first);
+}
+
+/**
+ * @tc.name: UIFontCacheContention_001
+ * @tc.desc: Benchmark of threads looking up and adding glyphs at the same time, with one shard and with all shards.
+ * @tc.type: PERF
+ */
+HWTEST_F(UIFontCacheTest, UIFontCacheContention_001, TestSize.Level1)
+{
+    const uint32_t cacheSizes[] = {UIFontCache::FONT_CACHE_SHARD_MIN_SIZE, LARGE_CACHE_SIZE};
+    for (uint32_t size : cacheSizes) {
+        CreateCache(size);
+        std::thread threads[THREAD_NUM];
+        long long costs[THREAD_NUM] = {0};
+        for (uint8_t i = 0; i < THREAD_NUM; i++) {
+            threads[i] = std::thread([this, i, &costs]() {
+                /* every thread starts at another glyph, so the threads are on different glyphs at a time */
+                uint32_t unicode = i * (GLYPH_NUM / THREAD_NUM);
+                auto start = std::chrono::steady_clock::now();
+                for (uint32_t j = 0; j < LOOP_NUM; j++) {
+                    unicode = (unicode + GLYPH_STRIDE) % GLYPH_NUM;
+                    DrawGlyph(cache_, unicode);
+                }
+                costs[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            });
+        }
+        long long minCost = LLONG_MAX;
+        long long maxCost = 0;
+        for (uint8_t i = 0; i < THREAD_NUM; i++) {
+            threads[i].join();
+            minCost = (costs[i] < minCost) ? costs[i] : minCost;
+            maxCost = (costs[i] > maxCost) ? costs[i] : maxCost;
+        }
+        printf("UIFontCacheContention: %u threads, %u shards, %u glyphs each, %lld - %lld us per thread\n",
+               THREAD_NUM, cache_->GetShardNum(), LOOP_NUM, minCost, maxCost);
+        TearDown();
+    }
+}
+} // namespace OHOS
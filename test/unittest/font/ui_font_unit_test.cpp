@@ -293,4 +293,41 @@ HWTEST_F(UIFontTest, Graphic_Font_Test_UnregisterFontInfo_002, TestSize.Level0)
     uint8_t ret = UIFont::GetInstance()->UnregisterFontInfo(fontsTable, 0);
     EXPECT_EQ(ret, 0);
 }
+
+/**
+ * @tc.name: Graphic_Font_Test_PreloadGlyphs_001
+ * @tc.desc: Verify UIFont::PreloadGlyphs function, invalid parameters.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_PreloadGlyphs_001, TestSize.Level0)
+{
+    const char* const* texts = nullptr;
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(texts, 1, 0, 0), INVALID_RET);
+    const GlyphRange* ranges = nullptr;
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(ranges, 1, 0, 0), INVALID_RET);
+
+    const char* emptyTexts[] = {"", nullptr};
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(emptyTexts, 2, 0, 0), 0); // 2: number of texts
+    GlyphRange emptyRange = {'b', 'a'};
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(&emptyRange, 1, 0, 0), 0);
+}
+
+/**
+ * @tc.name: Graphic_Font_Test_PreloadGlyphs_002
+ * @tc.desc: Verify UIFont::PreloadGlyphs function, font not registered.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UIFontTest, Graphic_Font_Test_PreloadGlyphs_002, TestSize.Level1)
+{
+    const char* texts[] = {"preload"};
+    GlyphRange range = {'0', '9'};
+    EXPECT_EQ(font_->PreloadGlyphs(nullptr, 0, FONT_ID, 0, 1), INVALID_RET);
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(texts, 1, FONT_ID, 0), INVALID_RET);
+    EXPECT_EQ(UIFont::GetInstance()->PreloadGlyphs(&range, 1, FONT_ID, 0), INVALID_RET);
+#if ENABLE_VECTOR_FONT
+    EXPECT_EQ(font_->SetGlyphCacheDir(nullptr), 0);
+#else
+    EXPECT_EQ(font_->SetGlyphCacheDir(nullptr), INVALID_RET);
+#endif
+}
 } // namespace OHOS
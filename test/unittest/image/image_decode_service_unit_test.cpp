@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/image_decode_service.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "components/ui_view_group.h"
+#include "gfx_utils/mem_api.h"
+#include "test_resource_config.h"
+
+using namespace testing::ext;
+namespace OHOS {
+#if ENABLE_ASYNC_IMAGE_DECODE
+namespace {
+const char* BROKEN_IMAGE_PATH = "./image_decode_service_test.png";
+const uint16_t WAIT_LOOP_NUM = 2000;
+const uint32_t WAIT_INTERVAL = 1000; // 1000: 1ms in microseconds
+} // namespace
+
+class TestDecodeListener : public ImageDecodeListener {
+public:
+    virtual ~TestDecodeListener()
+    {
+        FreeImage();
+    }
+
+    void OnDecodeFinished(const char* src, ImageInfo* imgInfo, uint8_t decodeShift) override
+    {
+        FreeImage();
+        finishedNum_++;
+        imgInfo_ = imgInfo;
+    }
+
+    void FreeImage()
+    {
+        if (imgInfo_ != nullptr) {
+            UIFree(reinterpret_cast<void*>(const_cast<uint8_t*>(imgInfo_->data)));
+            UIFree(reinterpret_cast<void*>(imgInfo_));
+            imgInfo_ = nullptr;
+        }
+    }
+
+    uint32_t finishedNum_ = 0;
+    ImageInfo* imgInfo_ = nullptr;
+};
+
+class ImageDecodeServiceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void)
+    {
+        remove(BROKEN_IMAGE_PATH);
+    }
+
+    /* runs the task of the service as the task handler would, until the listener is called or it times out */
+    static bool WaitFinished(const TestDecodeListener& listener)
+    {
+        for (uint16_t i = 0; i < WAIT_LOOP_NUM; i++) {
+            ImageDecodeService::GetInstance()->Callback();
+            if (listener.finishedNum_ > 0) {
+                return true;
+            }
+            usleep(WAIT_INTERVAL);
+        }
+        return false;
+    }
+};
+
+/**
+ * @tc.name: ImageDecodeServiceDecode_001
+ * @tc.desc: Verify a decoded file is handed back to its listener, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageDecodeServiceTest, ImageDecodeServiceDecode_001, TestSize.Level1)
+{
+    TestDecodeListener listener;
+    Image::DecodeSize size = {0, 0, false};
+    ASSERT_TRUE(ImageDecodeService::GetInstance()->Decode(BLUE_IMAGE_PATH, &listener, nullptr, size));
+    EXPECT_TRUE(ImageDecodeService::GetInstance()->IsPending(&listener));
+    ASSERT_TRUE(WaitFinished(listener));
+    EXPECT_EQ(listener.finishedNum_, 1);
+    ASSERT_NE(listener.imgInfo_, nullptr);
+    EXPECT_GT(listener.imgInfo_->header.width, 0);
+    EXPECT_FALSE(ImageDecodeService::GetInstance()->IsPending(&listener));
+
+    EXPECT_FALSE(ImageDecodeService::GetInstance()->Decode(nullptr, &listener, nullptr, size));
+    EXPECT_FALSE(ImageDecodeService::GetInstance()->Decode(BLUE_IMAGE_PATH, nullptr, nullptr, size));
+}
+
+/**
+ * @tc.name: ImageDecodeServiceCancel_001
+ * @tc.desc: Verify a cancelled request is not handed back, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageDecodeServiceTest, ImageDecodeServiceCancel_001, TestSize.Level1)
+{
+    TestDecodeListener listener;
+    Image::DecodeSize size = {0, 0, false};
+    ASSERT_TRUE(ImageDecodeService::GetInstance()->Decode(BLUE_IMAGE_PATH, &listener, nullptr, size));
+    ImageDecodeService::GetInstance()->Cancel(&listener);
+    EXPECT_FALSE(ImageDecodeService::GetInstance()->IsPending(&listener));
+    EXPECT_FALSE(WaitFinished(listener));
+    EXPECT_EQ(listener.finishedNum_, 0);
+}
+
+/**
+ * @tc.name: ImageDecodeServiceRemoveView_001
+ * @tc.desc: Verify the request of a removed view is held back until the view is added again, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageDecodeServiceTest, ImageDecodeServiceRemoveView_001, TestSize.Level1)
+{
+    UIViewGroup group;
+    UIViewGroup parent;
+    UIView view;
+    parent.Add(&view);
+    group.Add(&parent);
+    TestDecodeListener listener;
+    Image::DecodeSize size = {0, 0, false};
+    ASSERT_TRUE(ImageDecodeService::GetInstance()->Decode(BLUE_IMAGE_PATH, &listener, &view, size));
+
+    // removing an ancestor detaches the view as well
+    group.Remove(&parent);
+    EXPECT_TRUE(ImageDecodeService::GetInstance()->IsPending(&listener));
+    EXPECT_FALSE(WaitFinished(listener));
+    EXPECT_EQ(listener.finishedNum_, 0);
+
+    group.Add(&parent);
+    ASSERT_TRUE(WaitFinished(listener));
+    EXPECT_EQ(listener.finishedNum_, 1);
+    EXPECT_NE(listener.imgInfo_, nullptr);
+    group.RemoveAll();
+    parent.RemoveAll();
+}
+
+/**
+ * @tc.name: ImageDecodeServiceFail_001
+ * @tc.desc: Verify a file which fails to be decoded is handed back without image, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageDecodeServiceTest, ImageDecodeServiceFail_001, TestSize.Level1)
+{
+    // a PNG signature followed by no valid chunk
+    const uint8_t data[] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x01, 0x02, 0x03};
+    FILE* file = fopen(BROKEN_IMAGE_PATH, "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(data, 1, sizeof(data), file);
+    fclose(file);
+
+    TestDecodeListener listener;
+    Image::DecodeSize size = {0, 0, false};
+    ASSERT_TRUE(ImageDecodeService::GetInstance()->Decode(BROKEN_IMAGE_PATH, &listener, nullptr, size));
+    ASSERT_TRUE(WaitFinished(listener));
+    EXPECT_EQ(listener.finishedNum_, 1);
+    EXPECT_EQ(listener.imgInfo_, nullptr);
+}
+#endif
+} // namespace OHOS
@@ -127,4 +127,30 @@ HWTEST_F(ImageTest, Graphic_Image_Test_GetImageInfo_003, TestSize.Level0)
         }
     }
 }
+
+/**
+ * @tc.name: Graphic_Image_Test_DecodeRleRow_001
+ * @tc.desc: Verify ImageLoad::DecodeRleRow function, decode part of a row.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageTest, Graphic_Image_Test_DecodeRleRow_001, TestSize.Level0)
+{
+    /* RGB565: 3 literal pixels, then 1 pixel repeated 4 times */
+    const uint8_t row[] = {0x02, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x83, 0x04, 0x00};
+    const uint8_t pxBytes = 2;
+    uint16_t pixels[4] = {0};
+    bool ret = ImageLoad::DecodeRleRow(row, sizeof(row), pxBytes, 1, 4, reinterpret_cast<uint8_t*>(pixels));
+    EXPECT_EQ(ret, true);
+    EXPECT_EQ(pixels[0], 2); // 2: second literal pixel
+    EXPECT_EQ(pixels[1], 3); // 3: third literal pixel
+    EXPECT_EQ(pixels[2], 4); // 4: repeated pixel
+    EXPECT_EQ(pixels[3], 4); // 4: repeated pixel
+
+    /* the row has 7 pixels only */
+    ret = ImageLoad::DecodeRleRow(row, sizeof(row), pxBytes, 4, 4, reinterpret_cast<uint8_t*>(pixels));
+    EXPECT_EQ(ret, false);
+    /* the repeated pixel is cut off */
+    ret = ImageLoad::DecodeRleRow(row, sizeof(row) - 1, pxBytes, 0, 7, reinterpret_cast<uint8_t*>(pixels));
+    EXPECT_EQ(ret, false);
+}
 } // namespace OHOS
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "imgdecode/image_mipmap.h"
+
+#include <climits>
+#include <gtest/gtest.h>
+
+using namespace testing::ext;
+namespace OHOS {
+namespace {
+const uint16_t IMAGE_WIDTH = 5;
+const uint16_t IMAGE_HEIGHT = 4;
+const uint8_t PX_BYTES = 4;
+const uint8_t DARK = 0;
+const uint8_t LIGHT = 200;
+} // namespace
+
+class ImageMipmapTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {}
+    static void TearDownTestCase(void) {}
+
+    static void InitImage(ImageInfo& imgInfo, uint8_t* data)
+    {
+        // columns alternate between dark and light, so every level 1 pixel of an even column is their average
+        for (uint16_t y = 0; y < IMAGE_HEIGHT; y++) {
+            for (uint16_t x = 0; x < IMAGE_WIDTH; x++) {
+                uint8_t* px = data + (y * IMAGE_WIDTH + x) * PX_BYTES;
+                for (uint8_t c = 0; c < PX_BYTES; c++) {
+                    px[c] = (x % 2 == 0) ? DARK : LIGHT; // 2: alternate columns
+                }
+            }
+        }
+        imgInfo.header.colorMode = ARGB8888;
+        imgInfo.header.width = IMAGE_WIDTH;
+        imgInfo.header.height = IMAGE_HEIGHT;
+        imgInfo.dataSize = IMAGE_WIDTH * IMAGE_HEIGHT * PX_BYTES;
+        imgInfo.data = data;
+    }
+};
+
+/**
+ * @tc.name: ImageMipmapCreate_001
+ * @tc.desc: Verify Create function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageMipmapTest, ImageMipmapCreate_001, TestSize.Level0)
+{
+    uint8_t data[IMAGE_WIDTH * IMAGE_HEIGHT * PX_BYTES];
+    ImageInfo imgInfo = {};
+    InitImage(imgInfo, data);
+    ImageMipmap* mipmap = ImageMipmap::Create(imgInfo);
+    ASSERT_NE(mipmap, nullptr);
+    EXPECT_EQ(mipmap->GetLevelNum(), ImageMipmap::MAX_LEVEL_NUM);
+    EXPECT_EQ(mipmap->GetLevel(0), nullptr);
+
+    const ImageInfo* level = mipmap->GetLevel(1);
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->header.width, 3);  // 3: odd widths are rounded up
+    EXPECT_EQ(level->header.height, 2); // 2: half of the height
+    EXPECT_EQ(level->data[0], (DARK + LIGHT) / 2); // 2: average of the two columns
+    // the last column has no neighbour and keeps its value
+    EXPECT_EQ(level->data[2 * PX_BYTES], DARK); // 2: index of the last column
+
+    level = mipmap->GetLevel(ImageMipmap::MAX_LEVEL_NUM);
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->header.width, 1);
+    EXPECT_EQ(level->header.height, 1);
+    delete mipmap;
+
+    imgInfo.header.colorMode = RGB565;
+    EXPECT_EQ(ImageMipmap::Create(imgInfo), nullptr);
+}
+
+/**
+ * @tc.name: ImageMipmapSelectLevel_001
+ * @tc.desc: Verify SelectLevel and Select function, equal.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageMipmapTest, ImageMipmapSelectLevel_001, TestSize.Level1)
+{
+    uint8_t data[IMAGE_WIDTH * IMAGE_HEIGHT * PX_BYTES];
+    ImageInfo imgInfo = {};
+    InitImage(imgInfo, data);
+    ImageMipmap* mipmap = ImageMipmap::Create(imgInfo);
+    ASSERT_NE(mipmap, nullptr);
+
+    Rect rect(0, 0, IMAGE_WIDTH - 1, IMAGE_HEIGHT - 1);
+    TransformMap transMap;
+    transMap.SetTransMapRect(rect);
+    transMap.SetMatrix(Matrix4<float>::Scale(Vector3<float>(0.6f, 0.6f, 1.0f), Vector3<float>(0, 0, 0)));
+    EXPECT_EQ(mipmap->SelectLevel(transMap), 0);
+
+    transMap.SetMatrix(Matrix4<float>::Scale(Vector3<float>(0.25f, 0.25f, 1.0f), Vector3<float>(0, 0, 0)));
+    EXPECT_EQ(mipmap->SelectLevel(transMap), 2); // 2: a quarter of the size
+
+    // the axis which shrinks the least decides the level
+    transMap.SetMatrix(Matrix4<float>::Scale(Vector3<float>(0.1f, 0.5f, 1.0f), Vector3<float>(0, 0, 0)));
+    EXPECT_EQ(mipmap->SelectLevel(transMap), 1);
+
+    ImageInfo levelInfo = imgInfo;
+    TransformMap levelMap;
+    EXPECT_EQ(mipmap->Select(transMap, levelInfo, levelMap), true);
+    EXPECT_EQ(levelInfo.data, mipmap->GetLevel(1)->data);
+    EXPECT_EQ(levelMap.GetTransMapRect().GetWidth(), mipmap->GetLevel(1)->header.width);
+    delete mipmap;
+}
+} // namespace OHOS
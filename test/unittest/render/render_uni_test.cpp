@@ -21,6 +21,7 @@
 #include "components/root_view.h"
 #include "components/ui_view.h"
 #include "components/ui_view_group.h"
+#include "core/render_manager.h"
 #include "window/window.h"
 
 using namespace testing::ext;
@@ -52,6 +53,13 @@ public:
     {
         Window::DestroyWindow(rootView->GetBoundWindow());
     }
+
+    static void SetOpaque(UIView* view)
+    {
+        view->SetStyle(STYLE_BACKGROUND_OPA, OPA_OPAQUE);
+        view->SetStyle(STYLE_BORDER_WIDTH, 0);
+        view->SetStyle(STYLE_BORDER_RADIUS, 0);
+    }
 };
 
 class UITestView : public UIView {
@@ -65,6 +73,21 @@ public:
     }
 };
 
+class TestVsyncSource : public VsyncSource {
+public:
+    uint32_t GetPeriod() const override
+    {
+        return 16667; // 16667: 60 Hz in microseconds
+    }
+
+    uint64_t GetLastVsyncTime() override
+    {
+        return vsyncTime_;
+    }
+
+    uint64_t vsyncTime_ = 0;
+};
+
 class UITestViewGroup : public UIViewGroup {
 public:
     UITestViewGroup() {}
@@ -139,4 +162,150 @@ HWTEST_F(RenderTest, Graphic_RenderTest_Test_Measuer_02, TestSize.Level0)
     RenderTest::DestroyWindow(rootView);
     RootView::DestroyWindowRootView(rootView);
 }
+
+/**
+ * @tc.name: Graphic_RenderTest_Test_OcclusionCulling_001
+ * @tc.desc: Verity the parts covered by opaque views in front are not drawn
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderTest, Graphic_RenderTest_Test_OcclusionCulling_001, TestSize.Level1)
+{
+    RootView* rootView = RootView::GetWindowRootView();
+    rootView->SetWidth(600);  // 600: width
+    rootView->SetHeight(500); // 500: height
+    rootView->SetPosition(0, 0);
+    RenderTest::SetOpaque(rootView);
+    // two overlapping cards, neither of them covers the whole screen
+    UIView* view1 = new UIView();
+    view1->SetPosition(0, 0, 300, 500); // 300: width; 500: height
+    RenderTest::SetOpaque(view1);
+    UIView* view2 = new UIView();
+    view2->SetPosition(100, 0, 300, 500); // 100: x; 300: width; 500: height
+    RenderTest::SetOpaque(view2);
+    // painted before view2, which hides it entirely
+    UIView* view3 = new UIView();
+    view3->SetPosition(150, 100, 50, 50); // 150: x; 100: y; 50: width; 50: height
+    rootView->Add(view1);
+    rootView->Add(view3);
+    rootView->Add(view2);
+
+    RenderTest::CreateDefaultWindow(rootView, 0, 0);
+    rootView->SetOcclusionCullingEnabled(false);
+    rootView->Invalidate();
+    usleep(DEFAULT_TASK_PERIOD * 1000); // DEFAULT_TASK_PERIOD * 1000: wait next render task
+    TaskManager::GetInstance()->TaskHandler();
+    RootView::OverdrawStats stats = rootView->GetOverdrawStats();
+    EXPECT_EQ(stats.culledArea, 0);
+    uint32_t fullDrawnArea = stats.drawnArea;
+
+    rootView->SetOcclusionCullingEnabled(true);
+    rootView->Invalidate();
+    usleep(DEFAULT_TASK_PERIOD * 1000); // DEFAULT_TASK_PERIOD * 1000: wait next render task
+    TaskManager::GetInstance()->TaskHandler();
+    stats = rootView->GetOverdrawStats();
+    EXPECT_GT(stats.culledArea, 0);
+    EXPECT_EQ(stats.drawnArea + stats.culledArea, fullDrawnArea);
+    EXPECT_EQ(stats.culledViewNum, 1);
+
+    rootView->RemoveAll();
+    delete view1;
+    delete view2;
+    delete view3;
+    RenderTest::DestroyWindow(rootView);
+    RootView::DestroyWindowRootView(rootView);
+}
+
+/**
+ * @tc.name: Graphic_RenderTest_Test_FrameStats_001
+ * @tc.desc: Verity the frames are paced by the vsync source and counted in the frame statistics
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderTest, Graphic_RenderTest_Test_FrameStats_001, TestSize.Level1)
+{
+    RootView* rootView = RootView::GetWindowRootView();
+    rootView->SetWidth(600);  // 600: width
+    rootView->SetHeight(500); // 500: height
+    rootView->SetPosition(0, 0);
+    RenderTest::CreateDefaultWindow(rootView, 0, 0);
+    RenderManager& renderManager = RenderManager::GetInstance();
+    TestVsyncSource vsyncSource;
+    vsyncSource.vsyncTime_ = VsyncSource::GetTime();
+    renderManager.SetVsyncSource(&vsyncSource);
+    renderManager.ResetFrameStats();
+
+    rootView->Invalidate();
+    TaskManager::GetInstance()->TaskHandler();
+    const RenderManager::FrameStats& stats = renderManager.GetFrameStats();
+    EXPECT_EQ(stats.frameNum, 1);
+    EXPECT_EQ(stats.budget, vsyncSource.GetPeriod());
+    uint32_t histogramNum = 0;
+    for (uint8_t i = 0; i < RenderManager::FRAME_HISTOGRAM_SIZE; i++) {
+        histogramNum += stats.histogram[i];
+    }
+    EXPECT_EQ(histogramNum, 1);
+
+    // no frame until the next vsync
+    rootView->Invalidate();
+    TaskManager::GetInstance()->TaskHandler();
+    EXPECT_EQ(stats.frameNum, 1);
+    vsyncSource.vsyncTime_ = VsyncSource::GetTime();
+    TaskManager::GetInstance()->TaskHandler();
+    EXPECT_EQ(stats.frameNum, 2); // 2: drawn on the second vsync
+
+    // a frame started two periods ago is late
+    vsyncSource.vsyncTime_ = VsyncSource::GetTime() - 2 * vsyncSource.GetPeriod(); // 2: periods
+    rootView->Invalidate();
+    TaskManager::GetInstance()->TaskHandler();
+    EXPECT_EQ(stats.jankNum, 1);
+    EXPECT_GE(stats.droppedNum, 2); // 2: missed vsyncs
+    EXPECT_GT(stats.histogram[RenderManager::FRAME_HISTOGRAM_SIZE - 2], 0); // 2: the bucket under 300%
+
+    renderManager.SetVsyncSource(nullptr);
+    EXPECT_EQ(renderManager.GetPeriod(), DEFAULT_TASK_PERIOD);
+    RenderTest::DestroyWindow(rootView);
+    RootView::DestroyWindowRootView(rootView);
+}
+
+/**
+ * @tc.name: Graphic_RenderTest_Test_WindowOcclusion_001
+ * @tc.desc: Verity a window hidden by an opaque window above is not drawn until it is exposed
+ * @tc.type: FUNC
+ */
+HWTEST_F(RenderTest, Graphic_RenderTest_Test_WindowOcclusion_001, TestSize.Level1)
+{
+    RootView* bottomRootView = RootView::GetWindowRootView();
+    bottomRootView->SetPosition(0, 0, 600, 500); // 600: width; 500: height
+    UITestView* view = new UITestView();
+    bottomRootView->Add(view);
+    RenderTest::CreateDefaultWindow(bottomRootView, 0, 0);
+    RootView* topRootView = RootView::GetWindowRootView();
+    topRootView->SetPosition(0, 0, 600, 500); // 600: width; 500: height
+    RenderTest::CreateDefaultWindow(topRootView, 0, 0);
+    Window* topWindow = topRootView->GetBoundWindow();
+    ASSERT_NE(topWindow, nullptr);
+    topWindow->Show();
+    usleep(DEFAULT_TASK_PERIOD * 1000); // DEFAULT_TASK_PERIOD * 1000: wait next render task
+    TaskManager::GetInstance()->TaskHandler();
+
+    uint32_t skippedWindowNum = RenderManager::GetInstance().GetSkippedWindowNum();
+    g_measureCount = 0;
+    view->Invalidate();
+    usleep(DEFAULT_TASK_PERIOD * 1000); // DEFAULT_TASK_PERIOD * 1000: wait next render task
+    TaskManager::GetInstance()->TaskHandler();
+    EXPECT_EQ(g_measureCount, 0);
+    EXPECT_EQ(RenderManager::GetInstance().GetSkippedWindowNum(), skippedWindowNum + 1);
+
+    // the damage hidden before is drawn once the window above is hidden
+    topWindow->Hide();
+    usleep(DEFAULT_TASK_PERIOD * 1000); // DEFAULT_TASK_PERIOD * 1000: wait next render task
+    TaskManager::GetInstance()->TaskHandler();
+    EXPECT_EQ(g_measureCount, 1);
+
+    bottomRootView->RemoveAll();
+    delete view;
+    RenderTest::DestroyWindow(topRootView);
+    RootView::DestroyWindowRootView(topRootView);
+    RenderTest::DestroyWindow(bottomRootView);
+    RootView::DestroyWindowRootView(bottomRootView);
+}
 } // namespace OHOS
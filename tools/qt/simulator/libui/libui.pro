@@ -57,8 +57,10 @@ SOURCES += \
     ../../../../../utils/frameworks/diagram/vertexprimitive/geometry_shorten_path.cpp \
     ../../../../frameworks/animator/animator.cpp \
     ../../../../frameworks/animator/animator_manager.cpp \
+    ../../../../frameworks/animator/animator_timeline.cpp \
     ../../../../frameworks/animator/easing_equation.cpp \
     ../../../../frameworks/animator/interpolation.cpp \
+    ../../../../frameworks/common/decoded_text.cpp \
     ../../../../frameworks/common/graphic_startup.cpp \
     ../../../../frameworks/common/image_decode_ability.cpp \
     ../../../../frameworks/common/image.cpp \
@@ -67,7 +69,10 @@ SOURCES += \
     ../../../../frameworks/common/task.cpp \
     ../../../../frameworks/common/text.cpp \
     ../../../../frameworks/common/spannable_string.cpp \
+    ../../../../frameworks/common/style_pool.cpp \
     ../../../../frameworks/common/typed_text.cpp \
+    ../../../../frameworks/common/ui_arena.cpp \
+    ../../../../frameworks/common/vsync_source.cpp \
     ../../../../frameworks/components/root_view.cpp \
     ../../../../frameworks/components/text_adapter.cpp \
     ../../../../frameworks/components/ui_abstract_clock.cpp \
@@ -108,15 +113,18 @@ SOURCES += \
     ../../../../frameworks/components/ui_view_group.cpp \
     ../../../../frameworks/components/ui_extend_image_view.cpp \
     ../../../../frameworks/core/input_method_manager.cpp \
+    ../../../../frameworks/dock/focus_index.cpp \
     ../../../../frameworks/dock/focus_manager.cpp \
     ../../../../frameworks/core/render_manager.cpp \
     ../../../../frameworks/core/task_manager.cpp \
     ../../../../frameworks/default_resource/check_box_res.cpp \
+    ../../../../frameworks/dfx/dom_json_writer.cpp \
     ../../../../frameworks/dfx/event_injector.cpp \
     ../../../../frameworks/dfx/key_event_injector.cpp \
     ../../../../frameworks/dfx/performance_task.cpp \
     ../../../../frameworks/dfx/point_event_injector.cpp \
     ../../../../frameworks/dfx/ui_dump_dom_tree.cpp \
+    ../../../../frameworks/dfx/ui_render_trace.cpp \
     ../../../../frameworks/dfx/ui_view_bounds.cpp \
     ../../../../frameworks/dock/input_device.cpp \
     ../../../../frameworks/dock/key_input_device.cpp \
@@ -126,6 +134,8 @@ SOURCES += \
     ../../../../frameworks/dock/vibrator_manager.cpp \
     ../../../../frameworks/dock/virtual_input_device.cpp \
     ../../../../frameworks/engines/gfx/gfx_engine_manager.cpp \
+    ../../../../frameworks/engines/gfx/gfx_replayer.cpp \
+    ../../../../frameworks/engines/gfx/recording_engine.cpp \
     ../../../../frameworks/engines/gfx/soft_engine.cpp \
     ../../../../frameworks/draw/clip_utils.cpp \
     ../../../../frameworks/draw/draw_arc.cpp \
@@ -137,9 +147,12 @@ SOURCES += \
     ../../../../frameworks/draw/draw_rect.cpp \
     ../../../../frameworks/draw/draw_triangle.cpp \
     ../../../../frameworks/draw/draw_utils.cpp \
+    ../../../../frameworks/draw/rotated_glyph_cache.cpp \
     ../../../../frameworks/events/event.cpp \
     ../../../../frameworks/font/base_font.cpp \
     ../../../../frameworks/font/font_ram_allocator.cpp \
+    ../../../../frameworks/font/glyph_disk_cache.cpp \
+    ../../../../frameworks/font/glyph_rasterizer.cpp \
     ../../../../frameworks/font/glyphs_cache.cpp \
     ../../../../frameworks/font/glyphs_file.cpp \
     ../../../../frameworks/font/glyphs_manager.cpp \
@@ -156,7 +169,9 @@ SOURCES += \
     ../../../../frameworks/font/ui_text_shaping.cpp \
     ../../../../frameworks/imgdecode/cache_manager.cpp \
     ../../../../frameworks/imgdecode/file_img_decoder.cpp \
+    ../../../../frameworks/imgdecode/image_decode_service.cpp \
     ../../../../frameworks/imgdecode/image_load.cpp \
+    ../../../../frameworks/imgdecode/image_mipmap.cpp \
     ../../../../frameworks/layout/flex_layout.cpp \
     ../../../../frameworks/layout/grid_layout.cpp \
     ../../../../frameworks/layout/list_layout.cpp \
@@ -216,13 +231,16 @@ HEADERS += \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_range_adapter.h \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_shorten_path.h \
     ../../../../../utils/interfaces/kits/gfx_utils/diagram/vertexprimitive/geometry_vertex_sequence.h \
+    ../../../../frameworks/common/decoded_text.h \
     ../../../../frameworks/common/typed_text.h \
     ../../../../frameworks/core/render_manager.h \
     ../../../../frameworks/default_resource/check_box_res.h \
+    ../../../../frameworks/dfx/dom_json_writer.h \
     ../../../../frameworks/dfx/key_event_injector.h \
     ../../../../frameworks/dfx/point_event_injector.h \
     ../../../../frameworks/components/ui_tree_manager.h \
     ../../../../frameworks/dfx/ui_view_bounds.h \
+    ../../../../frameworks/dock/focus_index.h \
     ../../../../frameworks/dock/input_device.h \
     ../../../../frameworks/dock/pointer_input_device.h \
     ../../../../frameworks/dock/virtual_input_device.h \
@@ -236,11 +254,16 @@ HEADERS += \
     ../../../../frameworks/draw/draw_rect.h \
     ../../../../frameworks/draw/draw_triangle.h \
     ../../../../frameworks/draw/draw_utils.h \
+    ../../../../frameworks/draw/rotated_glyph_cache.h \
+    ../../../../frameworks/engines/gfx/gfx_record_format.h \
+    ../../../../frameworks/engines/gfx/gfx_replayer.h \
     ../../../../frameworks/font/ui_font_adaptor.h \
     ../../../../frameworks/font/ui_multi_font_manager.h \
     ../../../../frameworks/imgdecode/cache_manager.h \
     ../../../../frameworks/imgdecode/file_img_decoder.h \
+    ../../../../frameworks/imgdecode/image_decode_service.h \
     ../../../../frameworks/imgdecode/image_load.h \
+    ../../../../frameworks/imgdecode/image_mipmap.h \
     ../../../../frameworks/render/render_base.h \
     ../../../../frameworks/render/render_buffer.h \
     ../../../../frameworks/render/render_pixfmt_rgba_blend.h \
@@ -250,13 +273,16 @@ HEADERS += \
     ../../../../interfaces/innerkits/common/input_device_manager.h \
     ../../../../interfaces/innerkits/common/input_method_manager.h \
     ../../../../interfaces/innerkits/common/task_manager.h \
+    ../../../../interfaces/innerkits/common/vsync_source.h \
     ../../../../interfaces/innerkits/dock/focus_manager.h \
     ../../../../interfaces/innerkits/dock/rotate_input_device.h \
     ../../../../interfaces/innerkits/dock/vibrator_manager.h \
     ../../../../interfaces/innerkits/font/ui_font_builder.h \
     ../../../../interfaces/innerkits/engines/gfx/gfx_engine_manager.h \
+    ../../../../interfaces/innerkits/engines/gfx/recording_engine.h \
     ../../../../interfaces/innerkits/engines/gfx/soft_engine.h \
     ../../../../interfaces/kits/animator/animator.h \
+    ../../../../interfaces/kits/animator/animator_timeline.h \
     ../../../../interfaces/kits/animator/easing_equation.h \
     ../../../../interfaces/kits/animator/interpolation.h \
     ../../../../interfaces/kits/common/image.h \
@@ -264,6 +290,7 @@ HEADERS += \
     ../../../../interfaces/kits/common/task.h \
     ../../../../interfaces/kits/common/text.h \
     ../../../../interfaces/kits/common/spannable_string.h \
+    ../../../../interfaces/kits/common/ui_arena.h \
     ../../../../interfaces/kits/components/abstract_adapter.h \
     ../../../../interfaces/kits/components/root_view.h \
     ../../../../interfaces/kits/components/text_adapter.h \
@@ -302,6 +329,7 @@ HEADERS += \
     ../../../../interfaces/kits/components/ui_extend_image_view.h \
     ../../../../interfaces/kits/dfx/event_injector.h \
     ../../../../interfaces/kits/dfx/ui_dump_dom_tree.h \
+    ../../../../interfaces/kits/dfx/ui_render_trace.h \
     ../../../../interfaces/kits/events/aod_callback.h \
     ../../../../interfaces/kits/events/cancel_event.h \
     ../../../../interfaces/kits/events/click_event.h \